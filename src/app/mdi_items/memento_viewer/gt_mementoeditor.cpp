@@ -33,12 +33,12 @@ GtMementoEditor::dropEvent(QDropEvent* event)
         return;
     }
 
-    const QString droppedContent = event->mimeData()->data("GtObject");
+    const QByteArray droppedContent = event->mimeData()->data("GtObject");
 
     if (!content.isEmpty())
     {
         GtObjectMemento contentM(content.toUtf8());
-        GtObjectMemento droppedM(droppedContent.toUtf8());
+        GtObjectMemento droppedM(droppedContent);
 
         if (!contentM.isNull() && !droppedM.isNull())
         {
@@ -23,6 +23,7 @@
 #include "batchremote.h"
 #include "gt_consolerunprocess.h"
 #include "gt_consoleupgradeproject.h"
+#include "gt_consolerepackproject.h"
 
 #include "gt_coreapplication.h"
 #include "gt_coreprocessexecutor.h"
@@ -786,6 +787,12 @@ initSystemOptions()
                     "Upgrades All Modules in the current project", {},
                     QList<GtCommandLineArgument>(),
                     false);
+
+    initPosArgument("repack_project", gt::console::repackProjectCommand,
+                    "Rewrites the HDF5 file of a project without unused "
+                    "space", {},
+                    QList<GtCommandLineArgument>(),
+                    false);
 }
 
 int
@@ -0,0 +1,99 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_consolerepackproject.h"
+
+#include "gt_logging.h"
+
+#ifdef GT_H5
+#include "gt_h5externalizationinterface.h"
+#include "genh5_file.h"
+#endif
+
+#include <gt_commandlineparser.h>
+
+#include <QDir>
+#include <QFileInfo>
+
+#include <iostream>
+
+namespace
+{
+
+void
+printRepackProjectHelp()
+{
+    std::cout << std::endl;
+    std::cout << "This is the help for the GTlab repack_project function\n\n";
+
+    std::cout << "Rewrites the HDF5 file of a project, which contains the "
+                 "externalized object data, without the space of deleted "
+                 "or reallocated datasets. The project must not be opened "
+                 "while repacking:\n\n";
+
+    std::cout << "\tGTlabConsole.exe repack_project <projectPath>"
+              << std::endl;
+}
+
+int
+repackRoutine(const QString& projectPath)
+{
+#ifdef GT_H5
+    QFileInfo fi(projectPath);
+    QDir projectDir = fi.isDir() ? QDir(projectPath) : fi.absoluteDir();
+
+    QString filePath = projectDir.absoluteFilePath(
+        QStringLiteral("project.ext") + GenH5::File::dotFileSuffix());
+
+    if (!QFileInfo::exists(filePath))
+    {
+        gtInfo() << QObject::tr("Project has no HDF5 file. "
+                                "Nothing to repack.");
+        return 0;
+    }
+
+    return GtH5ExternalizationInterface::repackFile(filePath) ? 0 : -1;
+#else
+    Q_UNUSED(projectPath);
+    gtError() << QObject::tr("GTlab was built without HDF5 support!");
+    return -1;
+#endif
+}
+
+} // namespace
+
+int
+gt::console::repackProjectCommand(const QStringList& repackProjectArguments)
+{
+    GtCommandLineParser repackProjectParser;
+    repackProjectParser.addHelpOption();
+
+    if (!repackProjectParser.parse(repackProjectArguments))
+    {
+        std::cerr << QObject::tr("\n\nrunning repack_project "
+                                 "without arguments is invalid\n\n")
+                         .toStdString();
+        return -1;
+    }
+
+    if (repackProjectParser.helpOption())
+    {
+        printRepackProjectHelp();
+        return 0;
+    }
+
+    // positionalArgument 1 is the path to the project
+    if (repackProjectParser.positionalArguments().size() != 1)
+    {
+        std::cerr << QObject::tr("\n\nInvalid usage "
+                                 "of repack_project routine!\n\n")
+                         .toStdString();
+        printRepackProjectHelp();
+        return -1;
+    }
+
+    return repackRoutine(repackProjectParser.positionalArguments().at(0));
+}
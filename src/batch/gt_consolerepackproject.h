@@ -0,0 +1,29 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_CONSOLEREPACKPROJECT_H
+#define GT_CONSOLEREPACKPROJECT_H
+
+#include <QStringList>
+
+namespace gt
+{
+namespace console
+{
+
+/**
+ * @brief A batch command to repack the HDF5 file of a gtlab project, i.e.
+ * to rewrite the file without the space of deleted datasets.
+ * @param args Command line parameters passed from main
+ *
+ * @return 0 on success
+ */
+int repackProjectCommand(const QStringList& args);
+
+}
+}
+
+#endif // GT_CONSOLEREPACKPROJECT_H
@@ -243,7 +243,7 @@ GtRemoteProcessRunner::sendResponse(const GtProcessRunnerResponse& response)
     }
 
     // send data
-    auto res = sendData(*m_connection, response.toMemento().toByteArray());
+    auto res = sendData(*m_connection, m_connection->serialize(response));
 
     // Aborted
     if (res != GtEventLoop::Success)
@@ -295,7 +295,7 @@ GtRemoteProcessRunner::processPendingNotifications()
 
         // send data
         auto res = sendData(
-                       *m_connection, notification.toMemento().toByteArray());
+                       *m_connection, m_connection->serialize(notification));
 
         // abort (e.g. connection lost)
         if (res == GtEventLoop::Aborted)
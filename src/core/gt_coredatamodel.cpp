@@ -500,8 +500,65 @@ GtCoreDatamodel::rowCount(const QModelIndex& parent) const
         return 0;
     }
 
+    // linked objects report their children once they are fetched
+    if (!parentItem->isMaterialized())
+    {
+        return 0;
+    }
+
     // return number of child objects
-    return parentItem->findDirectChildren<GtObject*>().size();
+    return parentItem->directChildCount();
+}
+
+bool
+GtCoreDatamodel::hasChildren(const QModelIndex& parent) const
+{
+    GtObject* parentItem = objectFromIndex(parent);
+
+    if (parentItem && parent.column() == 0 && !parentItem->isMaterialized())
+    {
+        return true;
+    }
+
+    return QAbstractItemModel::hasChildren(parent);
+}
+
+bool
+GtCoreDatamodel::canFetchMore(const QModelIndex& parent) const
+{
+    GtObject* parentItem = objectFromIndex(parent);
+
+    return parentItem && !parentItem->isMaterialized();
+}
+
+void
+GtCoreDatamodel::fetchMore(const QModelIndex& parent)
+{
+    GtObject* parentItem = objectFromIndex(parent);
+
+    if (!parentItem || parentItem->isMaterialized())
+    {
+        return;
+    }
+
+    // the placeholder did not report any rows so far, the rows have to be
+    // announced before the children are created
+    const GtObjectMemento data = parentItem->loadLinkedData();
+    const int count = data.childObjects.size();
+
+    if (count > 0)
+    {
+        beginInsertRows(parent, 0, count - 1);
+    }
+
+    parentItem->materialize(data);
+
+    if (count > 0)
+    {
+        endInsertRows();
+    }
+
+    emit dataChanged(parent, parent);
 }
 
 QModelIndex
@@ -540,17 +597,14 @@ GtCoreDatamodel::index(int row, int col, const QModelIndex& parent) const
         return {};
     }
 
-    QList<GtObject*> childItems =
-            parentItem->findDirectChildren<GtObject*>();
-
-    // check array size
-    if (row >= childItems.size())
+    // linked objects report their children once they are fetched
+    if (!parentItem->isMaterialized())
     {
         return {};
     }
 
     // get child object corresponding to row number
-    GtObject* childItem = childItems[row];
+    GtObject* childItem = parentItem->childAt(row);
 
     // check object
     if (!childItem)
@@ -740,7 +794,8 @@ GtCoreDatamodel::mimeDataFromObject(GtObject* obj, bool newUuid) const
     QMimeData* mimeData = new QMimeData;
 
     // append memento to mime data
-    mimeData->setData(QStringLiteral("GtObject"), memento.toByteArray());
+    mimeData->setData(QStringLiteral("GtObject"),
+                      memento.toByteArray(GtObjectMemento::Format::Binary));
 
     // return mime data
     return mimeData;
@@ -150,6 +150,29 @@ public:
      */
     int rowCount(const QModelIndex& parent = QModelIndex()) const override;
 
+    /**
+     * @brief Returns true if parent has any children. Linked objects that
+     * were not loaded yet are expected to have children.
+     * @param Parent model index
+     * @return Whether the parent has children
+     */
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+    /**
+     * @brief Returns true if the object of the given index is a linked object
+     * that was not loaded yet (see GtObject::isMaterialized).
+     * @param Parent model index
+     * @return Whether the children can be fetched
+     */
+    bool canFetchMore(const QModelIndex& parent) const override;
+
+    /**
+     * @brief Loads the linked object of the given index and inserts its
+     * children.
+     * @param Parent model index
+     */
+    void fetchMore(const QModelIndex& parent) override;
+
     /**
      * @brief Returns the index of the item in the model specified by the
      * given row, column and parent index.
@@ -11,6 +11,9 @@
 #include <QDir>
 #include <QElapsedTimer>
 #include <QEventLoop>
+#include <QFile>
+#include <QTextStream>
+#include <QThreadPool>
 
 #include "gt_logging.h"
 #include "gt_runnable.h"
@@ -19,13 +22,80 @@
 #include "gt_objectmemento.h"
 #include "gt_task.h"
 #include "gt_objectmementodiff.h"
+#include "gt_typedmementodiff.h"
 #include "gt_coreapplication.h"
 #include "gt_taskrunner.h"
+#include "gt_settings.h"
 
 #include "gt_coreprocessexecutor.h"
 
 const std::string GtCoreProcessExecutor::S_ID = "CoreProcessExecutor";
 
+namespace
+{
+
+/// Returns whether the results of a task should be dumped for diagnostic
+/// purposes
+bool
+dumpProcessResults()
+{
+    QByteArray const env = qgetenv("GTLAB_DUMP_PROCESS_RESULTS");
+
+    if (!env.isEmpty()) return env != "0";
+
+    return gtApp && gtApp->settings() && gtApp->settings()->dumpProcessResults();
+}
+
+/// Thread pool writing the result dumps one after another in the background
+QThreadPool&
+dumpWriterPool()
+{
+    static QThreadPool pool;
+    pool.setMaxThreadCount(1);
+
+    return pool;
+}
+
+/// Writes the diff, the new and the old memento of a merged result
+class ResultDumpJob : public QRunnable
+{
+public:
+    ResultDumpJob(QString filePath, GtObjectMemento old,
+                  GtObjectMemento memento) :
+        m_filePath(std::move(filePath)),
+        m_old(std::move(old)),
+        m_new(std::move(memento))
+    { }
+
+    void run() override
+    {
+        GtObjectMementoDiff diff(m_old, m_new);
+
+        QFile file(m_filePath);
+
+        if (!file.open(QFile::WriteOnly))
+        {
+            gtWarning().medium() << QObject::tr("Could not write '%1'")
+                                        .arg(m_filePath);
+            return;
+        }
+
+        QTextStream TextStream(&file);
+        TextStream << diff.toByteArray();
+        TextStream << "######### new";
+        TextStream << m_new.toByteArray();
+        TextStream << "######### old";
+        TextStream << m_old.toByteArray();
+        file.close();
+    }
+
+private:
+    QString m_filePath;
+    GtObjectMemento m_old, m_new;
+};
+
+} // namespace
+
 struct GtCoreProcessExecutor::Impl
 {
     /// save results is used as standard
@@ -327,11 +397,9 @@ GtCoreProcessExecutor::handleTaskFinishedHelper(
     // calculators included in the task
     if (m_source)
     {
-        QDir tempDir;
-
-        tempDir = gtApp->applicationTempDir();
+        bool const dump = dumpProcessResults();
 
-        GtObjectMementoDiff sumDiff;
+        GtTypedMementoDiff sumDiff;
 
         gtDebugId(GT_EXEC_ID).medium() << "generating sum diff...";
 
@@ -347,22 +415,19 @@ GtCoreProcessExecutor::handleTaskFinishedHelper(
                         << "target found =" << target->objectName();
 
                 GtObjectMemento old = target->toMemento(true);
-                GtObjectMementoDiff diff(old, memento);
+                GtTypedMementoDiff diff(old, memento);
 
-                QString filename = target->objectName() +
-                                   QStringLiteral(".xml");
-
-                QFile file(tempDir.absoluteFilePath(filename));
-
-                if (file.open(QFile::WriteOnly))
+                // diagnostics are written in the background to not delay
+                // the merge
+                if (dump)
                 {
-                    QTextStream TextStream(&file);
-                    TextStream << diff.toByteArray();
-                    TextStream << "######### new";
-                    TextStream << memento.toByteArray();
-                    TextStream << "######### old";
-                    TextStream << old.toByteArray();
-                    file.close();
+                    QString filename = target->objectName() +
+                                       QStringLiteral(".xml");
+
+                    dumpWriterPool().start(new ResultDumpJob(
+                        GtCoreApplication::applicationTempDir()
+                            .absoluteFilePath(filename),
+                        old, memento));
                 }
 
                 sumDiff << diff;
@@ -78,16 +78,11 @@ GtExplorerModel::filterAcceptsRow(int source_row,
 
         if (obj)
         {
-            GtObjectList childs = obj->findDirectChildren<GtObject*>();
+            GtObject* c = obj->childAt(source_row);
 
-            if (childs.size() > source_row)
+            if (c && c->isUserHidden())
             {
-                GtObject* c = childs.at(source_row);
-
-                if (c->isUserHidden())
-                {
-                    return false;
-                }
+                return false;
             }
         }
     }
@@ -10,9 +10,12 @@
 
 #include <QFile>
 #include <QMimeData>
+#include <QHash>
 #include <QUrl>
 
+#include <algorithm>
 #include <ctime>
+#include <vector>
 
 #include "gt_coreapplication.h"
 #include "gt_settings.h"
@@ -22,6 +25,9 @@
 #include "gt_logdest.h"
 #include "gt_utilities.h"
 
+#include "internal/gt_mpscqueue.h"
+#include "internal/gt_ringbuffer.h"
+
 const auto DESTINATION_ID = [](){ return GT_CLASSNAME(GtLogModel); };
 
 void
@@ -42,7 +48,105 @@ GtLogSignalSlotDestination::write(std::string const& message,
     );
 }
 
+struct GtLogModel::Impl
+{
+    /// Message as received from the logger
+    struct Message
+    {
+        QString msg;
+        QString id;
+        /// seconds since epoch
+        qint64 time;
+        int level;
+    };
+
+    /// Entry of the model
+    struct Entry
+    {
+        QString msg;
+        /// seconds since epoch
+        qint64 time{0};
+        int level{0};
+        /// index of the interned logging id
+        int id{0};
+    };
+
+    /**
+     * @brief Logging destination of the log model. The messages are put into
+     * the lock-free queue, thus the logging threads never wait for the GUI
+     * thread.
+     */
+    class Destination : public gt::log::Destination
+    {
+    public:
+        explicit Destination(GtLogModel& model) : m_model(model) { }
+
+        void write(std::string const& message,
+                   gt::log::Level level,
+                   gt::log::Details const& details) override
+        {
+            struct tm time = details.time;
+
+            m_model.pimpl->enqueue(m_model, Message{
+                QString::fromStdString(message),
+                QString::fromStdString(details.id),
+                static_cast<qint64>(std::mktime(&time)),
+                gt::log::levelToInt(level)
+            });
+        }
+
+    private:
+        GtLogModel& m_model;
+    };
+
+    gt::detail::RingBuffer<Entry> entries;
+
+    gt::detail::MpscQueue<Message> queue;
+
+    /// interned logging ids, the first one is the empty id
+    QStringList ids{QString{}};
+
+    QHash<QString, int> idIndices{{QString{}, 0}};
+
+    explicit Impl(int capacity) : entries(capacity) { }
+
+    /// Queues the message and notifies the model, if the queue was empty
+    void enqueue(GtLogModel& model, Message message)
+    {
+        if (queue.push(std::move(message)))
+        {
+            QMetaObject::invokeMethod(&model, "processQueue",
+                                      Qt::QueuedConnection);
+        }
+    }
+
+    Entry makeEntry(Message&& message)
+    {
+        auto iter = idIndices.find(message.id);
+        if (iter == idIndices.end())
+        {
+            iter = idIndices.insert(message.id, ids.size());
+            ids.append(message.id);
+        }
+
+        return Entry{std::move(message.msg), message.time, message.level,
+                     *iter};
+    }
+
+    GtLogDetails details(Entry const& entry) const
+    {
+        return GtLogDetails{ids.at(entry.id),
+                            QDateTime::fromSecsSinceEpoch(entry.time)};
+    }
+
+    QString format(Entry const& entry) const
+    {
+        return GtLogModel::format(entry.msg, details(entry));
+    }
+};
+
 GtLogModel::GtLogModel() :
+    pimpl(std::make_unique<Impl>(2000)),
     m_tmpClearLog(false),
     m_maxEntries(2000)
 {
@@ -60,6 +164,12 @@ GtLogModel::GtLogModel() :
     }
 }
 
+GtLogModel::~GtLogModel()
+{
+    // the destination refers to this model
+    gt::log::Logger::instance().removeDestination(DESTINATION_ID());
+}
+
 GtLogModel&
 GtLogModel::instance()
 {
@@ -72,8 +182,8 @@ GtLogModel::setupLoggingDestination()
 {
     gt::log::Logger& logger = gt::log::Logger::instance();
 
-    auto dest = gt::log::makeSignalSlotDestination(this, &GtLogModel::onMessage);
-    logger.addDestination(DESTINATION_ID(), std::move(dest));
+    logger.addDestination(DESTINATION_ID(),
+                          std::make_unique<Impl::Destination>(*this));
 }
 
 QString
@@ -121,16 +231,13 @@ GtLogModel::setEnabled(bool enable)
 bool
 GtLogModel::containsLogLevel(gt::log::Level level) const
 {
-    return std::any_of(m_entries.begin(), m_entries.end(),
-                       [level](Entry const& e){
-        return e.level == level;
-    });
-}
+    auto const& entries = pimpl->entries;
+    for (int i = 0; i < entries.size(); ++i)
+    {
+        if (entries.at(i).level == level) return true;
+    }
 
-QString
-GtLogModel::format(const Entry& entry)
-{
-    return format(entry.msg, entry.details);
+    return false;
 }
 
 int
@@ -138,7 +245,7 @@ GtLogModel::rowCount(const QModelIndex& parent) const
 {
     if(parent.isValid()) return 0; //no children
 
-    return m_entries.count();
+    return pimpl->entries.size();
 }
 
 int
@@ -156,7 +263,7 @@ GtLogModel::data(const QModelIndex& index, int role) const
     int row = index.row();
     int col = index.column();
 
-    if (!index.isValid() || row >= m_entries.count())
+    if (!index.isValid() || row >= pimpl->entries.size())
     {
         return {};
     }
@@ -167,7 +274,7 @@ GtLogModel::data(const QModelIndex& index, int role) const
         role = columnToRole(col);
     }
 
-    Entry const& entry = m_entries.at(index.row());
+    auto const& entry = pimpl->entries.at(row);
 
     // get data
     switch (role)
@@ -175,9 +282,9 @@ GtLogModel::data(const QModelIndex& index, int role) const
     case LevelRole:
         return entry.level;
     case TimeRole:
-        return entry.details.time.toString("hh:mm:ss");
+        return QDateTime::fromSecsSinceEpoch(entry.time).toString("hh:mm:ss");
     case IdRole:
-        return entry.details.id;
+        return pimpl->ids.at(entry.id);
     case MessageRole:
         return entry.msg;
     default:
@@ -230,12 +337,14 @@ GtLogModel::exportLogToFile(const QString& fileName)
 
     QTextStream out(&file);
 
-    for (Entry const& entry : qAsConst(m_entries))
+    auto const& entries = pimpl->entries;
+    for (int i = 0; i < entries.size(); ++i)
     {
+        auto const& entry = entries.at(i);
         auto level = gt::log::levelFromInt(entry.level);
 
         out << gt::log::levelToString(level).c_str() << ' '
-            << format(entry) << "\r\n";
+            << pimpl->format(entry) << "\r\n";
     }
 
     return true;
@@ -251,7 +360,7 @@ GtLogModel::mimeData(QModelIndexList const& indexes) const
     for (const QModelIndex& index : indexes)
     {
         int row = index.row();
-        if (row < 0 || row >= m_entries.count())
+        if (row < 0 || row >= pimpl->entries.size())
         {
             return {};
         }
@@ -267,8 +376,9 @@ GtLogModel::mimeData(QModelIndexList const& indexes) const
         assert(!list.empty());
         QString& str = list.last();
 
-        auto const& entry = m_entries.at(row);
+        auto const& entry = pimpl->entries.at(row);
         auto const  level = gt::log::levelFromInt(entry.level);
+        auto const& id = pimpl->ids.at(entry.id);
 
         // append data
         switch (columnToRole(index.column()))
@@ -277,12 +387,13 @@ GtLogModel::mimeData(QModelIndexList const& indexes) const
             str.append(QString::fromStdString(gt::log::levelToString(level)));
             break;
         case TimeRole:
-            str.append(entry.details.time.toString("[hh:mm:ss]"));
+            str.append(QDateTime::fromSecsSinceEpoch(entry.time)
+                           .toString("[hh:mm:ss]"));
             break;
         case IdRole:
-            if (!entry.details.id.isEmpty())
+            if (!id.isEmpty())
             {
-                str.append(gt::quoted(entry.details.id, QChar{'['}, QChar{']'}));
+                str.append(gt::quoted(id, QChar{'['}, QChar{']'}));
             }
             break;
         case MessageRole:
@@ -307,32 +418,27 @@ GtLogModel::setMaxLogLength(int val)
 
     m_maxEntries = val;
 
+    QMutexLocker locker{&m_mutex};
+
     // remove some entries
-    if (m_entries.size() > m_maxEntries)
+    if (pimpl->entries.size() > m_maxEntries)
     {
         beginResetModel();
-
-        m_entries = m_entries.mid(m_entries.size() - m_maxEntries);
-
-        assert(m_entries.size() == m_maxEntries);
-
+        pimpl->entries.setCapacity(m_maxEntries);
+        assert(pimpl->entries.size() == m_maxEntries);
         endResetModel();
+        return;
     }
+
+    pimpl->entries.setCapacity(m_maxEntries);
 }
 
 void
 GtLogModel::onMessage(const QString& msg, int level, Details const& details)
 {
-    QMutexLocker locker{&m_mutex};
-    if (m_timer.isActive())
-    {
-        m_tmpEntries << Entry({ msg, level, details});
-    }
-    else
-    {
-        insertMessageNonlocked(msg, level, details);
-        m_timer.start(500);
-    }
+    pimpl->enqueue(*this, Impl::Message{
+        msg, details.id, details.time.toSecsSinceEpoch(), level
+    });
 }
 
 void
@@ -340,8 +446,10 @@ GtLogModel::execClear()
 {
     if (m_tmpClearLog)
     {
+        QMutexLocker locker{&m_mutex};
+
         beginResetModel();
-        m_entries.clear();
+        pimpl->entries.clear();
         endResetModel();
         m_tmpClearLog = false;
         emit logCleared();
@@ -361,20 +469,6 @@ GtLogModel::clearLog()
     execClear();
 }
 
-void
-GtLogModel::insertMessageNonlocked(QString const& msg, int level, Details const& details)
-{
-    if (m_entries.size() >= m_maxEntries)
-    {
-        // we must use the non-locked
-        removeElementListNonlocked({index(0, 0)});
-    }
-
-    beginInsertRows(QModelIndex(), m_entries.size(), m_entries.size());
-    m_entries << Entry({ msg, level, details });
-    endInsertRows();
-}
-
 void
 GtLogModel::removeElement(QModelIndex index)
 {
@@ -390,14 +484,14 @@ GtLogModel::removeElementListNonlocked(const QModelIndexList& indexList)
     {
         const auto& idx = *iter;
 
-        if (idx.row() < 0 || idx.row() >= m_entries.size())
+        if (idx.row() < 0 || idx.row() >= pimpl->entries.size())
         {
             continue;
         }
 
         beginRemoveRows(QModelIndex(), idx.row(), idx.row());
 
-        m_entries.removeAt(idx.row());
+        pimpl->entries.removeAt(idx.row());
 
         endRemoveRows();
     }
@@ -413,6 +507,15 @@ GtLogModel::removeElementList(QModelIndexList indexList)
     removeElementListNonlocked(indexList);
 }
 
+void
+GtLogModel::processQueue()
+{
+    // the messages are transferred with the next update
+    if (m_timer.isActive()) return;
+
+    insertQueue();
+}
+
 void
 GtLogModel::insertQueue()
 {
@@ -420,51 +523,42 @@ GtLogModel::insertQueue()
 
     execClear();
 
-    if (m_tmpEntries.isEmpty())
+    std::vector<Impl::Message> messages;
+    pimpl->queue.consumeAll([&messages](Impl::Message&& message) {
+        messages.push_back(std::move(message));
+    });
+
+    if (messages.empty())
     {
         return;
     }
 
-    int newRows = m_tmpEntries.size();
+    // update the model periodically as long as messages are coming in
+    m_timer.start(500);
 
-    // check whether size of new entries exceeds the maximum allowed entries
-    if (newRows > m_maxEntries)
-    {
-        for (int i = 0; i < (newRows - m_maxEntries); i++)
-        {
-            m_tmpEntries.removeFirst();
-        }
-    }
+    QMutexLocker locker{&m_mutex};
 
-    int delta = (m_entries.size() + m_tmpEntries.size()) - m_maxEntries;
+    auto& entries = pimpl->entries;
+    int const capacity = entries.capacity();
 
-    if (delta > m_maxEntries)
-    {
-        for (int i = 0; i < (delta - m_maxEntries); i++)
-        {
-            m_tmpEntries.removeFirst();
-        }
-    }
+    // only the newest messages fit into the model
+    int const skip = std::max(static_cast<int>(messages.size()) - capacity, 0);
+    int const newRows = static_cast<int>(messages.size()) - skip;
 
-    newRows = m_tmpEntries.size() - 1;
-    delta = (m_entries.size() + m_tmpEntries.size()) - m_maxEntries;
+    int const overflow = entries.size() + newRows - capacity;
 
-    if (delta > 0)
+    if (overflow > 0)
     {
-        beginRemoveRows(QModelIndex{}, 0, delta - 1);
-        for (int i = 0; i < delta; i++)
-        {
-            m_entries.removeFirst();
-        }
+        beginRemoveRows(QModelIndex{}, 0, overflow - 1);
+        entries.pop_front(overflow);
         endRemoveRows();
     }
 
-    beginInsertRows(QModelIndex{}, m_entries.size(), m_entries.size() + newRows);
-    for (Entry const& entry : qAsConst(m_tmpEntries))
+    beginInsertRows(QModelIndex{}, entries.size(),
+                    entries.size() + newRows - 1);
+    for (auto iter = messages.begin() + skip; iter != messages.end(); ++iter)
     {
-        m_entries << entry;
+        entries.push_back(pimpl->makeEntry(std::move(*iter)));
     }
     endInsertRows();
-
-    m_tmpEntries.clear();
 }
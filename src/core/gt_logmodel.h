@@ -22,6 +22,8 @@
 #include <QMutex>
 #include <QTimer>
 
+#include <memory>
+
 #define gtLogModel (&GtLogModel::instance())
 
 struct GtLogDetails
@@ -107,6 +109,12 @@ makeSignalSlotDestination(T* receiver, F member)
 
 /**
  * @brief The GtLogModel class
+ *
+ * Log messages are collected in a lock-free queue, thus logging threads never
+ * block on the GUI thread. The queue is transferred into the model
+ * periodically, which emits at most one row removal and one row insertion per
+ * transfer. The entries are stored in a ring buffer of fixed capacity (see
+ * setMaxLogLength), dropping the oldest entries.
  */
 class GT_CORE_EXPORT GtLogModel : public QAbstractTableModel
 {
@@ -274,6 +282,13 @@ public:
 
 public slots:
 
+    /**
+     * @brief Queues the message. It is inserted into the model with the
+     * next update. May be called from any thread.
+     * @param msg Message
+     * @param level Log level
+     * @param details Logging details
+     */
     void onMessage(QString const& msg ,int level, GtLogDetails const& details);
 
     /**
@@ -292,19 +307,12 @@ protected:
      */
     explicit GtLogModel();
 
-private:
-
-    /// Entry struct
-    struct Entry
-    {
-        QString msg;
-        int level;
-        Details details;
-    };
+    ~GtLogModel() override;
 
-    QVector<Entry> m_entries;
+private:
 
-    QVector<Entry> m_tmpEntries;
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
 
     QMutex m_mutex;
 
@@ -314,21 +322,6 @@ private:
 
     int m_maxEntries;
 
-    /**
-     * @brief Formats the message described by entry
-     * @param entry Entry to format
-     * @return Formatted String
-     */
-    static QString format(Entry const& entry);
-
-    /**
-     * @brief Inserts the message into the model
-     * @param msg Message
-     * @param level Level
-     * @param details Logging details
-     */
-    void insertMessageNonlocked(const QString& msg ,int level, Details const& details);
-
     /**
      * @brief Non mutex-locked implementation of element removal
      */
@@ -346,7 +339,16 @@ private:
 
 private slots:
 
+    /**
+     * @brief Transfers the queued messages into the model
+     */
     void insertQueue();
+
+    /**
+     * @brief Called once messages were queued. Transfers them immediately,
+     * if no update is scheduled.
+     */
+    void processQueue();
 };
 
 #endif // GTLOGMODEL_H
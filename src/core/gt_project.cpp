@@ -11,6 +11,7 @@
 #include <QDomDocument>
 #include <QXmlStreamWriter>
 #include <QDir>
+#include <QFileInfo>
 #include <QDirIterator>
 #include <QDateTime>
 
@@ -26,6 +27,7 @@
 #include "gt_labeldata.h"
 #include "gt_label.h"
 #include "gt_xmlutilities.h"
+#include "gt_xmlexpr.h"
 #include "gt_footprint.h"
 #include "gt_versionnumber.h"
 #include "internal/gt_projectio.h"
@@ -42,8 +44,152 @@
 #include "internal/gt_moduleupgrader.h"
 
 #include <QTemporaryDir>
+#include <QElapsedTimer>
+#include <QThreadPool>
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+/// Module file of a project and its parsed content
+struct ModuleFile
+{
+    QString moduleId;
+    QString filename;
+    /// package of the module, created before parsing the file
+    std::unique_ptr<GtPackage> package;
+    /// whether the objects are read directly into mementos
+    bool readMementos{false};
+    /// module document including the linked files that are loaded eagerly
+    QDomDocument document;
+    /// object mementos, if the package supports reading them
+    QVector<GtObjectMemento> objects;
+    /// tag and uuid of the root element
+    QString rootTag;
+    QString uuid;
+    QStringList warnings;
+    /// time spent for reading and parsing in ms
+    qint64 parseTime{0};
+};
+
+/// Job reading and parsing a module file in a worker thread
+class ModuleParseJob : public QRunnable
+{
+public:
+    explicit ModuleParseJob(ModuleFile& moduleFile) :
+        m_moduleFile(moduleFile)
+    { }
+
+    void run() override
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        // linked objects are loaded on first access
+        if (m_moduleFile.readMementos)
+        {
+            QHash<QString, QString> rootAttributes;
+            if (gt::xml::readMementosWithLinkedObjects(
+                    m_moduleFile.filename, m_moduleFile.objects,
+                    &m_moduleFile.rootTag, &rootAttributes,
+                    &m_moduleFile.warnings,
+                    gt::xml::LinkedObjectLoading::OnDemand))
+            {
+                m_moduleFile.uuid =
+                    rootAttributes.value(QStringLiteral("uuid"));
+            }
+            else
+            {
+                m_moduleFile.rootTag.clear();
+            }
+        }
+        else
+        {
+            m_moduleFile.document = gt::xml::loadProjectXmlWithLinkedObjects(
+                m_moduleFile.filename, &m_moduleFile.warnings,
+                gt::xml::LinkedObjectLoading::OnDemand);
+
+            QDomElement root = m_moduleFile.document.documentElement();
+            m_moduleFile.rootTag = root.tagName();
+            m_moduleFile.uuid = root.attribute(QStringLiteral("uuid"));
+        }
+
+        m_moduleFile.parseTime = timer.elapsed();
+    }
+
+private:
+    ModuleFile& m_moduleFile;
+};
+
+/// Returns true, if neither the package nor any of its objects changed since
+/// it was loaded or saved
+bool
+isUnchanged(const GtObject& package)
+{
+    return !package.hasChanges() && !package.hasChildChanged() &&
+           !package.newlyCreated();
+}
+
+/// Replaces the elements of linked objects, whose files are in sync with the
+/// objects, by references to these files. Thus, the files are neither
+/// serialized nor written again when saving.
+void
+replaceUnchangedLinkedObjects(GtObject& package, QDomElement& parent)
+{
+    using namespace gt::xml;
+
+    for (QDomElement elem = parent.firstChildElement(); !elem.isNull();)
+    {
+        QDomElement next = elem.nextSiblingElement();
+
+        if (elem.tagName() == S_OBJECT_TAG &&
+            elem.attribute(S_ASLINK_TAG) == QLatin1String("true"))
+        {
+            const QString uuid = elem.attribute(S_UUID_TAG);
+            GtObject const* obj = package.getObjectByUuid(uuid);
+
+            if (obj && obj->isMaterialized() && obj->isLinkedFileInSync() &&
+                QFileInfo::exists(obj->linkedFilePath()))
+            {
+                QDomElement ref =
+                    elem.ownerDocument().createElement(S_OBJECTREF_TAG);
+                ref.setAttribute(S_CLASS_TAG, elem.attribute(S_CLASS_TAG));
+                ref.setAttribute(S_NAME_TAG, elem.attribute(S_NAME_TAG));
+                ref.setAttribute(S_UUID_TAG, uuid);
+                ref.setAttribute(S_HREF_TAG, obj->linkedFilePath());
+                ref.setAttribute(S_LINKBASE_TAG, obj->linkedFileBaseDir());
+
+                parent.replaceChild(ref, elem);
+                elem = next;
+                continue;
+            }
+        }
+
+        replaceUnchangedLinkedObjects(package, elem);
+        elem = next;
+    }
+}
+
+/// Updates the linked object files of the objects after saving. The
+/// locations of materialized objects that are not stored in linked files
+/// anymore are reset.
+void
+updateLinkedFileLocations(GtObject& parent,
+                          const QHash<QString, QString>& linkedFiles,
+                          const QString& baseDir)
+{
+    for (GtObject* child : parent.findDirectChildren())
+    {
+        child->setLinkedFileLocation(linkedFiles.value(child->uuid()), baseDir);
+        updateLinkedFileLocations(*child, linkedFiles, baseDir);
+    }
+}
+
+} // namespace
 
 GtProject::GtProject(const QString& path) :
     m_path(path),
@@ -609,6 +755,8 @@ GtProject::readModuleData()
 {
     GtObjectList retval;
 
+    std::vector<ModuleFile> moduleFiles;
+
     foreach (const QString& mid, m_moduleIds)
     {
         if (!gtApp->moduleIds().contains(mid))
@@ -631,9 +779,7 @@ GtProject::readModuleData()
         QString filename = m_path + QDir::separator() + mid.toLower() + "." +
                            moduleExtension();
 
-        QFile file(filename);
-
-        if (!file.exists())
+        if (!QFile::exists(filename))
         {
             gtWarning() << objectName() << ": "
                       << tr("GTlab module file not found!") << "(" << mid
@@ -641,60 +787,69 @@ GtProject::readModuleData()
             continue;
         }
 
-        QStringList warnings;
-        QDomDocument document = gt::xml::loadProjectXmlWithLinkedObjects(
-            filename, &warnings
-            );
-
-        if (!warnings.isEmpty())
-        {
-            for (auto&& warn : warnings) gtWarning() << warn;
-        }
+        GtObject* obj = gtObjectFactory->newObject(packageId);
+        std::unique_ptr<GtPackage> package(qobject_cast<GtPackage*>(obj));
 
-        if (document.isNull() || document.documentElement().isNull())
+        if (!package)
         {
+            gtWarning() << objectName() << ": "
+                        << tr("Failed to create module package!")
+                        << " (" << mid << ")";
+            delete obj;
             continue;
         }
 
-        QDomElement root = document.documentElement();
+        ModuleFile moduleFile;
+        moduleFile.moduleId = mid;
+        moduleFile.filename = filename;
+        moduleFile.readMementos = package->supportsMementoData();
+        moduleFile.package = std::move(package);
+        moduleFiles.push_back(std::move(moduleFile));
+    }
 
-        if (root.isNull() || (root.tagName() != QLatin1String("GTLABMODULE")))
+    // the module files and their linked files are independent documents,
+    // thus they are parsed concurrently
+    {
+        QThreadPool pool;
+        for (ModuleFile& moduleFile : moduleFiles)
         {
-            gtWarning() << tr("Invalid GTlab module file!");
-            continue;
+            pool.start(new ModuleParseJob(moduleFile));
         }
+        pool.waitForDone();
+    }
 
-        const QString uuid = root.attribute(QStringLiteral("uuid"));
+    // the objects are created by the calling thread in the order of the
+    // modules
+    for (ModuleFile& moduleFile : moduleFiles)
+    {
+        const QString& mid = moduleFile.moduleId;
 
-        if (uuid.isEmpty())
-        {
-            gtWarning() << tr("Invalid GTlab module file!");
-            continue;
-        }
+        for (auto&& warn : qAsConst(moduleFile.warnings)) gtWarning() << warn;
 
-        GtObject* obj = gtObjectFactory->newObject(packageId);
+        QElapsedTimer timer;
+        timer.start();
 
-        if (!obj)
+        if (moduleFile.rootTag.isEmpty())
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to create module package!")
-                        << " (" << mid << ")";
             continue;
         }
 
-        GtPackage* package = qobject_cast<GtPackage*>(obj);
-
-        if (!package)
+        if (moduleFile.rootTag != QLatin1String("GTLABMODULE") ||
+            moduleFile.uuid.isEmpty())
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to create module package!")
-                        << " (" << mid << ")";
+            gtWarning() << tr("Invalid GTlab module file!");
             continue;
         }
 
-        package->setUuid(uuid);
+        GtPackage* package = moduleFile.package.get();
+
+        package->setUuid(moduleFile.uuid);
 
-        if (!package->readData(root) || !package->readMiscData(QDir(m_path)))
+        bool const success = moduleFile.readMementos ?
+            package->readMementoData(moduleFile.objects) :
+            package->readData(moduleFile.document.documentElement());
+
+        if (!success || !package->readMiscData(QDir(m_path)))
         {
             gtWarning() << objectName() << ": "
                         << tr("Failed to read module data!")
@@ -705,7 +860,21 @@ GtProject::readModuleData()
         // externalized object must be initialized
         gtExternalizationManager->initExternalizedObjects(*package);
 
-        retval.append(obj);
+        // the parsed data is no longer needed
+        moduleFile.document.clear();
+        moduleFile.objects.clear();
+
+        // the module file is in sync with the package
+        m_savedModules.insert(
+            mid, getProjectSettings().ownObjectFileSerializationEnabled());
+
+        gtDebug().medium() << tr("Module data of '%1' loaded "
+                                 "(parsing: %2 ms, restoring: %3 ms)")
+                                  .arg(mid)
+                                  .arg(moduleFile.parseTime)
+                                  .arg(timer.elapsed());
+
+        retval.append(moduleFile.package.release());
     }
 
     return retval;
@@ -742,6 +911,66 @@ GtProject::saveModuleData()
             continue;
         }
 
+        QString filename = m_path + QDir::separator() + mid.toLower() + "." +
+                           moduleExtension();
+
+        const bool withLinkedFiles =
+            getProjectSettings().ownObjectFileSerializationEnabled();
+
+        // unchanged packages do not have to be serialized again
+        if (m_savedModules.contains(mid) &&
+            m_savedModules.value(mid) == withLinkedFiles &&
+            isUnchanged(*package) && QFile::exists(filename))
+        {
+            gtDebug().medium().noquote()
+                    << tr("module data unchanged, skipping")
+                    << QStringLiteral("\"") + mid + QStringLiteral("\"");
+
+            if (!package->saveMiscData(QDir(m_path)))
+            {
+                gtWarning().noquote()
+                        << tr("Failed to save module data!")
+                        << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+            }
+            continue;
+        }
+
+        // the file is out of sync until it is saved successfully
+        m_savedModules.remove(mid);
+
+        const QString baseDir = QDir(m_path).absolutePath();
+
+        // stream the objects into the module file without a DOM document
+        if (!withLinkedFiles && package->supportsMementoData())
+        {
+            QVector<GtObjectMemento> objects;
+
+            if (!package->saveMementoData(objects) ||
+                !package->saveMiscData(QDir(m_path)))
+            {
+                gtWarning().noquote()
+                        << tr("Failed to save module data!")
+                        << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+                continue;
+            }
+
+            QString error;
+            if (!gt::xml::saveModuleXmlFromMementos(filename, package->uuid(),
+                                                    std::move(objects),
+                                                    &error))
+            {
+                gtError() << error;
+                gtWarning() << "\t |->" << mid;
+
+                updateLinkedFileLocations(*package, {}, {});
+                continue;
+            }
+
+            updateLinkedFileLocations(*package, {}, baseDir);
+            m_savedModules.insert(mid, withLinkedFiles);
+            continue;
+        }
+
         QDomDocument document;
         QDomProcessingInstruction header = document.createProcessingInstruction(
                 QStringLiteral("xml"),
@@ -763,14 +992,26 @@ GtProject::saveModuleData()
             continue;
         }
 
-        QString filename = m_path + QDir::separator() + mid.toLower() + "." +
-                           moduleExtension();
+        // linked files of unchanged objects are kept
+        if (withLinkedFiles)
+        {
+            replaceUnchangedLinkedObjects(*package, rootElement);
+        }
+
+        QHash<QString, QString> linkedFiles;
 
-        if (!saveProjectFiles(filename, document))
+        if (!GtProjectIO::saveProjectFiles(filename, document,
+                                           withLinkedFiles, &linkedFiles))
         {
             gtWarning() << "\t |->" << mid;
+
+            // the changes are not saved, the linked files are outdated
+            updateLinkedFileLocations(*package, {}, {});
             continue;
         }
+
+        updateLinkedFileLocations(*package, linkedFiles, baseDir);
+        m_savedModules.insert(mid, withLinkedFiles);
     }
 
     return true;
@@ -845,6 +1086,8 @@ GtProject::saveExternalizedObjectData()
     {
         gtDebug() << "Internalizing object data...";
 
+        GtExternalizationManager::Batch batch;
+
         int counter = 0;
         for (auto* obj : qAsConst(objects))
         {
@@ -865,17 +1108,14 @@ GtProject::saveExternalizedObjectData()
 
     gtDebug() << "Saving externalized object data...";
 
-    for (auto* obj : qAsConst(objects))
-    {
-        // only externalize the object if its not referenced as the data wont be
-        // cleared otherwise and will be saved as memento
-        if (obj->refCount() == 0)
-        {
-            success &= obj->externalize();
-        }
-    }
+    // only externalize the object if its not referenced as the data wont be
+    // cleared otherwise and will be saved as memento
+    objects.erase(std::remove_if(objects.begin(), objects.end(),
+                                 [](GtExternalizedObject const* obj){
+        return obj->refCount() != 0;
+    }), objects.end());
 
-    return success;
+    return gtExternalizationManager->externalize(std::move(objects));
 }
 
 bool
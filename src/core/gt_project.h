@@ -14,6 +14,7 @@
 #include "gt_core_exports.h"
 
 #include <QStringList>
+#include <QHash>
 
 #include "gt_object.h"
 #include "gt_session.h"
@@ -334,6 +335,10 @@ private:
     /// User definable comment
     QString m_comment;
 
+    /// Modules whose files are in sync with their packages and whether the
+    /// files were saved with linked object files
+    QHash<QString, bool> m_savedModules;
+
     /**
      * @brief loadMetaData
      * @return success
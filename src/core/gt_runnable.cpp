@@ -20,6 +20,36 @@
 #include "gt_project.h"
 #include "gt_logging.h"
 
+#include <algorithm>
+
+namespace
+{
+
+/**
+ * @brief Collects the top most objects of the given subtree, which were
+ * changed (or created) since the changes were accepted the last time.
+ * @param obj Root of the subtree
+ * @param list Changed objects
+ */
+void
+collectChangedObjects(GtObject* obj, QList<GtObject*>& list)
+{
+    if (obj->hasChanges() || obj->newlyCreated())
+    {
+        list.append(obj);
+        return;
+    }
+
+    if (!obj->hasChildChanged()) return;
+
+    for (GtObject* child : obj->findDirectChildren())
+    {
+        collectChangedObjects(child, list);
+    }
+}
+
+} // namespace
+
 GtRunnable::GtRunnable(QString projectPath) :
     m_projectPath{std::move(projectPath)}
 {
@@ -148,6 +178,8 @@ GtRunnable::readObjects()
 
         if (obj)
         {
+            // changes are tracked from here on
+            obj->acceptChangesRecursively();
             m_linkedObjects.append(obj);
         }
     }
@@ -156,8 +188,60 @@ GtRunnable::readObjects()
 void
 GtRunnable::writeObjects()
 {
+    // process components requiring the full source data may access objects
+    // in ways that are not tracked. Write back all objects for them
+    bool const full = std::any_of(m_queue.begin(), m_queue.end(),
+                                  [](GtProcessComponent* pc) {
+        auto const childs = pc->findChildren<GtProcessComponent*>();
+
+        return pc->requiresFullSourceData() ||
+               std::any_of(childs.begin(), childs.end(),
+                           [](GtProcessComponent const* child) {
+            return child->requiresFullSourceData();
+        });
+    });
+
     for (GtObject* obj : qAsConst(m_linkedObjects))
     {
-        m_outputData << GtObjectMemento(obj);
+        QList<GtObject*> subtrees;
+
+        auto iter = m_partialInputData.constFind(obj->uuid());
+
+        if (iter == m_partialInputData.constEnd())
+        {
+            subtrees.append(obj);
+        }
+        else
+        {
+            // partial snapshot. only the complete subtrees are written back
+            for (QString const& uuid : iter.value())
+            {
+                if (GtObject* subtree = obj->getObjectByUuid(uuid))
+                {
+                    subtrees.append(subtree);
+                }
+            }
+        }
+
+        for (GtObject* subtree : qAsConst(subtrees))
+        {
+            if (full)
+            {
+                m_outputData << GtObjectMemento(subtree);
+                continue;
+            }
+
+            // only the changed parts of the subtree are written back
+            QList<GtObject*> changed;
+            collectChangedObjects(subtree, changed);
+
+            for (GtObject* changedObj : qAsConst(changed))
+            {
+                m_outputData << GtObjectMemento(changedObj);
+            }
+        }
     }
+
+    gtDebug().medium() << tr("%1 changed object(s) written back")
+                              .arg(m_outputData.size());
 }
@@ -10,12 +10,470 @@
 
 #include "gt_treefiltermodel.h"
 
+#include <QHash>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+using FilterRegExp = QRegExp;
+#else
+using FilterRegExp = QRegularExpression;
+#endif
+
+/// Minimum number of keys matched by one job
+constexpr int minKeysPerJob = 4096;
+
+/// Entry of the search index
+struct Node
+{
+    /// Internal pointer of the source index. Null, if the row was removed
+    const void* ptr;
+    /// Position of the parent node, -1 for top level rows
+    int parent;
+    /// Filter key of the row
+    QString key;
+    /// Whether the key matches the filter
+    bool match;
+    /// Number of matching rows in the subtree including this row
+    int count;
+};
+
+FilterRegExp
+currentFilter(const QSortFilterProxyModel& model)
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    return model.filterRegExp();
+#else
+    return model.filterRegularExpression();
+#endif
+}
+
+/// Returns true, if the pattern has no special characters
+bool
+isLiteral(const QString& pattern)
+{
+    static const QString special = QStringLiteral("\\^$.|?*+()[]{}");
+
+    return std::none_of(pattern.begin(), pattern.end(), [](QChar c) {
+        return special.contains(c);
+    });
+}
+
+/**
+ * @brief Returns true, if each key matching the next filter also matches the
+ * previous filter. This is the case if the pattern was extended while typing.
+ * @param prev Previous filter
+ * @param next Next filter
+ * @return Whether the matches of the next filter are a subset of the
+ * previous matches
+ */
+bool
+narrows(const FilterRegExp& prev, const FilterRegExp& next)
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    if (prev.patternSyntax() != next.patternSyntax() ||
+        prev.caseSensitivity() != next.caseSensitivity())
+    {
+        return false;
+    }
+    auto const cs = prev.caseSensitivity();
+#else
+    if (prev.patternOptions() != next.patternOptions())
+    {
+        return false;
+    }
+    auto const cs = prev.patternOptions() &
+                    QRegularExpression::CaseInsensitiveOption ?
+                        Qt::CaseInsensitive : Qt::CaseSensitive;
+#endif
+
+    return !prev.pattern().isEmpty() &&
+           isLiteral(prev.pattern()) && isLiteral(next.pattern()) &&
+           next.pattern().contains(prev.pattern(), cs);
+}
+
+/// Job matching a range of the search index
+class MatchJob : public QRunnable
+{
+public:
+    MatchJob(std::vector<Node>& nodes, int begin, int end,
+             FilterRegExp regExp, bool onlyMatches) :
+        m_nodes(nodes),
+        m_begin(begin),
+        m_end(end),
+        m_regExp(std::move(regExp)),
+        m_onlyMatches(onlyMatches)
+    { }
+
+    void run() override
+    {
+        for (int i = m_begin; i < m_end; ++i)
+        {
+            Node& node = m_nodes[i];
+
+            if (!node.ptr || (m_onlyMatches && !node.match)) continue;
+
+            node.match = node.key.contains(m_regExp);
+        }
+    }
+
+private:
+    std::vector<Node>& m_nodes;
+
+    int m_begin, m_end;
+
+    /// each job uses its own copy, as QRegExp is not thread-safe
+    FilterRegExp m_regExp;
+
+    bool m_onlyMatches;
+};
+
+} // namespace
+
+struct GtTreeFilterModel::Impl
+{
+    /// Rows of the source model. Parents are stored before their children
+    std::vector<Node> nodes;
+
+    /// Positions of the rows by their internal pointers
+    QHash<const void*, int> positions;
+
+    /// Number of removed nodes
+    int removed{0};
+
+    /// Whether the index has to be rebuilt
+    bool dirty{true};
+
+    /// False, if the internal pointers do not identify the rows uniquely
+    bool usable{true};
+
+    /// Filter role and key column the index was built for
+    int role{-1}, column{-1};
+
+    /// Filter the nodes were matched against
+    FilterRegExp regExp;
+
+    /// Whether the nodes were matched against regExp
+    bool matched{false};
+
+    /// Connections to the source model
+    QList<QMetaObject::Connection> connections;
+
+    void invalidate()
+    {
+        nodes.clear();
+        positions.clear();
+        removed = 0;
+        dirty = true;
+        usable = true;
+        matched = false;
+    }
+
+    /// Returns the position of the row or -1 if it is not indexed
+    int position(const QModelIndex& index) const
+    {
+        if (!usable || !index.isValid()) return -1;
+
+        return positions.value(index.internalPointer(), -1);
+    }
+
+    /// Adds the given rows and their children to the index
+    void addRows(const QAbstractItemModel& model, const QModelIndex& parent,
+                 int first, int last, int parentPos)
+    {
+        struct Row
+        {
+            QModelIndex parent;
+            int row;
+            int parentPos;
+        };
+
+        std::vector<Row> stack;
+        for (int row = last; row >= first; --row)
+        {
+            stack.push_back({parent, row, parentPos});
+        }
+
+        while (!stack.empty())
+        {
+            Row r = stack.back();
+            stack.pop_back();
+
+            QModelIndex index = model.index(r.row, column, r.parent);
+            if (!index.isValid()) continue;
+
+            const void* ptr = index.internalPointer();
+            if (!ptr || positions.contains(ptr))
+            {
+                usable = false;
+                continue;
+            }
+
+            int const pos = static_cast<int>(nodes.size());
+            nodes.push_back({ptr, r.parentPos,
+                             model.data(index, role).toString(), false, 0});
+            positions.insert(ptr, pos);
+
+            for (int row = model.rowCount(index) - 1; row >= 0; --row)
+            {
+                stack.push_back({index, row, pos});
+            }
+        }
+    }
+
+    /// Adds the count to the given node and its ancestors
+    void addCount(int pos, int count)
+    {
+        if (count == 0) return;
+
+        for (; pos >= 0; pos = nodes[pos].parent)
+        {
+            nodes[pos].count += count;
+        }
+    }
+
+    /// Matches the nodes against the filter and updates the counts
+    void match(const FilterRegExp& filter)
+    {
+        bool const onlyMatches = matched && narrows(regExp, filter);
+
+        int const n = static_cast<int>(nodes.size());
+        int const nJobs = std::min(std::max(n / minKeysPerJob, 1),
+                                   QThread::idealThreadCount());
+
+        if (nJobs < 2)
+        {
+            MatchJob(nodes, 0, n, filter, onlyMatches).run();
+        }
+        else
+        {
+            QThreadPool pool;
+            int const chunk = (n + nJobs - 1) / nJobs;
+            for (int begin = 0; begin < n; begin += chunk)
+            {
+                int const end = std::min(begin + chunk, n);
+                pool.start(new MatchJob(nodes, begin, end,
+                                        filter, onlyMatches));
+            }
+            pool.waitForDone();
+        }
+
+        // children are stored behind their parents
+        for (Node& node : nodes)
+        {
+            node.count = node.ptr && node.match ? 1 : 0;
+        }
+        for (int i = n - 1; i >= 0; --i)
+        {
+            Node const& node = nodes[i];
+            if (node.ptr && node.parent >= 0)
+            {
+                nodes[node.parent].count += node.count;
+            }
+        }
+
+        regExp = filter;
+        matched = true;
+    }
+
+    /// Builds the index and matches it against the filter, if necessary
+    void update(const QAbstractItemModel& model, const FilterRegExp& filter,
+                int filterRole, int filterColumn)
+    {
+        if (dirty || role != filterRole || column != filterColumn)
+        {
+            invalidate();
+            role = filterRole;
+            column = filterColumn;
+            addRows(model, {}, 0, model.rowCount() - 1, -1);
+            dirty = false;
+        }
+
+        if (!matched || !(regExp == filter))
+        {
+            match(filter);
+        }
+    }
+
+    void onRowsInserted(const QAbstractItemModel& model,
+                        const QModelIndex& parent, int first, int last)
+    {
+        if (dirty) return;
+
+        int const parentPos = position(parent);
+        if (parent.isValid() && parentPos < 0)
+        {
+            dirty = true;
+            return;
+        }
+
+        int const begin = static_cast<int>(nodes.size());
+        addRows(model, parent, first, last, parentPos);
+
+        if (!matched) return;
+
+        int const end = static_cast<int>(nodes.size());
+        for (int i = begin; i < end; ++i)
+        {
+            Node& node = nodes[i];
+            node.match = node.key.contains(regExp);
+            node.count = node.match ? 1 : 0;
+        }
+        for (int i = end - 1; i >= begin; --i)
+        {
+            Node const& node = nodes[i];
+            if (node.parent >= begin)
+            {
+                nodes[node.parent].count += node.count;
+            }
+            else
+            {
+                addCount(node.parent, node.count);
+            }
+        }
+    }
+
+    void onRowsAboutToBeRemoved(const QAbstractItemModel& model,
+                                const QModelIndex& parent, int first, int last)
+    {
+        if (dirty) return;
+
+        for (int row = first; row <= last; ++row)
+        {
+            int const pos = position(model.index(row, column, parent));
+            if (pos < 0) continue;
+
+            addCount(nodes[pos].parent, -nodes[pos].count);
+
+            // remove the subtree
+            std::vector<QModelIndex> stack{model.index(row, column, parent)};
+            while (!stack.empty())
+            {
+                QModelIndex index = stack.back();
+                stack.pop_back();
+
+                auto iter = positions.find(index.internalPointer());
+                if (iter == positions.end()) continue;
+
+                Node& node = nodes[*iter];
+                node.ptr = nullptr;
+                node.key.clear();
+                positions.erase(iter);
+                ++removed;
+
+                for (int r = 0; r < model.rowCount(index); ++r)
+                {
+                    stack.push_back(model.index(r, column, index));
+                }
+            }
+        }
+
+        // rebuild the index once most of it was removed
+        if (removed > static_cast<int>(nodes.size()) / 2)
+        {
+            dirty = true;
+        }
+    }
+
+    void onDataChanged(const QAbstractItemModel& model,
+                       const QModelIndex& topLeft,
+                       const QModelIndex& bottomRight)
+    {
+        if (dirty) return;
+
+        QModelIndex const parent = topLeft.parent();
+
+        for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+        {
+            QModelIndex index = model.index(row, column, parent);
+
+            int const pos = position(index);
+            if (pos < 0) continue;
+
+            Node& node = nodes[pos];
+
+            QString key = model.data(index, role).toString();
+            if (key == node.key) continue;
+
+            node.key = std::move(key);
+
+            if (!matched) continue;
+
+            bool const match = node.key.contains(regExp);
+            if (match != node.match)
+            {
+                node.match = match;
+                addCount(pos, match ? 1 : -1);
+            }
+        }
+    }
+};
+
 GtTreeFilterModel::GtTreeFilterModel(QObject* parent) :
-    QSortFilterProxyModel(parent)
+    QSortFilterProxyModel(parent),
+    pimpl(std::make_unique<Impl>())
 {
     setFilterCaseSensitivity(Qt::CaseInsensitive);
 }
 
+GtTreeFilterModel::~GtTreeFilterModel() = default;
+
+void
+GtTreeFilterModel::setSourceModel(QAbstractItemModel* sourceModel)
+{
+    for (auto const& connection : qAsConst(pimpl->connections))
+    {
+        disconnect(connection);
+    }
+    pimpl->connections.clear();
+    pimpl->invalidate();
+
+    if (!sourceModel)
+    {
+        QSortFilterProxyModel::setSourceModel(sourceModel);
+        return;
+    }
+
+    auto& c = pimpl->connections;
+    Impl* d = pimpl.get();
+
+    c << connect(sourceModel, &QAbstractItemModel::rowsInserted, this,
+                 [d, sourceModel](const QModelIndex& parent,
+                                  int first, int last) {
+        d->onRowsInserted(*sourceModel, parent, first, last);
+    });
+    c << connect(sourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+                 [d, sourceModel](const QModelIndex& parent,
+                                  int first, int last) {
+        d->onRowsAboutToBeRemoved(*sourceModel, parent, first, last);
+    });
+    c << connect(sourceModel, &QAbstractItemModel::dataChanged, this,
+                 [d, sourceModel](const QModelIndex& topLeft,
+                                  const QModelIndex& bottomRight) {
+        d->onDataChanged(*sourceModel, topLeft, bottomRight);
+    });
+
+    // the index is rebuilt with the next lookup
+    auto invalidateIndex = [d]() { d->invalidate(); };
+    c << connect(sourceModel, &QAbstractItemModel::modelAboutToBeReset,
+                 this, invalidateIndex);
+    c << connect(sourceModel, &QAbstractItemModel::layoutAboutToBeChanged,
+                 this, invalidateIndex);
+    c << connect(sourceModel, &QAbstractItemModel::rowsAboutToBeMoved,
+                 this, invalidateIndex);
+
+    // connected afterwards, thus the index is up to date once the base class
+    // filters inserted or changed rows
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
 void
 GtTreeFilterModel::filterData(const QString& val)
 {
@@ -41,6 +499,22 @@ GtTreeFilterModel::filterAcceptsRow(int source_row,
         return QSortFilterProxyModel::filterAcceptsRow(source_row, source_parent);
     }
 
+    QModelIndex source_index =
+        sourceModel()->index(source_row, filterKeyColumn(), source_parent);
+
+    if (!source_index.isValid()) return false;
+
+    pimpl->update(*sourceModel(), currentFilter(*this),
+                  filterRole(), filterKeyColumn());
+
+    int const pos = pimpl->position(source_index);
+    if (pos >= 0)
+    {
+        // any row of the subtree matches
+        return pimpl->nodes[pos].count > 0;
+    }
+
+    // row is not indexed yet
     return filterAcceptsRow(source_row, source_parent, [](const GtObject*)
     {
         return true;
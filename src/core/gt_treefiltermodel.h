@@ -16,8 +16,18 @@
 #include <QSortFilterProxyModel>
 #include <gt_object.h>
 
+#include <memory>
+
 /**
  * @brief The GtTreeFilterModel class
+ *
+ * A row is accepted if its key or the key of any of its descendants matches
+ * the filter. To avoid walking the subtree for every row, the keys of the
+ * source model are collected in an index once a filter is set. The index
+ * stores for each row the number of matching rows in its subtree and is kept
+ * up to date if rows are inserted, removed or changed. Thus, filtering is a
+ * lookup per row. The keys are matched in parallel and, if the pattern was
+ * only extended, only the previous matches are tested again.
  */
 class GT_CORE_EXPORT GtTreeFilterModel : public QSortFilterProxyModel
 {
@@ -26,8 +36,17 @@ class GT_CORE_EXPORT GtTreeFilterModel : public QSortFilterProxyModel
 public:
     explicit GtTreeFilterModel(QObject* parent = nullptr);
 
+    ~GtTreeFilterModel() override;
+
     void setRootIndex(const QModelIndex& index);
 
+    /**
+     * @brief Reimplemented from QSortFilterProxyModel. Keeps the search index
+     * of the source model up to date.
+     * @param sourceModel Source model
+     */
+    void setSourceModel(QAbstractItemModel* sourceModel) override;
+
 public slots:
     /**
      * @brief filterData
@@ -94,6 +113,10 @@ protected:
         return false;
     }
 
+private:
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
 };
 
 #endif // GTTREEFILTERMODEL_H
@@ -0,0 +1,240 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_externalizationprefetcher.h"
+
+#include "gt_externalizationmanager.h"
+#include "gt_externalizedobject.h"
+#include "gt_isolatedprocessrun.h"
+#include "gt_logging.h"
+
+#include <QPointer>
+#include <QRunnable>
+#include <QSet>
+#include <QThreadPool>
+#include <QVector>
+
+#include <algorithm>
+
+namespace
+{
+
+/// Reads the data of externalized objects into buffers in a thread pool. The
+/// objects are not modified, they are fetched from the buffers in their own
+/// thread using `commit`
+class ReadJob : public QRunnable
+{
+public:
+    explicit ReadJob(QList<GtExternalizedObject*> const& objects)
+    {
+        setAutoDelete(false);
+
+        for (GtExternalizedObject* obj : objects) m_objects.append(obj);
+    }
+
+    void run() override
+    {
+        QList<GtExternalizedObject*> objects;
+        for (auto const& obj : qAsConst(m_objects)) objects.append(obj.data());
+
+        m_buffers = gtExternalizationManager->readData(objects);
+    }
+
+    /// Fetches the objects from the buffers. Must be called in the thread of
+    /// the objects once the job is done
+    void commit()
+    {
+        QList<GtExternalizedObject*> objects;
+        for (auto const& obj : qAsConst(m_objects)) objects.append(obj.data());
+
+        m_buffers.resize(objects.size());
+
+        if (!gtExternalizationManager->fetch(objects, std::move(m_buffers)))
+        {
+            gtWarning() << QObject::tr("Prefetching externalized data failed");
+        }
+    }
+
+private:
+    QList<QPointer<GtExternalizedObject>> m_objects;
+    QVector<QVariant> m_buffers;
+};
+
+} // namespace
+
+struct GtExternalizationPrefetcher::Impl
+{
+    /// Externalized objects of each step. The objects may be deleted by the
+    /// previous steps
+    QList<QList<QPointer<GtExternalizedObject>>> steps;
+
+    /// Objects that were fetched for each step and must be released
+    QVector<QList<QPointer<GtExternalizedObject>>> prefetched;
+
+    /// Number of steps to prefetch in advance
+    int window;
+
+    /// Steps before this index were scheduled already
+    int scheduled{0};
+
+    /// Read job, that was not committed yet
+    std::unique_ptr<ReadJob> job;
+
+    /// Background I/O thread
+    QThreadPool pool;
+
+    /// Returns whether the fetched data exceeds the memory budget
+    bool budgetExceeded() const
+    {
+        auto const stats = gtExternalizationManager->memoryStatistics();
+        return stats.budget > 0 && stats.fetchedSize >= stats.budget;
+    }
+
+    /// Releases the data prefetched for the step
+    void release(int idx)
+    {
+        for (auto const& obj : qAsConst(prefetched[idx]))
+        {
+            if (obj) gtExternalizationManager->release({obj.data()});
+        }
+        prefetched[idx].clear();
+    }
+};
+
+GtExternalizationPrefetcher::GtExternalizationPrefetcher(
+        QList<QList<GtExternalizedObject*>> const& steps, int window) :
+    pimpl(std::make_unique<Impl>())
+{
+    for (auto const& step : steps)
+    {
+        QList<QPointer<GtExternalizedObject>> objects;
+        for (GtExternalizedObject* obj : step) objects.append(obj);
+
+        pimpl->steps.append(objects);
+    }
+    pimpl->prefetched.resize(steps.size());
+    pimpl->window = window;
+
+    // a single thread serializes the file access
+    pimpl->pool.setMaxThreadCount(1);
+}
+
+GtExternalizationPrefetcher::~GtExternalizationPrefetcher()
+{
+    // the read data is committed first, thus all prefetched objects are
+    // fetched and can be released
+    wait();
+
+    for (int i = 0; i < pimpl->prefetched.size(); ++i)
+    {
+        pimpl->release(i);
+    }
+}
+
+int
+GtExternalizationPrefetcher::defaultWindow()
+{
+    bool ok = false;
+    int const window =
+        qEnvironmentVariableIntValue("GTLAB_EXTERNALIZATION_PREFETCH_WINDOW",
+                                     &ok);
+    return ok ? window : 2;
+}
+
+void
+GtExternalizationPrefetcher::beginStep(int idx)
+{
+    // the objects of the step may be accessed only once they were fetched
+    wait();
+
+    if (pimpl->window < 1 || idx < 0 || idx >= pimpl->steps.size()) return;
+
+    // objects of the current step are not touched in the background
+    QSet<GtExternalizedObject*> inUse;
+    for (auto const& obj : qAsConst(pimpl->steps[idx]))
+    {
+        if (obj) inUse.insert(obj.data());
+    }
+
+    int const end = std::min(idx + 1 + pimpl->window,
+                             static_cast<int>(pimpl->steps.size()));
+
+    QList<GtExternalizedObject*> toFetch;
+
+    for (int j = std::max(pimpl->scheduled, idx + 1); j < end; ++j)
+    {
+        if (pimpl->budgetExceeded()) break;
+
+        for (auto const& ptr : qAsConst(pimpl->steps[j]))
+        {
+            GtExternalizedObject* obj = ptr.data();
+
+            // deleted objects are skipped
+            if (!obj || inUse.contains(obj)) continue;
+
+            pimpl->prefetched[j].append(obj);
+
+            // fetched data only has to be retained
+            if (obj->isFetched()) gtExternalizationManager->fetch({obj});
+            else toFetch.append(obj);
+        }
+
+        pimpl->scheduled = j + 1;
+    }
+
+    if (toFetch.isEmpty()) return;
+
+    gtDebug().medium() << QObject::tr("Prefetching %1 externalized object(s)")
+                              .arg(toFetch.size());
+
+    pimpl->job = std::make_unique<ReadJob>(toFetch);
+    pimpl->pool.start(pimpl->job.get());
+}
+
+void
+GtExternalizationPrefetcher::endStep(int idx)
+{
+    if (idx < 0 || idx >= pimpl->prefetched.size()) return;
+
+    // the background thread does not access the objects of the step
+    pimpl->release(idx);
+}
+
+void
+GtExternalizationPrefetcher::wait()
+{
+    pimpl->pool.waitForDone();
+
+    // the objects are only modified in their own thread
+    if (auto job = std::move(pimpl->job)) job->commit();
+}
+
+QList<GtExternalizedObject*>
+GtExternalizationPrefetcher::externalizedObjects(
+        GtProcessComponent& component, GtAbstractRunnable& runnable)
+{
+    QList<GtExternalizedObject*> objects;
+
+    auto append = [&objects](GtExternalizedObject* obj) {
+        if (!objects.contains(obj)) objects.append(obj);
+    };
+
+    for (GtObject* obj :
+         GtIsolatedProcessRun::linkedObjects(component, runnable))
+    {
+        if (auto* ext = qobject_cast<GtExternalizedObject*>(obj))
+        {
+            append(ext);
+        }
+
+        for (auto* ext : obj->findChildren<GtExternalizedObject*>())
+        {
+            append(ext);
+        }
+    }
+
+    return objects;
+}
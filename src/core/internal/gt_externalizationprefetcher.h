@@ -0,0 +1,106 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTEXTERNALIZATIONPREFETCHER_H
+#define GTEXTERNALIZATIONPREFETCHER_H
+
+#include "gt_core_exports.h"
+
+#include <QList>
+
+#include <memory>
+
+class GtExternalizedObject;
+class GtProcessComponent;
+class GtAbstractRunnable;
+
+/**
+ * @brief Reads the externalized data of queued process steps in a
+ * background thread, while the previous steps are still executed.
+ *
+ * Only the steps within the prefetch window following the current step are
+ * prefetched. As externalized objects are not thread-safe, the background
+ * thread only reads the data into buffers (see
+ * GtExternalizationManager::readData). The objects are fetched from these
+ * buffers in their own thread once the next step begins. Objects that cannot
+ * read their data into a buffer are fetched at this point as well. The data
+ * of a prefetched step stays fetched until the step is ended. Objects
+ * accessed by the current step are never touched by the background thread,
+ * they are fetched by the step itself instead. No further steps are
+ * scheduled while the fetched data exceeds the memory budget of the
+ * externalization manager.
+ *
+ * All methods must be called in the thread of the externalized objects.
+ */
+class GT_CORE_EXPORT GtExternalizationPrefetcher
+{
+public:
+    /**
+     * @brief Constructor
+     * @param steps Externalized objects accessed by each step in the order
+     * of execution
+     * @param window Number of steps to prefetch in advance. Prefetching is
+     * disabled for values smaller than 1.
+     */
+    explicit GtExternalizationPrefetcher(
+            QList<QList<GtExternalizedObject*>> const& steps,
+            int window = defaultWindow());
+
+    /**
+     * @brief Waits for the background thread and releases all prefetched
+     * data.
+     */
+    ~GtExternalizationPrefetcher();
+
+    GtExternalizationPrefetcher(GtExternalizationPrefetcher const&) = delete;
+    GtExternalizationPrefetcher&
+    operator=(GtExternalizationPrefetcher const&) = delete;
+
+    /**
+     * @brief Returns the default prefetch window. May be set using the
+     * environment variable GTLAB_EXTERNALIZATION_PREFETCH_WINDOW.
+     * @return Default prefetch window
+     */
+    static int defaultWindow();
+
+    /**
+     * @brief Must be called before the step is executed. Waits until the
+     * data of the step was read, fetches the read objects and starts
+     * prefetching the data of the following steps within the window.
+     * @param idx Index of the step
+     */
+    void beginStep(int idx);
+
+    /**
+     * @brief Must be called after the step was executed. Releases the data
+     * prefetched for the step.
+     * @param idx Index of the step
+     */
+    void endStep(int idx);
+
+    /**
+     * @brief Waits until all scheduled data was read and fetches the read
+     * objects.
+     */
+    void wait();
+
+    /**
+     * @brief Returns the externalized objects linked by the process
+     * component (and its child components) including all externalized
+     * children of the linked objects.
+     * @param component Process component
+     * @param runnable Runnable holding the linked objects
+     * @return Externalized objects
+     */
+    static QList<GtExternalizedObject*> externalizedObjects(
+            GtProcessComponent& component, GtAbstractRunnable& runnable);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+};
+
+#endif // GTEXTERNALIZATIONPREFETCHER_H
@@ -0,0 +1,567 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_isolatedprocessrun.h"
+#include "gt_processlinks.h"
+
+#include "gt_abstractrunnable.h"
+#include "gt_processcomponent.h"
+#include "gt_propertyconnection.h"
+#include "gt_task.h"
+#include "gt_processfactory.h"
+#include "gt_objectfactory.h"
+#include "gt_objectmemento.h"
+#include "gt_objectpath.h"
+#include "gt_typedmementodiff.h"
+#include "gt_logging.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMap>
+#include <QPointer>
+
+#include <algorithm>
+
+namespace
+{
+
+/**
+ * @brief Runnable used as parent of the copied process components. Provides
+ * the copied linked objects and forwards all other requests to the original
+ * runnable.
+ */
+class IsolatedRunnable : public GtAbstractRunnable
+{
+public:
+    explicit IsolatedRunnable(GtAbstractRunnable& parent) :
+        m_parent(parent)
+    { }
+
+    void run() override
+    {
+        // nothing to do here
+    }
+
+    QDir tempDir() override
+    {
+        return m_parent.tempDir();
+    }
+
+    bool clearTempDir(const QString& path) override
+    {
+        return m_parent.clearTempDir(path);
+    }
+
+    QString projectPath() override
+    {
+        return m_parent.projectPath();
+    }
+
+    void appendLinkedObject(GtObject* obj)
+    {
+        m_linkedObjects.append(obj);
+    }
+
+private:
+    GtAbstractRunnable& m_parent;
+};
+
+/// Returns true if obj is a (grand) child of parent
+bool
+isChildOf(GtObject const* obj, GtObject const* parent)
+{
+    for (obj = obj->parentObject(); obj; obj = obj->parentObject())
+    {
+        if (obj == parent) return true;
+    }
+    return false;
+}
+
+using PropertyData = GtObjectMemento::PropertyData;
+
+/// Returns true if both properties hold the same values
+bool
+equalProperties(PropertyData const& a, PropertyData const& b)
+{
+    if (a.name != b.name || a.isActive != b.isActive ||
+        a.dataType() != b.dataType() || a.data() != b.data() ||
+        a.childProperties.size() != b.childProperties.size())
+    {
+        return false;
+    }
+
+    return std::equal(a.childProperties.begin(), a.childProperties.end(),
+                      b.childProperties.begin(), equalProperties);
+}
+
+/// Overwrites the merged properties with the properties, that were changed
+/// from base to mine
+void
+rebaseProperties(QVector<PropertyData> const& base,
+                 QVector<PropertyData> const& mine,
+                 QVector<PropertyData>& merged)
+{
+    for (PropertyData const& prop : mine)
+    {
+        PropertyData const* old =
+            GtObjectMemento::findPropertyByName(base, prop.name);
+
+        if (old && equalProperties(*old, prop)) continue;
+
+        auto iter = std::find_if(merged.begin(), merged.end(),
+                                 [&prop](PropertyData const& p) {
+            return p.name == prop.name;
+        });
+
+        if (iter != merged.end()) *iter = prop;
+        else merged.append(prop);
+    }
+}
+
+/// Returns the index of the child with the given uuid or -1
+int
+indexOfChild(QVector<GtObjectMemento> const& children, QString const& uuid)
+{
+    auto iter = std::find_if(children.begin(), children.end(),
+                             [&uuid](GtObjectMemento const& child) {
+        return child.uuid() == uuid;
+    });
+
+    return iter != children.end() ? int(iter - children.begin()) : -1;
+}
+
+/**
+ * @brief Applies the changes from base to mine onto the merged state of
+ * other isolated runs, which started from the same base.
+ *
+ * Changed properties overwrite the merged values. Removed objects are
+ * removed, if they still exist. Added objects are appended, unless another
+ * run already added an object with the same name and class. In that case,
+ * the added object is merged into the existing one, as it would have been
+ * found when running one after another.
+ * The hashes of base and mine must be calculated, merged must not hold any
+ * hashes, since they become stale.
+ * @param base State before the run
+ * @param mine State after the run
+ * @param merged Merged state to update
+ */
+void
+rebase(GtObjectMemento const& base, GtObjectMemento const& mine,
+       GtObjectMemento& merged)
+{
+    if (mine.ident() != base.ident()) merged.setIdent(mine.ident());
+
+    rebaseProperties(base.properties, mine.properties, merged.properties);
+    rebaseProperties(base.propertyContainers, mine.propertyContainers,
+                     merged.propertyContainers);
+
+    // removed and changed objects
+    for (GtObjectMemento const& old : qAsConst(base.childObjects))
+    {
+        int const mineIdx = indexOfChild(mine.childObjects, old.uuid());
+        int const mergedIdx = indexOfChild(merged.childObjects, old.uuid());
+
+        bool const changed =
+            mineIdx >= 0 &&
+            old.fullHash() != mine.childObjects[mineIdx].fullHash();
+
+        if (mergedIdx < 0)
+        {
+            if (changed)
+            {
+                gtWarning() << QObject::tr("Changes of '%1' were dropped, "
+                                           "the object was removed by "
+                                           "another run!")
+                                   .arg(old.ident());
+            }
+            continue;
+        }
+
+        if (mineIdx < 0)
+        {
+            merged.childObjects.remove(mergedIdx);
+        }
+        else if (changed)
+        {
+            rebase(old, mine.childObjects[mineIdx],
+                   merged.childObjects[mergedIdx]);
+        }
+    }
+
+    // added objects
+    for (GtObjectMemento const& child : qAsConst(mine.childObjects))
+    {
+        if (indexOfChild(base.childObjects, child.uuid()) >= 0) continue;
+
+        auto iter = std::find_if(merged.childObjects.begin(),
+                                 merged.childObjects.end(),
+                                 [&](GtObjectMemento const& other) {
+            return other.uuid() == child.uuid() ||
+                   (other.ident() == child.ident() &&
+                    other.className() == child.className() &&
+                    indexOfChild(base.childObjects, other.uuid()) < 0 &&
+                    indexOfChild(mine.childObjects, other.uuid()) < 0);
+        });
+
+        if (iter == merged.childObjects.end())
+        {
+            merged.childObjects.append(child);
+        }
+        else
+        {
+            rebase(GtObjectMemento(), child, *iter);
+        }
+    }
+}
+
+/**
+ * @brief Returns the diff applying the changes from before to after onto the
+ * target object. If the target was changed since the snapshot was taken,
+ * e.g. by merging another isolated run, the changes are rebased onto its
+ * current state first.
+ * @param target Target object
+ * @param before State before the run
+ * @param after State after the run
+ * @return Diff to apply on the target
+ */
+GtTypedMementoDiff
+rebasedDiff(GtObject const& target, GtObjectMemento const& before,
+            GtObjectMemento const& after)
+{
+    GtObjectMemento const current = target.toMemento();
+    GtObjectMemento merged = target.toMemento();
+
+    current.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+    before.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+    after.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+
+    if (current.fullHash() == before.fullHash())
+    {
+        return GtTypedMementoDiff(before, after);
+    }
+
+    rebase(before, after, merged);
+
+    return GtTypedMementoDiff(current, merged);
+}
+
+} // namespace
+
+struct GtIsolatedProcessRun::Impl
+{
+    /// Name and uuid of a parent object
+    struct Ancestor
+    {
+        QString name;
+        QString uuid;
+    };
+
+    /// Snapshot of a linked object
+    struct LinkedData
+    {
+        /// original object
+        QPointer<GtObject> object;
+        /// parent objects, starting with the root object
+        QList<Ancestor> ancestors;
+        /// state before and after the execution
+        GtObjectMemento before, after;
+    };
+
+    /// Snapshot of a process component
+    struct ComponentData
+    {
+        /// original process component
+        QPointer<GtProcessComponent> component;
+        /// factory to restore the component with
+        GtAbstractObjectFactory* factory;
+        /// state before and after the execution
+        GtObjectMemento before, after;
+        /// property connections of the component stored outside of it
+        QList<GtObjectMemento> connections;
+        /// states of the component and its child components after execution
+        QMap<QString, int> states;
+    };
+
+    /// original runnable
+    GtAbstractRunnable* runnable;
+
+    QList<LinkedData> linked;
+
+    QList<ComponentData> components;
+
+    /// execution time per component
+    QList<qint64> timings;
+};
+
+GtIsolatedProcessRun::GtIsolatedProcessRun(
+        QList<GtProcessComponent*> const& components,
+        GtAbstractRunnable& runnable) :
+    pimpl(std::make_unique<Impl>())
+{
+    pimpl->runnable = &runnable;
+
+    QList<GtObject*> objects;
+
+    for (GtProcessComponent* comp : components)
+    {
+        if (!comp) continue;
+
+        for (GtObject* obj : linkedObjects(*comp, runnable))
+        {
+            if (!objects.contains(obj)) objects.append(obj);
+        }
+
+        GtAbstractObjectFactory* factory = comp->factory();
+        Impl::ComponentData data{comp,
+                                 factory ? factory : gtProcessFactory,
+                                 comp->toMemento(), {}, {}, {}};
+
+        if (GtTask* root = comp->rootTask())
+        {
+            for (GtPropertyConnection* con : root->collectPropertyConnections())
+            {
+                if (isChildOf(con, comp)) continue;
+
+                if (comp->getObjectByUuid(con->sourceUuid()) &&
+                    comp->getObjectByUuid(con->targetUuid()))
+                {
+                    data.connections.append(con->toMemento());
+                }
+            }
+        }
+
+        pimpl->components.append(std::move(data));
+    }
+
+    // only the top most objects have to be copied
+    for (GtObject* obj : qAsConst(objects))
+    {
+        bool const isNested = std::any_of(objects.begin(), objects.end(),
+                                          [obj](GtObject const* other) {
+            return isChildOf(obj, other);
+        });
+
+        if (isNested) continue;
+
+        Impl::LinkedData data;
+        data.object = obj;
+        data.before = obj->toMemento();
+
+        for (GtObject* p = obj->parentObject(); p; p = p->parentObject())
+        {
+            data.ancestors.prepend({p->objectName(), p->uuid()});
+        }
+
+        pimpl->linked.append(std::move(data));
+    }
+}
+
+GtIsolatedProcessRun::~GtIsolatedProcessRun() = default;
+
+bool
+GtIsolatedProcessRun::exec()
+{
+    return exec([](GtProcessComponent& comp) {
+        return comp.exec();
+    });
+}
+
+bool
+GtIsolatedProcessRun::exec(std::function<bool(GtProcessComponent&)> const& run)
+{
+    pimpl->timings.clear();
+
+    IsolatedRunnable runnable(*pimpl->runnable);
+
+    // restore linked objects and stubs of their parents
+    QHash<QString, GtObject*> stubs;
+    QList<GtObject*> copies;
+
+    for (Impl::LinkedData& data : pimpl->linked)
+    {
+        GtObject* copy = data.before.restore(gtObjectFactory);
+
+        if (!copy)
+        {
+            gtError() << QObject::tr("Could not copy linked object '%1'!")
+                             .arg(data.before.ident());
+            return false;
+        }
+
+        GtObject* parent = nullptr;
+
+        for (Impl::Ancestor const& ancestor : qAsConst(data.ancestors))
+        {
+            GtObject*& stub = stubs[ancestor.uuid];
+
+            if (!stub)
+            {
+                stub = new GtObject;
+                stub->setObjectName(ancestor.name);
+                stub->setUuid(ancestor.uuid);
+
+                if (parent) parent->appendChild(stub);
+                else runnable.appendLinkedObject(stub);
+            }
+
+            parent = stub;
+        }
+
+        if (parent) parent->appendChild(copy);
+        else runnable.appendLinkedObject(copy);
+
+        copies.append(copy);
+    }
+
+    // restore process components and their external property connections
+    QList<GtProcessComponent*> components;
+    QList<QList<GtObject*>> connections;
+
+    for (Impl::ComponentData& data : pimpl->components)
+    {
+        auto* comp = qobject_cast<GtProcessComponent*>(
+            data.before.restore(data.factory));
+
+        if (!comp)
+        {
+            gtError() << QObject::tr("Could not copy process element '%1'!")
+                             .arg(data.before.ident());
+            return false;
+        }
+
+        runnable.appendProcessComponent(comp);
+        components.append(comp);
+
+        QList<GtObject*> cons;
+
+        for (GtObjectMemento const& memento : qAsConst(data.connections))
+        {
+            auto* con = qobject_cast<GtPropertyConnection*>(
+                memento.restore(gtObjectFactory));
+
+            if (!con) continue;
+
+            comp->appendChild(con);
+            con->makeConnection();
+            cons.append(con);
+        }
+
+        connections.append(cons);
+    }
+
+    // execute process components
+    bool success = true;
+
+    for (int i = 0; i < components.size() && success; ++i)
+    {
+        GtProcessComponent* comp = components[i];
+
+        QElapsedTimer timer;
+        timer.start();
+
+        success = run(*comp);
+
+        pimpl->timings.append(timer.elapsed());
+
+        // the copied connections must not end up in the results
+        qDeleteAll(connections[i]);
+
+        Impl::ComponentData& data = pimpl->components[i];
+        data.after = comp->toMemento();
+
+        auto childs = comp->findChildren<GtProcessComponent*>();
+        childs.prepend(comp);
+
+        for (GtProcessComponent const* child : qAsConst(childs))
+        {
+            data.states.insert(child->uuid(), child->currentState());
+        }
+    }
+
+    // collect changed data
+    for (int i = 0; i < copies.size(); ++i)
+    {
+        pimpl->linked[i].after = copies[i]->toMemento();
+    }
+
+    return success;
+}
+
+bool
+GtIsolatedProcessRun::merge()
+{
+    bool success = true;
+
+    auto const mergeDiff = [&success](GtObject* target,
+                                      GtObjectMemento const& before,
+                                      GtObjectMemento const& after) {
+        if (!target)
+        {
+            success = false;
+            return;
+        }
+
+        if (after.isNull()) return;
+
+        GtTypedMementoDiff const diff = rebasedDiff(*target, before, after);
+
+        if (diff.isNull()) return;
+
+        if (!target->applyDiff(diff))
+        {
+            gtWarning() << QObject::tr("Failed to merge data of '%1'!")
+                               .arg(target->objectName());
+            success = false;
+        }
+    };
+
+    for (Impl::LinkedData const& data : qAsConst(pimpl->linked))
+    {
+        mergeDiff(data.object, data.before, data.after);
+    }
+
+    for (Impl::ComponentData const& data : qAsConst(pimpl->components))
+    {
+        mergeDiff(data.component, data.before, data.after);
+
+        if (!data.component) continue;
+
+        for (auto iter = data.states.begin(); iter != data.states.end(); ++iter)
+        {
+            auto* comp = qobject_cast<GtProcessComponent*>(
+                data.component->getObjectByUuid(iter.key()));
+
+            if (comp)
+            {
+                comp->setState(
+                    static_cast<GtProcessComponent::STATE>(iter.value()));
+            }
+        }
+    }
+
+    return success;
+}
+
+QList<qint64> const&
+GtIsolatedProcessRun::timings() const
+{
+    return pimpl->timings;
+}
+
+QList<GtObject*>
+GtIsolatedProcessRun::linkedObjects(GtProcessComponent& component,
+                                    GtAbstractRunnable& runnable)
+{
+    return gt::detail::referencedObjects(
+        component,
+        [&runnable](QString const& uuid) {
+            return runnable.data<GtObject*>(uuid);
+        },
+        [&runnable](GtObjectPath const& path) {
+            return runnable.data<GtObject*>(path);
+        });
+}
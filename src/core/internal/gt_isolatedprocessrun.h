@@ -0,0 +1,101 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTISOLATEDPROCESSRUN_H
+#define GTISOLATEDPROCESSRUN_H
+
+#include "gt_core_exports.h"
+
+#include <QList>
+
+#include <functional>
+#include <memory>
+
+class GtObject;
+class GtProcessComponent;
+class GtAbstractRunnable;
+
+/**
+ * @brief Executes copies of process components on copies of the objects
+ * they link to. The datamodel of the runnable is not touched during the
+ * execution, thus multiple isolated runs may be executed in worker threads
+ * at the same time. The changed data is merged back afterwards.
+ *
+ * The linked objects are copied together with lightweight stubs of their
+ * parent objects, such that uuid and object path lookups of the copied
+ * process components resolve as in the original runnable. Property
+ * connections between properties of a process component (and its children),
+ * which are stored outside of the component (e.g. in the root task), are
+ * copied as well.
+ *
+ * The constructor and `merge` must be called in the thread of the runnable,
+ * `exec` may be called in any thread.
+ */
+class GT_CORE_EXPORT GtIsolatedProcessRun
+{
+public:
+    /**
+     * @brief Takes a snapshot of the process components and of all objects
+     * linked by them.
+     * @param components Process components to execute in the given order.
+     * All components must be children of the runnable.
+     * @param runnable Runnable holding the linked objects
+     */
+    GtIsolatedProcessRun(QList<GtProcessComponent*> const& components,
+                         GtAbstractRunnable& runnable);
+    ~GtIsolatedProcessRun();
+
+    GtIsolatedProcessRun(GtIsolatedProcessRun const&) = delete;
+    GtIsolatedProcessRun& operator=(GtIsolatedProcessRun const&) = delete;
+
+    /**
+     * @brief Executes copies of the process components one after another.
+     * All copies are created and deleted in the calling thread.
+     * @return Whether all process components were executed successfully
+     */
+    bool exec();
+
+    /**
+     * @brief Executes copies of the process components one after another
+     * using the given function instead of `GtProcessComponent::exec`.
+     * All copies are created and deleted in the calling thread.
+     * @param run Function executing a copied process component
+     * @return Whether all process components were executed successfully
+     */
+    bool exec(std::function<bool(GtProcessComponent&)> const& run);
+
+    /**
+     * @brief Merges the data changed by the execution as well as the states
+     * of the process components back into the originals. If the originals
+     * were changed meanwhile, e.g. by merging another isolated run, the
+     * changes are rebased onto their current state.
+     * @return Whether the data could be merged successfully
+     */
+    bool merge();
+
+    /**
+     * @brief Returns the execution time of each executed process component
+     * in milliseconds.
+     * @return Execution times
+     */
+    QList<qint64> const& timings() const;
+
+    /**
+     * @brief Returns the objects of the runnable the process component and
+     * its child components link to (see gt::detail::referencedObjects).
+     * @param component Process component
+     * @param runnable Runnable holding the linked objects
+     * @return Linked objects
+     */
+    static QList<GtObject*> linkedObjects(GtProcessComponent& component,
+                                          GtAbstractRunnable& runnable);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+};
+
+#endif // GTISOLATEDPROCESSRUN_H
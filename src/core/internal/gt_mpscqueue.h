@@ -0,0 +1,112 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTMPSCQUEUE_H
+#define GTMPSCQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief Unbounded lock-free multi-producer single-consumer queue.
+ *
+ * Producers push onto an atomic singly-linked list. The consumer takes the
+ * whole list at once, thus there is no ABA problem. Elements are consumed
+ * in the order they were pushed.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+    MpscQueue() = default;
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue()
+    {
+        consumeAll([](T&&) {});
+    }
+
+    /**
+     * @brief Appends the value. May be called from any thread.
+     * @param value Value to append
+     * @return True, if the queue was empty before
+     */
+    bool push(T value)
+    {
+        auto* node = new Node{std::move(value), nullptr};
+
+        Node* head = m_head.load(std::memory_order_relaxed);
+        do
+        {
+            node->next = head;
+        }
+        while (!m_head.compare_exchange_weak(head, node,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+
+        return head == nullptr;
+    }
+
+    /**
+     * @brief Removes all elements and passes them to the function in the
+     * order they were pushed. Must only be called by one thread at a time.
+     * @param f Function called with each element
+     * @return Number of consumed elements
+     */
+    template <typename Func>
+    int consumeAll(Func&& f)
+    {
+        Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        // the list is in LIFO order
+        Node* first = nullptr;
+        while (node)
+        {
+            Node* next = node->next;
+            node->next = first;
+            first = node;
+            node = next;
+        }
+
+        int n = 0;
+        while (first)
+        {
+            Node* next = first->next;
+            f(std::move(first->value));
+            delete first;
+            first = next;
+            ++n;
+        }
+
+        return n;
+    }
+
+    bool empty() const
+    {
+        return m_head.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node
+    {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> m_head{nullptr};
+};
+
+} // namespace detail
+} // namespace gt
+
+#endif // GTMPSCQUEUE_H
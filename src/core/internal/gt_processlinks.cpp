@@ -0,0 +1,79 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_processlinks.h"
+
+#include "gt_processcomponent.h"
+#include "gt_objectlinkproperty.h"
+#include "gt_objectpathproperty.h"
+#include "gt_relativeobjectlinkproperty.h"
+#include "gt_structproperty.h"
+#include "gt_propertystructcontainer.h"
+
+namespace
+{
+
+/// Collects the properties of a property tree
+void
+collectProperties(GtAbstractProperty* prop, QList<GtAbstractProperty*>& list)
+{
+    list.append(prop);
+
+    for (GtAbstractProperty* child : prop->properties())
+    {
+        collectProperties(child, list);
+    }
+}
+
+} // namespace
+
+QList<GtObject*>
+gt::detail::referencedObjects(
+        GtProcessComponent& component,
+        std::function<GtObject*(QString const&)> const& findByUuid,
+        std::function<GtObject*(GtObjectPath const&)> const& findByPath)
+{
+    QList<GtObject*> objects;
+
+    auto components = component.findChildren<GtProcessComponent*>();
+    components.prepend(&component);
+
+    for (GtProcessComponent* pc : qAsConst(components))
+    {
+        QList<GtAbstractProperty*> props = pc->fullPropertyList();
+
+        for (GtPropertyStructContainer& c : pc->propertyContainers())
+        {
+            for (GtPropertyStructInstance& entry : c)
+            {
+                collectProperties(&entry, props);
+            }
+        }
+
+        for (GtAbstractProperty* prop : qAsConst(props))
+        {
+            GtObject* obj = nullptr;
+
+            if (auto* linkProp = qobject_cast<GtObjectLinkProperty*>(prop))
+            {
+                obj = findByUuid(linkProp->linkedObjectUUID());
+            }
+            else if (auto* relLink =
+                         qobject_cast<GtRelativeObjectLinkProperty*>(prop))
+            {
+                obj = findByUuid(relLink->getVal());
+            }
+            else if (auto* pathProp = qobject_cast<GtObjectPathProperty*>(prop))
+            {
+                obj = findByPath(pathProp->path());
+            }
+
+            if (obj && !objects.contains(obj)) objects.append(obj);
+        }
+    }
+
+    return objects;
+}
@@ -0,0 +1,45 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTPROCESSLINKS_H
+#define GTPROCESSLINKS_H
+
+#include "gt_core_exports.h"
+
+#include <QList>
+
+#include <functional>
+
+class QString;
+class GtObject;
+class GtObjectPath;
+class GtProcessComponent;
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief Returns the objects referenced by the link properties of the
+ * process component and of its child components. Object link, relative
+ * object link and object path properties are considered, including the
+ * ones inside of property struct containers.
+ * @param component Process component
+ * @param findByUuid Returns the object with the given uuid
+ * @param findByPath Returns the object with the given path
+ * @return Referenced objects in the order of the properties without
+ * duplicates
+ */
+GT_CORE_EXPORT QList<GtObject*> referencedObjects(
+        GtProcessComponent& component,
+        std::function<GtObject*(QString const&)> const& findByUuid,
+        std::function<GtObject*(GtObjectPath const&)> const& findByPath);
+
+} // namespace detail
+} // namespace gt
+
+#endif // GTPROCESSLINKS_H
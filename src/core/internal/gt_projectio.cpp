@@ -57,7 +57,8 @@ GtProjectIO::readProjectData(const QDir& projectPath)
 bool
 GtProjectIO::saveProjectFiles(const QString& filePath,
                               const QDomDocument& doc,
-                              bool saveWithLinkedFiles)
+                              bool saveWithLinkedFiles,
+                              QHash<QString, QString>* linkedFiles)
 {
     const QFileInfo fi(filePath);
     const QDir baseDir = fi.dir().absolutePath();
@@ -70,7 +71,8 @@ GtProjectIO::saveProjectFiles(const QString& filePath,
                                                   saveWithLinkedFiles ?
                                                       gt::xml::LinkFileSaveType::WithLinkedFiles :
                                                       gt::xml::LinkFileSaveType::OneFile,
-                                                  &error))
+                                                  &error,
+                                                  linkedFiles))
     {
         gtError() << error;
         return false;
@@ -12,6 +12,7 @@
 #include <QString>
 #include <QDomDocument>
 #include <QDir>
+#include <QHash>
 
 /**
  * @brief Project file I/O utilities
@@ -36,11 +37,15 @@ public:
      * @brief Saves the project data to the given file path
      * @param filePath The full path to the project file
      * @param doc The QDomDocument to save
+     * @param saveWithLinkedFiles Whether objects are saved to linked files
+     * @param linkedFiles Optional output map of the linked file of each
+     * object uuid (see gt::xml::saveProjectXmlWithLinkedObjects)
      * @return true if successful, false otherwise
      */
     static bool saveProjectFiles(const QString& filePath,
                                  const QDomDocument& doc,
-                                 bool saveWithLinkedFiles = true);
+                                 bool saveWithLinkedFiles = true,
+                                 QHash<QString, QString>* linkedFiles = nullptr);
 
     /**
      * @brief Checks if a file exists at the given path
@@ -0,0 +1,148 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTRINGBUFFER_H
+#define GTRINGBUFFER_H
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief Fixed-capacity FIFO buffer. Appending to a full buffer drops the
+ * oldest element, thus trimming is O(1) per element.
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+    explicit RingBuffer(int capacity = 0) :
+        m_data(static_cast<size_t>(std::max(capacity, 0)))
+    { }
+
+    int capacity() const { return static_cast<int>(m_data.size()); }
+
+    int size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Returns the element at the given position, 0 being the oldest
+     * @param i Position
+     * @return Element
+     */
+    const T& at(int i) const
+    {
+        assert(i >= 0 && i < m_size);
+        return m_data[physical(i)];
+    }
+
+    /**
+     * @brief Appends the value. If the buffer is full, the oldest element is
+     * dropped.
+     * @param value Value to append
+     * @return Whether an element was dropped
+     */
+    bool push_back(T value)
+    {
+        if (m_data.empty()) return true;
+
+        if (m_size == capacity())
+        {
+            m_data[m_first] = std::move(value);
+            m_first = (m_first + 1) % capacity();
+            return true;
+        }
+
+        m_data[physical(m_size)] = std::move(value);
+        ++m_size;
+        return false;
+    }
+
+    /**
+     * @brief Removes the n oldest elements
+     * @param n Number of elements
+     */
+    void pop_front(int n = 1)
+    {
+        n = std::min(n, m_size);
+
+        for (int i = 0; i < n; ++i)
+        {
+            m_data[physical(i)] = T{};
+        }
+
+        if (!m_data.empty()) m_first = (m_first + n) % capacity();
+        m_size -= n;
+    }
+
+    /**
+     * @brief Removes the element at the given position. This is O(n).
+     * @param i Position
+     */
+    void removeAt(int i)
+    {
+        assert(i >= 0 && i < m_size);
+
+        for (int j = i; j < m_size - 1; ++j)
+        {
+            m_data[physical(j)] = std::move(m_data[physical(j + 1)]);
+        }
+
+        m_data[physical(m_size - 1)] = T{};
+        --m_size;
+    }
+
+    void clear()
+    {
+        std::fill(m_data.begin(), m_data.end(), T{});
+        m_first = 0;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Changes the capacity. If the buffer holds more elements than
+     * the new capacity, the oldest elements are dropped.
+     * @param capacity New capacity
+     */
+    void setCapacity(int capacity)
+    {
+        capacity = std::max(capacity, 0);
+
+        int const keep = std::min(m_size, capacity);
+
+        std::vector<T> data(static_cast<size_t>(capacity));
+        for (int i = 0; i < keep; ++i)
+        {
+            data[i] = std::move(m_data[physical(m_size - keep + i)]);
+        }
+
+        m_data = std::move(data);
+        m_first = 0;
+        m_size = keep;
+    }
+
+private:
+    std::vector<T> m_data;
+
+    /// physical index of the oldest element
+    int m_first{0};
+
+    int m_size{0};
+
+    int physical(int i) const { return (m_first + i) % capacity(); }
+};
+
+} // namespace detail
+} // namespace gt
+
+#endif // GTRINGBUFFER_H
@@ -10,7 +10,6 @@
 
 #include <QDir>
 #include <QFile>
-#include <QDomDocument>
 
 #include "gt_logging.h"
 #include "gt_coreapplication.h"
@@ -109,10 +108,7 @@ GtExportToMementoCalculator::run()
         return false;
     }
 
-    QDomDocument doc;
-    doc.setContent(obj->toMemento(false).toByteArray());
-
-    if (!gt::xml::writeDomDocumentToFile(path, doc, true))
+    if (!gt::xml::writeMementoToFile(path, obj->toMemento(false)))
     {
         gtError() << QObject::tr("GtExportToMementoCalculator: Could not save Object '%1' to '%2'").arg(obj->objectName(), path);
         return false;
@@ -40,6 +40,14 @@ GtAbstractRunnable::appendSourceData(const GtObjectMemento& memento)
     //    }
 }
 
+void
+GtAbstractRunnable::appendPartialSourceData(const GtObjectMemento& memento,
+                                            const QStringList& subtrees)
+{
+    m_inputData << memento;
+    m_partialInputData.insert(memento.uuid(), subtrees);
+}
+
 const QList<GtObjectMemento>&
 GtAbstractRunnable::outputData() const
 {
@@ -13,6 +13,7 @@
 
 #include "gt_core_exports.h"
 
+#include <QMap>
 #include <QRunnable>
 
 #include "gt_object.h"
@@ -54,6 +55,17 @@ public:
      */
     void appendSourceData(const GtObjectMemento& memento);
 
+    /**
+     * @brief Appends a partial snapshot of the source data. Apart from the
+     * given subtrees, the memento only contains stubs of the parent objects
+     * (without properties and unrelated children). Only the complete
+     * subtrees are written back as output data.
+     * @param memento Partial memento of a top level source object
+     * @param subtrees Uuids of the complete subtrees within the memento
+     */
+    void appendPartialSourceData(const GtObjectMemento& memento,
+                                 const QStringList& subtrees);
+
     /**
      * @brief sourceData
      * @return
@@ -170,6 +182,10 @@ protected:
     /// List of input meta data
     QList<GtObjectMemento> m_inputData;
 
+    /// Uuids of the complete subtrees of partial input data mapped by the
+    /// uuid of the partial input data
+    QMap<QString, QStringList> m_partialInputData;
+
     /// Process component queue
     QList<GtProcessComponent*> m_queue;
 
@@ -43,7 +43,7 @@ GtMonitoringData::addData(const QString& pId, const QVariant& pVal)
 }
 
 const QMap<QString, QVariant>&
-GtMonitoringData::data()
+GtMonitoringData::data() const
 {
     return m_data;
 }
@@ -42,7 +42,7 @@ public:
      * @brief Returns monitoring data map.
      * @return Monitoring data map.
      */
-    const QMap<QString, QVariant>& data();
+    const QMap<QString, QVariant>& data() const;
 
     /**
      * @brief Returns true if property identification string exists,
@@ -59,3 +59,9 @@ GtMonitoringDataSet::getData(const QString& uuid)
 {
     return m_data.value(uuid);
 }
+
+const QMap<QString, GtMonitoringData>&
+GtMonitoringDataSet::data() const
+{
+    return m_data;
+}
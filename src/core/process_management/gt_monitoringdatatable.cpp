@@ -13,21 +13,597 @@
 
 #include "gt_monitoringdatatable.h"
 
-GtMonitoringDataTable::GtMonitoringDataTable()
+#include <QAtomicInt>
+#include <QDataStream>
+#include <QFile>
+#include <QMutex>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
 {
 
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+/// Identifies monitoring history files ("GTMH")
+constexpr quint32 historyMagic = 0x47544d48;
+
+constexpr quint32 historyVersion = 2;
+
+constexpr QDataStream::Version historyStreamVersion = QDataStream::Qt_5_12;
+
+GtMonitoringDataTable::ValueType
+valueTypeOf(const QVariant& value)
+{
+    using ValueType = GtMonitoringDataTable::ValueType;
+
+    switch (value.userType())
+    {
+    case QMetaType::Double:
+        return ValueType::Double;
+    case QMetaType::Int:
+        return ValueType::Int;
+    case QMetaType::QString:
+        return ValueType::String;
+    default:
+        return ValueType::Variant;
+    }
+}
+
+double
+toDouble(const QVariant& value)
+{
+    bool ok = false;
+    double d = value.toDouble(&ok);
+    return ok ? d : nan;
 }
 
+} // namespace
+
+/**
+ * @brief Append-only history file. Each iteration is stored as a record
+ * holding the iteration number and the serialized values of each component.
+ * The positions of the values are indexed per component, thus a series is
+ * read without decoding the values of other components. The values read from
+ * the file are cached for the last requested series only.
+ *
+ * Each table owns its history. Copies of a table get a read-only snapshot of
+ * the records (see snapshot).
+ */
+struct GtMonitoringDataTable::History
+{
+    /// Position of the values of a component in the file
+    struct ComponentRecord
+    {
+        int iteration;
+        qint64 offset;
+    };
+
+    QString filePath;
+
+    /// Writes the records. Not open, if the file was opened for reading
+    QFile file;
+
+    /// Iteration numbers of the records
+    QVector<int> iterations;
+
+    /// Records by process component uuid
+    QHash<QString, QVector<ComponentRecord>> records;
+
+    /// Series of the cached values
+    SeriesKey cacheKey;
+
+    /// Values of the last requested series read from the file. Only the
+    /// iterations that were requested are cached
+    Series cache;
+
+    /// Guards the cache, which is filled by the const accessors of the table
+    QMutex cacheMutex;
+
+    /// Number of times the file was truncated. Shared with the snapshots
+    std::shared_ptr<QAtomicInt> truncations{std::make_shared<QAtomicInt>(0)};
+
+    /// Number of truncations before the records were written
+    int generation{0};
+
+    bool readOnly{false};
+
+    /// Returns a read-only history of the records written so far
+    std::unique_ptr<History> snapshot() const
+    {
+        auto copy = std::make_unique<History>();
+        copy->filePath = filePath;
+        copy->iterations = iterations;
+        copy->records = records;
+        copy->truncations = truncations;
+        copy->generation = generation;
+        copy->readOnly = true;
+
+        return copy;
+    }
+
+    /// Whether the records were discarded by truncating the file
+    bool isOutdated() const
+    {
+        return truncations->loadAcquire() != generation;
+    }
+
+    /// Truncates the file and writes the header
+    bool reset()
+    {
+        iterations.clear();
+        records.clear();
+        cacheKey = SeriesKey{};
+        cache = Series{};
+
+        // the snapshots must not read the new records at the old positions
+        generation = truncations->fetchAndAddOrdered(1) + 1;
+
+        if (!file.resize(0) || !file.seek(0)) return false;
+
+        QDataStream out(&file);
+        out.setVersion(historyStreamVersion);
+        out << historyMagic << historyVersion;
+
+        return out.status() == QDataStream::Ok;
+    }
+
+    void write(int iteration, const GtMonitoringDataSet& dataSet)
+    {
+        // positions of the component values within the record
+        QVector<QPair<QString, qint64>> positions;
+
+        QByteArray record;
+        {
+            QDataStream out(&record, QIODevice::WriteOnly);
+            out.setVersion(historyStreamVersion);
+
+            auto const& components = dataSet.data();
+            out << qint32(iteration) << quint32(components.size());
+            for (auto comp = components.begin(); comp != components.end();
+                 ++comp)
+            {
+                QByteArray values;
+                {
+                    QDataStream v(&values, QIODevice::WriteOnly);
+                    v.setVersion(historyStreamVersion);
+                    v << comp.value().data();
+                }
+
+                out << comp.key();
+                positions.append({comp.key(), out.device()->pos()});
+                out << values;
+            }
+        }
+
+        qint64 const base = file.pos();
+        bool const written = file.write(record) == record.size();
+
+        // records are visible to readers of the file (e.g. the GUI)
+        file.flush();
+
+        if (!written)
+        {
+            gtWarning() << QObject::tr("Could not write monitoring history "
+                                       "file '%1'!").arg(filePath);
+            return;
+        }
+
+        iterations.append(iteration);
+        for (auto const& pos : qAsConst(positions))
+        {
+            records[pos.first].append({iteration, base + pos.second});
+        }
+    }
+
+    /// Reads the values of the series in the iterations (first, last]
+    QVector<QVariant> read(const QString& compUuid, const QString& propId,
+                           int firstIteration, int lastIteration) const
+    {
+        QVector<QVariant> retval(lastIteration - firstIteration);
+
+        auto const iter = records.find(compUuid);
+        if (iter == records.end() || isOutdated()) return retval;
+
+        QVector<ComponentRecord> const& comp = iter.value();
+        auto rec = std::upper_bound(comp.begin(), comp.end(), firstIteration,
+                                    [](int i, ComponentRecord const& r) {
+            return i < r.iteration;
+        });
+
+        if (rec == comp.end() || rec->iteration > lastIteration)
+        {
+            return retval;
+        }
+
+        QFile in(filePath);
+        if (!in.open(QIODevice::ReadOnly))
+        {
+            gtWarning() << QObject::tr("Could not read monitoring history "
+                                       "file '%1'!").arg(filePath);
+            return retval;
+        }
+
+        QDataStream stream(&in);
+        stream.setVersion(historyStreamVersion);
+
+        for (; rec != comp.end() && rec->iteration <= lastIteration; ++rec)
+        {
+            QByteArray values;
+            if (!in.seek(rec->offset)) break;
+
+            stream >> values;
+            if (stream.status() != QDataStream::Ok) break;
+
+            QDataStream record(values);
+            record.setVersion(historyStreamVersion);
+
+            QMap<QString, QVariant> map;
+            record >> map;
+
+            retval[rec->iteration - firstIteration - 1] = map.value(propId);
+        }
+
+        // the file was truncated while reading
+        if (isOutdated())
+        {
+            return QVector<QVariant>(lastIteration - firstIteration);
+        }
+
+        return retval;
+    }
+
+    /**
+     * @brief Returns the values of the series up to the given iteration.
+     * If the series was requested last, only the iterations that were not
+     * cached yet are read from the file. Otherwise, the cache is replaced.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @param lastIteration Last iteration
+     * @return Series
+     */
+    Series prefix(const QString& compUuid, const QString& propId,
+                  int lastIteration)
+    {
+        QMutexLocker locker(&cacheMutex);
+
+        SeriesKey const key{compUuid, propId};
+        if (cacheKey != key)
+        {
+            cacheKey = key;
+            cache = Series{};
+        }
+
+        if (cache.size() < lastIteration)
+        {
+            for (QVariant const& value :
+                 read(compUuid, propId, cache.size(), lastIteration))
+            {
+                cache.append(value);
+            }
+        }
+
+        return cache;
+    }
+};
+
+QVariant
+GtMonitoringDataTable::Series::value(int i) const
+{
+    if (!valid[i])
+    {
+        return {};
+    }
+
+    switch (type)
+    {
+    case ValueType::Double:
+        return doubles[i];
+    case ValueType::Int:
+        return ints[i];
+    case ValueType::String:
+        return strings[i];
+    case ValueType::Variant:
+        return variants[i];
+    case ValueType::Invalid:
+        break;
+    }
+
+    return {};
+}
+
+void
+GtMonitoringDataTable::Series::append(const QVariant& value)
+{
+    if (!value.isValid())
+    {
+        appendMissing();
+        return;
+    }
+
+    ValueType const vtype = valueTypeOf(value);
+
+    // the first value determines the type of the series
+    if (type == ValueType::Invalid)
+    {
+        int const n = size();
+        type = vtype;
+        switch (type)
+        {
+        case ValueType::Double:
+            doubles.fill(nan, n);
+            break;
+        case ValueType::Int:
+            ints.fill(0, n);
+            break;
+        case ValueType::String:
+            strings.resize(n);
+            break;
+        default:
+            variants.resize(n);
+            break;
+        }
+    }
+    else if (type != vtype && type != ValueType::Variant)
+    {
+        makeVariant();
+    }
+
+    switch (type)
+    {
+    case ValueType::Double:
+        doubles.append(value.toDouble());
+        break;
+    case ValueType::Int:
+        ints.append(value.toInt());
+        break;
+    case ValueType::String:
+        strings.append(value.toString());
+        break;
+    default:
+        variants.append(value);
+        break;
+    }
+
+    valid.push_back(true);
+}
+
+void
+GtMonitoringDataTable::Series::appendMissing()
+{
+    switch (type)
+    {
+    case ValueType::Double:
+        doubles.append(nan);
+        break;
+    case ValueType::Int:
+        ints.append(0);
+        break;
+    case ValueType::String:
+        strings.append(QString{});
+        break;
+    case ValueType::Variant:
+        variants.append(QVariant{});
+        break;
+    case ValueType::Invalid:
+        break;
+    }
+
+    valid.push_back(false);
+}
+
+void
+GtMonitoringDataTable::Series::makeVariant()
+{
+    QVector<QVariant> values;
+    values.reserve(size());
+
+    for (int i = 0; i < size(); ++i)
+    {
+        values.append(value(i));
+    }
+
+    doubles.clear();
+    ints.clear();
+    strings.clear();
+    variants = std::move(values);
+    type = ValueType::Variant;
+}
+
+void
+GtMonitoringDataTable::Series::removeFirst(int n)
+{
+    switch (type)
+    {
+    case ValueType::Double:
+        doubles.remove(0, n);
+        break;
+    case ValueType::Int:
+        ints.remove(0, n);
+        break;
+    case ValueType::String:
+        strings.remove(0, n);
+        break;
+    case ValueType::Variant:
+        variants.remove(0, n);
+        break;
+    case ValueType::Invalid:
+        break;
+    }
+
+    valid.erase(valid.begin(), valid.begin() + n);
+}
+
+GtMonitoringDataTable::GtMonitoringDataTable() :
+    m_size(0),
+    m_offset(0),
+    m_maxIterations(0)
+{
+
+}
+
+GtMonitoringDataTable::GtMonitoringDataTable(
+        const GtMonitoringDataTable& other) :
+    m_size(other.m_size),
+    m_offset(other.m_offset),
+    m_maxIterations(other.m_maxIterations),
+    m_history(other.m_history ? other.m_history->snapshot() : nullptr),
+    m_series(other.m_series)
+{
+
+}
+
+GtMonitoringDataTable::GtMonitoringDataTable(
+        GtMonitoringDataTable&&) noexcept = default;
+
+GtMonitoringDataTable&
+GtMonitoringDataTable::operator=(const GtMonitoringDataTable& other)
+{
+    if (this != &other)
+    {
+        *this = GtMonitoringDataTable(other);
+    }
+
+    return *this;
+}
+
+GtMonitoringDataTable&
+GtMonitoringDataTable::operator=(GtMonitoringDataTable&&) noexcept = default;
+
+GtMonitoringDataTable::~GtMonitoringDataTable() = default;
+
 void
 GtMonitoringDataTable::clear()
 {
-    m_data.clear();
+    m_series.clear();
+    m_size = 0;
+    m_offset = 0;
+
+    if (!m_history) return;
+
+    if (m_history->readOnly || !m_history->reset())
+    {
+        m_history.reset();
+    }
+}
+
+bool
+GtMonitoringDataTable::setHistoryFile(const QString& filePath,
+                                      int maxIterations)
+{
+    auto history = std::make_unique<History>();
+    history->filePath = filePath;
+    history->file.setFileName(filePath);
+
+    if (!history->file.open(QIODevice::ReadWrite) || !history->reset())
+    {
+        gtError() << QObject::tr("Could not open monitoring history "
+                                 "file '%1'!").arg(filePath);
+        return false;
+    }
+
+    m_history.reset();
+    clear();
+
+    m_history = std::move(history);
+    m_maxIterations = std::max(maxIterations, 1);
+
+    return true;
+}
+
+bool
+GtMonitoringDataTable::openHistoryFile(const QString& filePath)
+{
+    QFile in(filePath);
+    if (!in.open(QIODevice::ReadOnly))
+    {
+        gtError() << QObject::tr("Could not open monitoring history "
+                                 "file '%1'!").arg(filePath);
+        return false;
+    }
+
+    QDataStream stream(&in);
+    stream.setVersion(historyStreamVersion);
+
+    quint32 magic = 0, version = 0;
+    stream >> magic >> version;
+
+    if (magic != historyMagic || version != historyVersion)
+    {
+        gtError() << QObject::tr("Invalid monitoring history file '%1'!")
+                     .arg(filePath);
+        return false;
+    }
+
+    auto history = std::make_unique<History>();
+    history->filePath = filePath;
+    history->readOnly = true;
+
+    // only the positions of the component values are read
+    while (!stream.atEnd())
+    {
+        qint32 iteration = 0;
+        quint32 nComponents = 0;
+        stream >> iteration >> nComponents;
+
+        bool valid = stream.status() == QDataStream::Ok &&
+                     iteration > (history->iterations.isEmpty() ?
+                                      0 : history->iterations.last());
+
+        QVector<QPair<QString, qint64>> positions;
+        for (quint32 i = 0; valid && i < nComponents; ++i)
+        {
+            QString uuid;
+            stream >> uuid;
+
+            qint64 const offset = in.pos();
+
+            quint32 length = 0;
+            stream >> length;
+
+            valid = stream.status() == QDataStream::Ok &&
+                    stream.skipRawData(length) == int(length);
+
+            positions.append({uuid, offset});
+        }
+
+        if (!valid)
+        {
+            gtWarning() << QObject::tr("Monitoring history file '%1' is "
+                                       "truncated!").arg(filePath);
+            break;
+        }
+
+        history->iterations.append(iteration);
+        for (auto const& pos : qAsConst(positions))
+        {
+            history->records[pos.first].append({iteration, pos.second});
+        }
+    }
+
+    m_history.reset();
+    clear();
+
+    m_history = std::move(history);
+    m_size = m_history->iterations.isEmpty() ?
+                 0 : m_history->iterations.last();
+    m_offset = m_size;
+
+    return true;
+}
+
+QString
+GtMonitoringDataTable::historyFile() const
+{
+    return m_history ? m_history->filePath : QString{};
 }
 
 int
 GtMonitoringDataTable::size() const
 {
-    return m_data.size();
+    return m_size;
 }
 
 bool
@@ -41,7 +617,7 @@ GtMonitoringDataTable::append(int iteration,
     }
 
     // get current data size
-    const int dataSize = m_data.size();
+    const int dataSize = m_size;
 
     // validate iteration number with current data size
     if (iteration <= dataSize)
@@ -49,14 +625,62 @@ GtMonitoringDataTable::append(int iteration,
         return false;
     }
 
-    // fill missing iterations using empty data sets
-    for (int i = dataSize; i < (iteration - 1); i++)
+    if (m_history && m_history->readOnly)
+    {
+        return false;
+    }
+
+    // position of the iteration in the in-memory series
+    int const pos = iteration - 1 - m_offset;
+
+    // append values of the data set, new series start with missing values
+    auto const& components = dataSet.data();
+    for (auto comp = components.begin(); comp != components.end(); ++comp)
+    {
+        auto const& values = comp.value().data();
+        for (auto val = values.begin(); val != values.end(); ++val)
+        {
+            Series& series = m_series[SeriesKey{comp.key(), val.key()}];
+
+            while (series.size() < pos)
+            {
+                series.appendMissing();
+            }
+
+            series.append(val.value());
+        }
+    }
+
+    // fill missing iterations and properties that were not monitored
+    for (Series& series : m_series)
+    {
+        while (series.size() <= pos)
+        {
+            series.appendMissing();
+        }
+    }
+
+    m_size = iteration;
+
+    if (!m_history)
     {
-        m_data << GtMonitoringDataSet();
+        return true;
     }
 
-    // append new data set
-    m_data << dataSet;
+    m_history->write(iteration, dataSet);
+
+    // drop the oldest iterations in batches, thus trimming is amortized O(1)
+    if (m_size - m_offset >= 2 * m_maxIterations)
+    {
+        int const n = m_size - m_offset - m_maxIterations;
+
+        for (Series& series : m_series)
+        {
+            series.removeFirst(n);
+        }
+
+        m_offset += n;
+    }
 
     return true;
 }
@@ -74,20 +698,209 @@ GtMonitoringDataTable::getData(const QString& compUuid, const QString& propId)
     // create and initialize return vector
     QVector<QVariant> retval(size(), QVariant());
 
-    for (int i = 0; i < m_data.size(); i++)
+    Series buffer;
+    if (const Series* s = fullSeries(compUuid, propId, buffer))
     {
-        if (m_data[i].contains(compUuid))
+        for (int i = 0; i < s->size(); i++)
         {
-            GtMonitoringData mdata = m_data[i].getData(compUuid);
+            retval[i] = s->value(i);
+        }
+    }
 
-            if (mdata.contains(propId))
-            {
-                QVariant mval = mdata.getData(propId);
+    return retval;
+}
 
-                retval[i] = mval;
-            }
+GtMonitoringDataTable::ValueType
+GtMonitoringDataTable::valueType(const QString& compUuid,
+                                 const QString& propId) const
+{
+    const Series* s = series(compUuid, propId);
+    ValueType const type = s ? s->type : ValueType::Invalid;
+
+    if (m_offset == 0 || !m_history)
+    {
+        return type;
+    }
+
+    // the values are not copied, the types of both parts are combined like
+    // appending the values would do
+    ValueType const prefixType =
+        m_history->prefix(compUuid, propId, m_offset).type;
+
+    if (prefixType == ValueType::Invalid) return type;
+    if (type == ValueType::Invalid || type == prefixType) return prefixType;
+
+    return ValueType::Variant;
+}
+
+QVector<double>
+GtMonitoringDataTable::doubleData(const QString& compUuid,
+                                  const QString& propId) const
+{
+    Series buffer;
+    const Series* s = fullSeries(compUuid, propId, buffer);
+
+    if (!s)
+    {
+        return {};
+    }
+
+    if (s->type == ValueType::Double)
+    {
+        return s->doubles;
+    }
+
+    QVector<double> retval(s->size(), nan);
+    for (int i = 0; i < s->size(); ++i)
+    {
+        if (!s->valid[i]) continue;
+
+        retval[i] = s->type == ValueType::Int ? s->ints[i] :
+                                                toDouble(s->value(i));
+    }
+
+    return retval;
+}
+
+QVector<int>
+GtMonitoringDataTable::intData(const QString& compUuid,
+                               const QString& propId) const
+{
+    Series buffer;
+    const Series* s = fullSeries(compUuid, propId, buffer);
+
+    if (!s)
+    {
+        return {};
+    }
+
+    if (s->type == ValueType::Int)
+    {
+        return s->ints;
+    }
+
+    QVector<int> retval(s->size(), 0);
+    for (int i = 0; i < s->size(); ++i)
+    {
+        if (s->valid[i]) retval[i] = s->value(i).toInt();
+    }
+
+    return retval;
+}
+
+QVector<QString>
+GtMonitoringDataTable::stringData(const QString& compUuid,
+                                  const QString& propId) const
+{
+    Series buffer;
+    const Series* s = fullSeries(compUuid, propId, buffer);
+
+    if (!s)
+    {
+        return {};
+    }
+
+    if (s->type == ValueType::String)
+    {
+        return s->strings;
+    }
+
+    QVector<QString> retval(s->size());
+    for (int i = 0; i < s->size(); ++i)
+    {
+        if (s->valid[i]) retval[i] = s->value(i).toString();
+    }
+
+    return retval;
+}
+
+QVector<QPointF>
+GtMonitoringDataTable::downsampledData(const QString& compUuid,
+                                       const QString& propId,
+                                       int maxPoints) const
+{
+    QVector<double> const values = doubleData(compUuid, propId);
+    int const n = values.size();
+
+    QVector<QPointF> retval;
+
+    // the x-coordinate is the iteration number, which starts at 1
+    if (n <= maxPoints)
+    {
+        retval.reserve(n);
+        for (int i = 0; i < n; ++i)
+        {
+            if (!std::isnan(values[i])) retval.append({i + 1.0, values[i]});
+        }
+        return retval;
+    }
+
+    if (maxPoints < 2)
+    {
+        return retval;
+    }
+
+    // each bucket contributes its minimum and maximum
+    int const nBuckets = maxPoints / 2;
+    retval.reserve(nBuckets * 2);
+
+    for (int b = 0; b < nBuckets; ++b)
+    {
+        int const begin = static_cast<int>(qint64(b) * n / nBuckets);
+        int const end = static_cast<int>(qint64(b + 1) * n / nBuckets);
+
+        int iMin = -1, iMax = -1;
+        for (int i = begin; i < end; ++i)
+        {
+            if (std::isnan(values[i])) continue;
+
+            if (iMin < 0 || values[i] < values[iMin]) iMin = i;
+            if (iMax < 0 || values[i] > values[iMax]) iMax = i;
+        }
+
+        if (iMin < 0) continue;
+
+        int const first = std::min(iMin, iMax);
+        int const second = std::max(iMin, iMax);
+
+        retval.append({first + 1.0, values[first]});
+        if (second != first)
+        {
+            retval.append({second + 1.0, values[second]});
         }
     }
 
     return retval;
 }
+
+const GtMonitoringDataTable::Series*
+GtMonitoringDataTable::series(const QString& compUuid,
+                              const QString& propId) const
+{
+    auto iter = m_series.find(SeriesKey{compUuid, propId});
+
+    return iter != m_series.end() ? &iter.value() : nullptr;
+}
+
+const GtMonitoringDataTable::Series*
+GtMonitoringDataTable::fullSeries(const QString& compUuid,
+                                  const QString& propId,
+                                  Series& buffer) const
+{
+    const Series* s = series(compUuid, propId);
+
+    if (m_offset == 0 || !m_history)
+    {
+        return s;
+    }
+
+    buffer = m_history->prefix(compUuid, propId, m_offset);
+
+    for (int i = 0; i < m_size - m_offset; ++i)
+    {
+        if (s) buffer.append(s->value(i));
+        else buffer.appendMissing();
+    }
+
+    return s || buffer.type != ValueType::Invalid ? &buffer : nullptr;
+}
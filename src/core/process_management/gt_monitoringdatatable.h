@@ -14,26 +14,100 @@
 
 #include "gt_core_exports.h"
 
+#include <QHash>
+#include <QPair>
+#include <QPointF>
 #include <QVector>
 
+#include <memory>
+#include <vector>
+
 #include "gt_monitoringdataset.h"
 
 /**
  * @brief The GtMonitoringDataTable class
+ *
+ * The monitoring data is stored column-wise: each monitored property of a
+ * process component is a series holding one value per iteration in a
+ * contiguous array. Floating point, integer and string values are stored in
+ * typed arrays, other values (or series mixing types) as variants.
+ *
+ * Optionally, the data of each iteration is streamed into an append-only
+ * history file (see setHistoryFile). Then, only the most recent iterations
+ * are kept in memory and older values are read back from the file once a
+ * series is requested. Only the values of the requested component are read.
+ * The values read for the last requested series are cached, thus requesting
+ * the same series repeatedly (e.g. for a live plot) only reads the new
+ * records.
+ *
+ * Copies of a table with a history file read the records written so far, but
+ * cannot append data. Clearing a copy detaches it from the file.
  */
 class GT_CORE_EXPORT GtMonitoringDataTable
 {
 public:
+    /// Type of the values of a series
+    enum class ValueType
+    {
+        /// Series does not exist or has no values yet
+        Invalid,
+        Double,
+        Int,
+        String,
+        Variant
+    };
+
     /**
      * @brief Constructor.
      */
     GtMonitoringDataTable();
 
     /**
-     * @brief Clears entire data set list.
+     * @brief Copy constructor. The history file is accessed read-only by the
+     * copy.
+     * @param other Table to copy
+     */
+    GtMonitoringDataTable(const GtMonitoringDataTable& other);
+    GtMonitoringDataTable(GtMonitoringDataTable&& other) noexcept;
+    GtMonitoringDataTable& operator=(const GtMonitoringDataTable& other);
+    GtMonitoringDataTable& operator=(GtMonitoringDataTable&& other) noexcept;
+
+    ~GtMonitoringDataTable();
+
+    /**
+     * @brief Clears entire data set list. An attached history file is
+     * truncated, a history file opened for reading or read by a copy is
+     * detached. Copies of the table lose the values that were only stored
+     * in the truncated file.
      */
     void clear();
 
+    /**
+     * @brief Streams the data of each appended iteration into the given
+     * file. Only the last maxIterations iterations are kept in memory, older
+     * values are read from the file on request. The table is cleared and the
+     * file is truncated.
+     * @param filePath History file
+     * @param maxIterations Number of iterations kept in memory
+     * @return False if the file cannot be written
+     */
+    bool setHistoryFile(const QString& filePath, int maxIterations = 1000);
+
+    /**
+     * @brief Opens a history file written before, e.g. by a previous run.
+     * The values are read from the file on request. No data can be appended
+     * to the table afterwards.
+     * @param filePath History file
+     * @return False if the file cannot be read or is not a history file
+     */
+    bool openHistoryFile(const QString& filePath);
+
+    /**
+     * @brief Returns the path of the history file
+     * @return History file. Empty if the data is only kept in memory
+     */
+    QString historyFile() const;
+
     /**
      * @brief Returns size of monitoring data table.
      * @return Size of monitoring data table.
@@ -58,10 +132,124 @@ public:
      */
     QVector<QVariant> getData(const QString& compUuid, const QString& propId);
 
+    /**
+     * @brief Returns the type of the values of the given series.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @return Value type
+     */
+    ValueType valueType(const QString& compUuid, const QString& propId) const;
+
+    /**
+     * @brief Returns the values of the given series as floating point
+     * numbers, one per iteration. Missing values and values that are not
+     * convertible are NaN. For floating point series, the stored array is
+     * returned without copying.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @return Values. Empty if the series does not exist
+     */
+    QVector<double> doubleData(const QString& compUuid,
+                               const QString& propId) const;
+
+    /**
+     * @brief Returns the values of the given integer series, one per
+     * iteration. Missing values are 0. For other series, the values are
+     * converted.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @return Values. Empty if the series does not exist
+     */
+    QVector<int> intData(const QString& compUuid,
+                         const QString& propId) const;
+
+    /**
+     * @brief Returns the values of the given string series, one per
+     * iteration. Missing values are null strings. For other series, the
+     * values are converted.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @return Values. Empty if the series does not exist
+     */
+    QVector<QString> stringData(const QString& compUuid,
+                                const QString& propId) const;
+
+    /**
+     * @brief Returns a downsampled view of the given series for plotting.
+     * The iterations are split into buckets, each represented by the minimum
+     * and maximum value of the bucket, thus peaks are preserved. The
+     * x-coordinate of a point is its iteration number.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @param maxPoints Maximum number of points. If the series has less
+     * values, all valid values are returned.
+     * @return Points sorted by iteration
+     */
+    QVector<QPointF> downsampledData(const QString& compUuid,
+                                     const QString& propId,
+                                     int maxPoints) const;
+
 private:
-    /// List of monitoring data sets.
-    QVector<GtMonitoringDataSet> m_data;
+    /// Values of a monitored property. All series have one entry per
+    /// iteration
+    struct Series
+    {
+        ValueType type{ValueType::Invalid};
+        QVector<double> doubles;
+        QVector<int> ints;
+        QVector<QString> strings;
+        QVector<QVariant> variants;
+        /// false for iterations without a value
+        std::vector<bool> valid;
+
+        int size() const { return static_cast<int>(valid.size()); }
+
+        QVariant value(int i) const;
+
+        void append(const QVariant& value);
+
+        void appendMissing();
 
+        /// converts the stored values into variants
+        void makeVariant();
+
+        /// removes the values of the n oldest iterations
+        void removeFirst(int n);
+    };
+
+    using SeriesKey = QPair<QString, QString>;
+
+    struct History;
+
+    /// Number of iterations
+    int m_size;
+
+    /// Number of iterations that are only stored in the history file
+    int m_offset;
+
+    /// Number of iterations kept in memory if a history file is attached
+    int m_maxIterations;
+
+    /// History file. Read-only for copies of the table
+    std::unique_ptr<History> m_history;
+
+    /// Series by process component uuid and property id
+    QHash<SeriesKey, Series> m_series;
+
+    const Series* series(const QString& compUuid,
+                         const QString& propId) const;
+
+    /**
+     * @brief Returns the series of all iterations. If values are only stored
+     * in the history file, they are read into the buffer.
+     * @param compUuid Process component UUID
+     * @param propId Property identification string
+     * @param buffer Buffer for the series
+     * @return Series. Null if it does not exist
+     */
+    const Series* fullSeries(const QString& compUuid,
+                             const QString& propId,
+                             Series& buffer) const;
 };
 
 #endif // GTMONITORINGDATATABLE_H
@@ -9,20 +9,59 @@
  *  Tel.: +49 2203 601 2191
  */
 #include "gt_calculator.h"
+#include "gt_abstractrunnable.h"
+#include "internal/gt_isolatedprocessrun.h"
 
 #include "gt_parameterloop.h"
 
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+/// Job evaluating a single sample in a worker thread
+class SampleJob : public QRunnable
+{
+public:
+    explicit SampleJob(std::function<void()> func) :
+        m_func(std::move(func))
+    { }
+
+    void run() override
+    {
+        m_func();
+    }
+
+private:
+    std::function<void()> m_func;
+};
+
+} // namespace
+
 GtParameterLoop::GtParameterLoop() :
     m_startVal("start", "start"),
     m_endVal("end", "end"),
     m_steps("steps", "steps", "steps", gt::Boundaries<int>::makeLower(1), 1),
-    m_currentVal("currentVal", "currentVal")
+    m_currentVal("currentVal", "currentVal"),
+    m_parallelSamples("parallelSamples", tr("Parallel Samples"),
+                      tr("Number of samples evaluated at the same time. The "
+                         "samples of a batch do not see the results of each "
+                         "other: each one starts from the data before the "
+                         "batch, their results are merged back in sample "
+                         "order."),
+                      gt::Boundaries<int>::makeLower(1), 1)
 {
     setObjectName("Parameter Loop");
 
     registerProperty(m_startVal);
     registerProperty(m_endVal);
     registerProperty(m_steps);
+    registerProperty(m_parallelSamples);
 
     registerMonitoringProperty(m_currentVal);
 }
@@ -68,6 +107,11 @@ GtParameterLoop::value(int iteration)
 bool
 GtParameterLoop::runChildElements()
 {
+    if (m_parallelSamples > 1 && m_currentIter + 1 < m_maxIter)
+    {
+        return runSamplesInParallel();
+    }
+
     QList<GtProcessComponent*> childs = processComponents();
 
     // increment current iteration step and continue iteration
@@ -140,3 +184,179 @@ GtParameterLoop::runChildElements()
 
     return true;
 }
+
+bool
+GtParameterLoop::runSamplesInParallel()
+{
+    auto runnable = this->runnable();
+    if (!runnable)
+    {
+        setState(GtProcessComponent::FAILED);
+        gtError() << tr("%1: Failed to execute samples, runnable not found!")
+                         .arg(objectName());
+        return false;
+    }
+
+    int const first = m_currentIter;
+    int const maxIter = m_maxIter;
+    int const count = std::min(m_parallelSamples.getVal(), maxIter - first);
+
+    // trigger transfer of monitoring properties before running calculators
+    emit transferMonitoringProperties();
+
+    // reset state of child prcess elements
+    foreach (GtProcessComponent* comp, processComponents())
+    {
+        comp->setStateRecursively(GtProcessComponent::QUEUED);
+    }
+
+    // each sample is evaluated on its own copy of the loop
+    std::vector<std::unique_ptr<GtIsolatedProcessRun>> runs;
+    std::vector<GtMonitoringDataSet> monData(count);
+    std::vector<int> results(count, 0);
+
+    for (int i = 0; i < count; ++i)
+    {
+        runs.push_back(std::make_unique<GtIsolatedProcessRun>(
+            QList<GtProcessComponent*>{this}, *runnable));
+    }
+
+    auto const interrupted = [this]() {
+        return isInterruptionRequested();
+    };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(
+        std::min(count, std::max(1, QThread::idealThreadCount())));
+
+    for (int i = 0; i < count; ++i)
+    {
+        pool.start(new SampleJob([&, i]() {
+            // samples not started yet are skipped after an interruption
+            if (interrupted()) return;
+
+            results[i] = runs[i]->exec([&, i](GtProcessComponent& comp) {
+                auto* loop = qobject_cast<GtParameterLoop*>(&comp);
+                return loop && loop->runSample(first + i, maxIter, monData[i],
+                                               interrupted);
+            });
+        }));
+    }
+
+    pool.waitForDone();
+
+    // transfer monitoring data in sample order
+    int const failed = static_cast<int>(
+        std::find(results.begin(), results.end(), 0) - results.begin());
+
+    for (int i = 0; i < failed; ++i)
+    {
+        if (!monData[i].isEmpty())
+        {
+            emit monitoringDataTransfer(first + i + 1, monData[i]);
+        }
+    }
+
+    // merge the results in sample order. As in the sequential mode, the
+    // data of a failed sample is kept and the following samples are dropped.
+    // All samples started from the same data, thus each merge is rebased
+    // onto the results of the previous samples
+    int const last = std::min(failed, count - 1);
+    bool merged = true;
+
+    for (int i = 0; i <= last && merged; ++i)
+    {
+        merged = runs[i]->merge();
+    }
+
+    if (!merged)
+    {
+        gtError() << tr("Could not merge results of '%1'!").arg(objectName());
+        setState(GtProcessComponent::FAILED);
+        return false;
+    }
+
+    if (failed < count)
+    {
+        m_currentIter.setVal(first + failed + 1);
+
+        if (isInterruptionRequested())
+        {
+            gtWarning() << "task terminated!";
+            setState(GtProcessComponent::TERMINATED);
+            return false;
+        }
+
+        setState(GtProcessComponent::FAILED);
+        return false;
+    }
+
+    gtInfo().medium() << tr("%1: evaluated samples %2 to %3 in parallel")
+                             .arg(objectName()).arg(first + 1)
+                             .arg(first + count);
+
+    m_currentIter.setVal(first + count);
+
+    // evaluate current iteration step
+    m_lastEval = evaluate();
+
+    // trigger transfer of monitoring properties after evaluation
+    emit transferMonitoringProperties();
+
+    if (isInterruptionRequested())
+    {
+        gtWarning() << "task terminated!";
+        setState(GtProcessComponent::TERMINATED);
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GtParameterLoop::runSample(int sample, int maxIter, GtMonitoringDataSet& monData,
+                           std::function<bool()> const& interrupted)
+{
+    m_maxIter.setVal(maxIter);
+    m_currentIter.setVal(sample + 1);
+    m_currentVal.setVal(value(sample));
+
+    QList<GtProcessComponent*> childs = processComponents();
+
+    foreach (GtProcessComponent* comp, childs)
+    {
+        comp->setStateRecursively(GtProcessComponent::QUEUED);
+    }
+
+    // run calculators
+    foreach (GtProcessComponent* comp, childs)
+    {
+        GtCalculator* calc = qobject_cast<GtCalculator*>(comp);
+
+        if (!comp->exec() && calc)
+        {
+            gtWarning() << tr("Sample %1 failed").arg(sample + 1);
+            break;
+        }
+
+        if (interrupted())
+        {
+            return false;
+        }
+
+        if (calc && calc->runFailsOnWarning() &&
+            calc->currentState() == GtProcessComponent::WARN_FINISHED)
+        {
+            calc->setState(FAILED);
+            return false;
+        }
+    }
+
+    // evaluate current iteration step
+    m_lastEval = evaluate();
+
+    // collect monitoring data of the sample
+    monData = collectMonitoringData();
+
+    return true;
+}
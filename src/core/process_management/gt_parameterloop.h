@@ -18,6 +18,8 @@
 #include "gt_doubleproperty.h"
 #include "gt_intproperty.h"
 
+#include <functional>
+
 /**
  * @brief The GtParameterLoop class
  */
@@ -49,12 +51,37 @@ private:
 
     GtDoubleProperty m_currentVal;
 
+    /// Number of samples evaluated at the same time
+    GtIntProperty m_parallelSamples;
+
     /**
      * @brief value -  calculates the current value for the iteration step
      * @param iteration
      * @return
      */
     double value(int iteration);
+
+    /**
+     * @brief Evaluates the next samples at the same time. Each sample is
+     * evaluated in a worker thread on a copy of the loop and of the objects
+     * linked by it. All samples start from the data before the batch. The
+     * monitoring data is gathered and the results are merged back into the
+     * datamodel in sample order.
+     * @return Whether the samples were evaluated successfully
+     */
+    bool runSamplesInParallel();
+
+    /**
+     * @brief Evaluates a single sample by running the child elements once.
+     * Used on copies of the loop by the parallel sample evaluation.
+     * @param sample Index of the sample
+     * @param maxIter Number of iteration steps of the original loop
+     * @param monData Collected monitoring data of the sample
+     * @param interrupted Returns whether the original loop was interrupted
+     * @return Whether the sample was evaluated successfully
+     */
+    bool runSample(int sample, int maxIter, GtMonitoringDataSet& monData,
+                   std::function<bool()> const& interrupted);
 };
 
 #endif // GTPARAMETERLOOP_H
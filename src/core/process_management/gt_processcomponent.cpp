@@ -58,6 +58,9 @@ struct GtProcessComponent::Impl
 
     /// Warning flag
     bool warning;
+
+    /// Whether the complete source data is required
+    bool fullSourceData{false};
 };
 
 GtProcessComponent::GtProcessComponent() :
@@ -370,6 +373,18 @@ GtProcessComponent::setSkipped(bool val)
     pimpl->skipped = val;
 }
 
+bool
+GtProcessComponent::requiresFullSourceData() const
+{
+    return pimpl->fullSourceData;
+}
+
+void
+GtProcessComponent::setRequiresFullSourceData(bool val)
+{
+    pimpl->fullSourceData = val;
+}
+
 QString
 GtProcessComponent::dataHelper(GtObjectLinkProperty& prop) const
 {
@@ -81,6 +81,15 @@ public:
      */
     void setSkipped(bool val);
 
+    /**
+     * @brief Returns true if the process component needs the complete source
+     * data of the project. By default, only the objects referenced via object
+     * link, object path and relative object link properties are transferred
+     * to the runnable.
+     * @return Whether the complete source data is required.
+     */
+    bool requiresFullSourceData() const;
+
     /**
      * @brief Sets current state of process component. Is always set to SKIPPED
      * if skipped indicator is active.
@@ -310,6 +319,14 @@ protected:
      */
     void setWarningFlag(bool val);
 
+    /**
+     * @brief Declares that the process component needs the complete source
+     * data of the project, e.g. because it accesses objects that are not
+     * referenced by its properties. Should be called in the constructor.
+     * @param val Whether the complete source data is required.
+     */
+    void setRequiresFullSourceData(bool val);
+
     /**
      * @brief Returns uuid string of given object link property.
      * @param prop Object link property.
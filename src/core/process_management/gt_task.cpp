@@ -16,11 +16,23 @@
 #include "gt_objectlinkproperty.h"
 #include "gt_objectpathproperty.h"
 #include "gt_processrunnerglobals.h"
+#include "gt_propertyconnection.h"
+#include "gt_settings.h"
+#include "gt_externalizationmanager.h"
+#include "internal/gt_externalizationprefetcher.h"
+#include "internal/gt_isolatedprocessrun.h"
 
 #include <QDebug>
+#include <QDir>
+#include <QMutex>
+#include <QPair>
+#include <QSet>
 #include <QThreadPool>
+#include <QWaitCondition>
 
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 struct GtTask::Impl
 {
@@ -42,8 +54,152 @@ struct GtTask::Impl
         gt::process_runner::S_ACCESS_ID,
         tr("Process Runner to run task with. Only relevant for the root task")
     };
+
+    /// Parallel execution of independent child elements
+    GtBoolProperty parallelExecution{
+        "parallelExecution", tr("Parallel Execution"),
+        tr("Execute independent child elements in parallel"), false
+    };
 };
 
+namespace
+{
+
+/// Returns whether the monitoring data should be streamed into a history
+/// file
+bool
+monitoringHistoryEnabled()
+{
+    QByteArray const env = qgetenv("GTLAB_MONITORING_HISTORY");
+
+    if (!env.isEmpty()) return env != "0";
+
+    return gtApp && gtApp->settings() && gtApp->settings()->monitoringHistory();
+}
+
+/// Returns a prefetcher for the externalized data of the calculators or
+/// null if there is nothing to prefetch
+std::unique_ptr<GtExternalizationPrefetcher>
+createPrefetcher(QList<GtProcessComponent*> const& childs,
+                 GtAbstractRunnable* runnable)
+{
+    if (!runnable || childs.size() < 2 ||
+        !gtExternalizationManager->isExternalizationEnabled() ||
+        GtExternalizationPrefetcher::defaultWindow() < 1)
+    {
+        return nullptr;
+    }
+
+    QList<QList<GtExternalizedObject*>> steps;
+    bool empty = true;
+
+    for (GtProcessComponent* comp : childs)
+    {
+        // nested tasks prefetch the data of their own children
+        auto* calc = qobject_cast<GtCalculator*>(comp);
+        if (!calc || calc->isSkipped())
+        {
+            steps.append({});
+            continue;
+        }
+
+        steps.append(
+            GtExternalizationPrefetcher::externalizedObjects(*calc, *runnable));
+        empty &= steps.last().isEmpty();
+    }
+
+    if (empty) return nullptr;
+
+    return std::make_unique<GtExternalizationPrefetcher>(steps);
+}
+
+/// Objects and property connections a process component accesses
+struct DataAccess
+{
+    QList<GtObject*> objects;
+    QSet<QString> read;
+    QSet<QString> write;
+};
+
+/// Returns true if obj is a (grand) child of parent
+bool
+isChildOf(GtObject const* obj, GtObject const* parent)
+{
+    for (obj = obj->parentObject(); obj; obj = obj->parentObject())
+    {
+        if (obj == parent) return true;
+    }
+    return false;
+}
+
+/// Returns true if the process components may not be executed concurrently
+bool
+conflicts(DataAccess const& a, DataAccess const& b)
+{
+    for (GtObject const* objA : a.objects)
+    {
+        for (GtObject const* objB : b.objects)
+        {
+            if (objA == objB || isChildOf(objA, objB) || isChildOf(objB, objA))
+            {
+                return true;
+            }
+        }
+    }
+
+    return a.write.intersects(b.write) ||
+           a.write.intersects(b.read) ||
+           b.write.intersects(a.read);
+}
+
+/// Queue of finished parallel jobs
+class FinishedJobs
+{
+public:
+    void push(int idx, bool success)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_jobs.append({idx, success});
+        m_condition.wakeAll();
+    }
+
+    QPair<int, bool> pop()
+    {
+        QMutexLocker locker(&m_mutex);
+        while (m_jobs.isEmpty())
+        {
+            m_condition.wait(&m_mutex);
+        }
+        return m_jobs.takeFirst();
+    }
+
+private:
+    QMutex m_mutex;
+    QWaitCondition m_condition;
+    QList<QPair<int, bool>> m_jobs;
+};
+
+/// Executes an isolated process run in a thread pool
+class IsolatedRunJob : public QRunnable
+{
+public:
+    IsolatedRunJob(GtIsolatedProcessRun& run, int idx, FinishedJobs& finished) :
+        m_run(run), m_idx(idx), m_finished(finished)
+    { }
+
+    void run() override
+    {
+        m_finished.push(m_idx, m_run.exec());
+    }
+
+private:
+    GtIsolatedProcessRun& m_run;
+    int m_idx;
+    FinishedJobs& m_finished;
+};
+
+} // namespace
+
 GtTask::GtTask() :
     m_maxIter(QStringLiteral("maxIter"),
               tr("Number Of Iterations"),
@@ -66,6 +222,7 @@ GtTask::GtTask() :
     qRegisterMetaType<GtMonitoringDataSet>("GtMonitoringDataSet");
 
     registerProperty(pimpl->processRunner, tr("Execution"));
+    registerProperty(pimpl->parallelExecution, tr("Execution"));
 
     pimpl->processRunner.hide(!gtApp || !gtApp->devMode());
 }
@@ -375,35 +532,56 @@ GtTask::runChildElements()
     qDebug() << "running calculators...";
 
     // run calculators
-    foreach (GtProcessComponent* comp, childs)
+    if (pimpl->parallelExecution && childs.size() > 1)
     {
-        if (!comp->exec())
+        if (!runChildElementsInParallel(childs))
         {
-            // calculator run failed
-            setState(GtProcessComponent::FAILED);
-
-            qDebug() << "   |-> run failed!";
-
             return false;
         }
+    }
+    else
+    {
+        std::unique_ptr<GtExternalizationPrefetcher> prefetcher =
+            createPrefetcher(childs, runnable());
 
-        if (isInterruptionRequested())
+        for (int i = 0; i < childs.size(); ++i)
         {
-            gtWarning() << "task terminated!";
-            setState(GtProcessComponent::TERMINATED);
-            return false;
-        }
+            GtProcessComponent* comp = childs[i];
 
-        GtCalculator* calc = qobject_cast<GtCalculator*>(comp);
+            if (prefetcher) prefetcher->beginStep(i);
 
-        if (calc && calc->runFailsOnWarning())
-        {
-            if (calc->currentState() == GtProcessComponent::WARN_FINISHED)
+            bool const success = comp->exec();
+
+            if (prefetcher) prefetcher->endStep(i);
+
+            if (!success)
             {
-                calc->setState(FAILED);
+                // calculator run failed
                 setState(GtProcessComponent::FAILED);
+
+                qDebug() << "   |-> run failed!";
+
                 return false;
             }
+
+            if (isInterruptionRequested())
+            {
+                gtWarning() << "task terminated!";
+                setState(GtProcessComponent::TERMINATED);
+                return false;
+            }
+
+            GtCalculator* calc = qobject_cast<GtCalculator*>(comp);
+
+            if (calc && calc->runFailsOnWarning())
+            {
+                if (calc->currentState() == GtProcessComponent::WARN_FINISHED)
+                {
+                    calc->setState(FAILED);
+                    setState(GtProcessComponent::FAILED);
+                    return false;
+                }
+            }
         }
     }
 
@@ -427,6 +605,166 @@ GtTask::runChildElements()
     return true;
 }
 
+bool
+GtTask::runChildElementsInParallel(QList<GtProcessComponent*> const& childs)
+{
+    auto runnable = this->runnable();
+    if (!runnable)
+    {
+        setState(GtProcessComponent::FAILED);
+        return false;
+    }
+
+    int const n = childs.size();
+
+    // analyse the data accessed by the child elements
+    QVector<DataAccess> access(n);
+
+    for (int i = 0; i < n; ++i)
+    {
+        access[i].objects =
+            GtIsolatedProcessRun::linkedObjects(*childs[i], *runnable);
+    }
+
+    GtTask* root = rootTask();
+    auto const connections = (root ? root : this)->collectPropertyConnections();
+
+    for (GtPropertyConnection const* con : connections)
+    {
+        QString const source = con->sourceUuid() + '/' + con->sourceProp();
+        QString const target = con->targetUuid() + '/' + con->targetProp();
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (childs[i]->getObjectByUuid(con->sourceUuid()))
+            {
+                access[i].write << source << target;
+            }
+            if (childs[i]->getObjectByUuid(con->targetUuid()))
+            {
+                access[i].read << source << target;
+            }
+        }
+    }
+
+    // build dependency graph. Dependent elements keep their order
+    QVector<QVector<int>> successors(n);
+    QVector<int> predecessors(n, 0);
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = i + 1; j < n; ++j)
+        {
+            if (conflicts(access[i], access[j]))
+            {
+                successors[i].append(j);
+                ++predecessors[j];
+            }
+        }
+    }
+
+    QList<int> ready;
+    for (int i = 0; i < n; ++i)
+    {
+        if (predecessors[i] == 0) ready.append(i);
+    }
+
+    gtDebug().medium() << tr("%1: %2 of %3 process elements can be started "
+                             "in parallel")
+                              .arg(objectName()).arg(ready.size()).arg(n);
+
+    std::vector<std::unique_ptr<GtIsolatedProcessRun>> runs(n);
+    FinishedJobs finished;
+    // the pool must be destroyed first, to wait for all jobs
+    QThreadPool pool;
+
+    int running = 0;
+    bool success = true;
+
+    while (true)
+    {
+        // start all elements whose dependencies are finished
+        while (success && !isInterruptionRequested() && !ready.isEmpty())
+        {
+            int const idx = ready.takeFirst();
+
+            runs[idx] = std::make_unique<GtIsolatedProcessRun>(
+                QList<GtProcessComponent*>{childs[idx]}, *runnable);
+
+            childs[idx]->setState(GtProcessComponent::RUNNING);
+
+            pool.start(new IsolatedRunJob(*runs[idx], idx, finished));
+            ++running;
+        }
+
+        if (running == 0) break;
+
+        // wait for the next element and merge its results
+        QPair<int, bool> result = finished.pop();
+        --running;
+
+        int const idx = result.first;
+        GtProcessComponent* comp = childs[idx];
+
+        if (!runs[idx]->merge())
+        {
+            gtError() << tr("Could not merge results of '%1'!")
+                             .arg(comp->objectName());
+            result.second = false;
+        }
+
+        gtInfo().medium() << tr("%1 finished (took %2 ms)")
+                                 .arg(comp->objectName())
+                                 .arg(runs[idx]->timings().value(0));
+
+        runs[idx].reset();
+
+        // trigger transfer of monitoring properties
+        emit comp->transferMonitoringProperties();
+
+        if (!result.second)
+        {
+            qDebug() << "   |-> run failed!";
+            success = false;
+            continue;
+        }
+
+        auto* calc = qobject_cast<GtCalculator*>(comp);
+
+        if (calc && calc->runFailsOnWarning() &&
+            calc->currentState() == GtProcessComponent::WARN_FINISHED)
+        {
+            calc->setState(FAILED);
+            success = false;
+            continue;
+        }
+
+        for (int succ : qAsConst(successors[idx]))
+        {
+            if (--predecessors[succ] == 0)
+            {
+                ready.insert(std::lower_bound(ready.begin(), ready.end(), succ),
+                             succ);
+            }
+        }
+    }
+
+    if (!success)
+    {
+        setState(GtProcessComponent::FAILED);
+        return false;
+    }
+
+    if (isInterruptionRequested())
+    {
+        gtWarning() << "task terminated!";
+        setState(GtProcessComponent::TERMINATED);
+        return false;
+    }
+
+    return true;
+}
+
 GtMonitoringDataSet
 GtTask::collectMonitoringData()
 {
@@ -460,6 +798,18 @@ GtTask::isInterruptionRequested() const
     return static_cast<int>(pimpl->interrupt);
 }
 
+bool
+GtTask::parallelExecution() const
+{
+    return pimpl->parallelExecution;
+}
+
+void
+GtTask::setParallelExecution(bool val)
+{
+    pimpl->parallelExecution = val;
+}
+
 void
 GtTask::collectMonitoringDataHelper(GtMonitoringDataSet& map,
                                     GtProcessComponent* component)
@@ -604,5 +954,20 @@ GtTask::onMonitoringDataAvailable(int iteration, GtMonitoringDataSet const& set)
 void
 GtTask::clearMonitoringData()
 {
-    pimpl->monitoringDataTable.clear();
+    GtMonitoringDataTable& table = pimpl->monitoringDataTable;
+
+    // long running loops keep only the most recent iterations in memory
+    if (table.historyFile().isEmpty() && monitoringHistoryEnabled())
+    {
+        QDir dir = GtCoreApplication::applicationTempDir();
+        dir.mkpath(QStringLiteral("monitoring"));
+
+        QString const filePath = dir.absoluteFilePath(
+            QStringLiteral("monitoring/%1.gtmon").arg(uuid()));
+
+        // the table is cleared by attaching the file
+        if (table.setHistoryFile(filePath)) return;
+    }
+
+    table.clear();
 }
@@ -154,6 +154,23 @@ public:
      */
     bool isInterruptionRequested() const;
 
+    /**
+     * @brief Returns whether independent child elements are executed in
+     * parallel.
+     * @return Parallel execution state
+     */
+    bool parallelExecution() const;
+
+    /**
+     * @brief Enables or disables the parallel execution of independent child
+     * elements. Child elements depend on each other if they link to the same
+     * objects (or to parents/children of each other) or if they are connected
+     * via property connections. Dependent elements are executed in the order
+     * of the task.
+     * @param val New parallel execution state
+     */
+    void setParallelExecution(bool val);
+
 public slots:
     /**
      * @brief Called when monitoring data is available.
@@ -164,7 +181,9 @@ public slots:
                                    const GtMonitoringDataSet& set);
 
     /**
-     * @brief Clears entire monitoring data.
+     * @brief Clears entire monitoring data. If the monitoring history is
+     * enabled (see GtSettings::monitoringHistory), the data of the next run
+     * is streamed into a history file in the temporary directory.
      */
     void clearMonitoringData();
 
@@ -228,6 +247,16 @@ private:
     void collectPropertyConnectionHelper(QList<GtPropertyConnection*>& list,
                                          GtProcessComponent* component);
 
+    /**
+     * @brief Executes the given child elements in parallel. Each element is
+     * executed isolated from the datamodel of the runnable in a worker thread
+     * as soon as all elements it depends on are finished. Changed data is
+     * merged back after each element.
+     * @param childs Child elements to execute
+     * @return Whether all child elements were executed successfully
+     */
+    bool runChildElementsInParallel(QList<GtProcessComponent*> const& childs);
+
     /**
      * @brief Returns whether one of the children has warnings.
      * @return True if one of the children has warnings.
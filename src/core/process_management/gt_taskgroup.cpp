@@ -23,6 +23,7 @@
 #include "gt_qtutilities.h"
 #include "gt_task.h"
 #include "gt_objectfactory.h"
+#include "gt_objectmemento.h"
 #include "gt_xmlutilities.h"
 #include "internal/gt_platformspecifics.h"
 
@@ -539,10 +540,7 @@ GtTaskGroup::Impl::saveTaskToFile(const GtTask* task, const QString& groupPath)
                    S_TASK_FILE_EXT);
 
 
-    QDomDocument doc;
-    doc.setContent(task->toMemento().toByteArray());
-
-    if (!gt::xml::writeDomDocumentToFile(taskFile, doc, true))
+    if (!gt::xml::writeMementoToFile(taskFile, task->toMemento()))
     {
         gtError() << QObject::tr("Could not open file (%1)").arg(taskFile);
         return false;
@@ -11,18 +11,140 @@
 
 #include <QThreadPool>
 
+#include <algorithm>
+
 #include "gt_logging.h"
 #include "gt_processcomponent.h"
 #include "gt_task.h"
 #include "gt_abstractrunnable.h"
 #include "gt_processdata.h"
 #include "gt_objectlinkproperty.h"
+#include "gt_objectpath.h"
 #include "gt_processdata.h"
 #include "gt_labeldata.h"
 #include "gt_structproperty.h"
+#include "internal/gt_processlinks.h"
 
 #include "gt_taskrunner.h"
 
+namespace
+{
+
+/**
+ * @brief Collects the source objects referenced by the properties of the
+ * process component and its children. Only the top most objects are returned.
+ * @param comp Process component
+ * @param source Source object
+ * @param packages Top level source objects
+ * @param full Set to true if the complete source data is required
+ * @return Referenced source objects
+ */
+QList<GtObject*>
+referencedObjects(GtProcessComponent& comp, GtObject& source,
+                  QList<GtObject*> const& packages, bool& full)
+{
+    auto components = comp.findChildren<GtProcessComponent*>();
+    components.prepend(&comp);
+
+    for (GtProcessComponent const* pc : qAsConst(components))
+    {
+        if (pc->requiresFullSourceData())
+        {
+            full = true;
+            return {};
+        }
+    }
+
+    // the references may point into linked objects, that were not loaded
+    // yet
+    auto findByUuid = [&source](QString const& uuid) {
+        return source.materializeObjectByUuid(uuid);
+    };
+
+    // object paths start at the top level source objects
+    auto findByPath = [&packages](GtObjectPath const& path) -> GtObject* {
+        for (GtObject* package : packages)
+        {
+            if (GtObject* obj =
+                    package->materializeObjectByPath(path.toString()))
+            {
+                return obj;
+            }
+        }
+        return nullptr;
+    };
+
+    QList<GtObject*> const objects =
+        gt::detail::referencedObjects(comp, findByUuid, findByPath);
+
+    if (objects.contains(&source))
+    {
+        full = true;
+        return {};
+    }
+
+    // remove objects contained in other referenced objects
+    QList<GtObject*> retval;
+
+    for (GtObject* obj : qAsConst(objects))
+    {
+        bool nested = false;
+
+        for (GtObject* p = obj->parentObject(); p && !nested;
+             p = p->parentObject())
+        {
+            nested = objects.contains(p);
+        }
+
+        if (!nested) retval.append(obj);
+    }
+
+    return retval;
+}
+
+/**
+ * @brief Creates a memento of the object, which only contains the given
+ * subtrees completely. All other objects on the way to the subtrees are
+ * reduced to stubs without properties.
+ * @param obj Object
+ * @param subtrees Complete subtrees
+ * @return Partial memento
+ */
+GtObjectMemento
+partialMemento(GtObject const& obj, QList<GtObject*> const& subtrees)
+{
+    if (subtrees.contains(const_cast<GtObject*>(&obj)))
+    {
+        return obj.toMemento();
+    }
+
+    GtObjectMemento stub;
+    stub.setClassName(obj.metaObject()->className());
+    stub.setUuid(obj.uuid());
+    stub.setIdent(obj.objectName());
+
+    for (GtObject const* child : obj.findDirectChildren<GtObject*>())
+    {
+        bool const needed = std::any_of(subtrees.begin(), subtrees.end(),
+                                        [child](GtObject const* subtree) {
+            for (GtObject const* o = subtree; o; o = o->parentObject())
+            {
+                if (o == child) return true;
+            }
+            return false;
+        });
+
+        if (needed)
+        {
+            stub.childObjects.append(partialMemento(*child, subtrees));
+        }
+    }
+
+    return stub;
+}
+
+} // namespace
+
 GtTaskRunner::GtTaskRunner(GtTask* task) : m_task(task), m_runnable(nullptr),
     m_source(nullptr)
 {
@@ -72,7 +194,8 @@ GtTaskRunner::setUp(GtAbstractRunnable* runnable, GtObject* source)
     // clear component mapping
     m_componentMap.clear();
 
-    // transfer source meta data to runnable
+    QList<GtObject*> packages;
+
     foreach (GtObject* srcObj, m_source->findDirectChildren<GtObject*>())
     {
         if (qobject_cast<GtProcessData*>(srcObj))
@@ -85,7 +208,47 @@ GtTaskRunner::setUp(GtAbstractRunnable* runnable, GtObject* source)
             continue;
         }
 
-        m_runnable->appendSourceData(srcObj->toMemento());
+        packages.append(srcObj);
+    }
+
+    // collect the source objects referenced by the task
+    bool full = false;
+    QList<GtObject*> const referenced =
+        referencedObjects(*m_task, *m_source, packages, full);
+
+    // the lookups of the references loaded the linked objects on the way,
+    // only the referenced subtrees have to be loaded completely
+    for (GtObject* obj : full ? packages : referenced)
+    {
+        obj->materializeAll();
+    }
+
+    // transfer source meta data to runnable
+    for (GtObject* package : qAsConst(packages))
+    {
+        if (full || referenced.contains(package))
+        {
+            m_runnable->appendSourceData(package->toMemento());
+            continue;
+        }
+
+        // only the referenced subtrees and stubs of their parents are needed
+        QList<GtObject*> subtrees;
+        QStringList uuids;
+
+        for (GtObject* obj : referenced)
+        {
+            if (package->getObjectByUuid(obj->uuid()) == obj)
+            {
+                subtrees.append(obj);
+                uuids.append(obj->uuid());
+            }
+        }
+
+        if (subtrees.isEmpty()) continue;
+
+        m_runnable->appendPartialSourceData(partialMemento(*package, subtrees),
+                                            uuids);
     }
 
     GtTask* taskCopy = cloneTask();
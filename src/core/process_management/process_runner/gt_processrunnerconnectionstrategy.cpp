@@ -49,6 +49,25 @@ GtProcessRunnerConnectionStrategy::setTargetAddress(
     m_targetAddress = std::move(address);
 }
 
+void
+GtProcessRunnerConnectionStrategy::setMementoFormat(
+        GtObjectMemento::Format format)
+{
+    m_format = format;
+}
+
+GtObjectMemento::Format
+GtProcessRunnerConnectionStrategy::mementoFormat() const
+{
+    return m_format;
+}
+
+QByteArray
+GtProcessRunnerConnectionStrategy::serialize(const GtObject& obj) const
+{
+    return obj.toMemento().toByteArray(m_format);
+}
+
 bool
 GtProcessRunnerConnectionStrategy::hasResponse() const
 {
@@ -14,7 +14,9 @@
 #include "gt_eventloop.h"
 #include "gt_core_exports.h"
 #include "gt_processrunnerglobals.h"
+#include "gt_objectmemento.h"
 
+#include <atomic>
 #include <memory>
 #include <QQueue>
 #include <QMutex>
@@ -72,6 +74,29 @@ public:
      */
     void setTargetAddress(gt::process_runner::ConnectionAddress address);
 
+    /**
+     * @brief Sets the memento format used to serialize the data written to
+     * the connection. Incoming data is always accepted in both formats.
+     * The binary format should only be used if the peer supports it.
+     * @param format Memento format
+     */
+    void setMementoFormat(GtObjectMemento::Format format);
+
+    /**
+     * @brief Returns the memento format used to serialize the data written to
+     * the connection.
+     * @return Memento format
+     */
+    GtObjectMemento::Format mementoFormat() const;
+
+    /**
+     * @brief Serializes the object using the memento format of the
+     * connection.
+     * @param obj Object to serialize (e.g. a command or a response)
+     * @return Serialized object
+     */
+    QByteArray serialize(GtObject const& obj) const;
+
     /**
      * @brief Whether the connection has pending responses
      * @return has responses
@@ -179,6 +204,8 @@ private:
     mutable QMutex m_mutex{};
     /// Data for the next/current connection
     gt::process_runner::ConnectionAddress m_targetAddress;
+    /// Format of the data written to the connection
+    std::atomic<GtObjectMemento::Format> m_format{GtObjectMemento::Format::Xml};
 
     /**
      * @brief Queues the response
@@ -116,6 +116,25 @@ GtProcessRunnerTcpConnection::onRead()
     // remove data from buffer
     m_buffer.remove(0, captured.size() + size);
 
+    if (GtObjectMemento::isBinary(data))
+    {
+        GtObjectMemento memento{data};
+        if (memento.isNull())
+        {
+            gtWarningId("TCP") << tr("Failed to parse binary data!");
+            return;
+        }
+
+        // the peer supports the binary format, reply using the same format
+        setMementoFormat(GtObjectMemento::Format::Binary);
+
+        queueData(std::unique_ptr<GtObject>(
+            memento.restore(&gtProcessRunnerCommandFactory)));
+
+        // parse pending commands in buffer
+        return onRead();
+    }
+
     // data may not be complete yet
     QDomDocument doc;
     QString errMsg;
@@ -76,6 +76,12 @@ struct GtSettings::Impl
     /// Whether to autostart the process runner
     GtSettingsItem* m_autostartProcessRunner;
 
+    /// Whether to dump the results of a task for diagnostic purposes
+    GtSettingsItem* m_dumpProcessResults;
+
+    /// Whether to stream the monitoring data of tasks into a file
+    GtSettingsItem* m_monitoringHistory;
+
     /// User module directories
     GtSettingsItem* userModuleDirs;
 };
@@ -147,6 +153,13 @@ GtSettings::GtSettings()
 
     pimpl->m_autostartProcessRunner = registerSetting(
                 QStringLiteral("application/process_runner/autostart"), false);
+
+    pimpl->m_dumpProcessResults = registerSetting(
+                QStringLiteral("application/process/dump_results"), false);
+
+    pimpl->m_monitoringHistory = registerSetting(
+                QStringLiteral("application/process/monitoring_history"),
+                false);
 }
 
 QList<GtShortCutSettingsData>
@@ -469,6 +482,30 @@ GtSettings::setAutostartProcessRunner(bool value)
     return pimpl->m_autostartProcessRunner->setValue(value);
 }
 
+bool
+GtSettings::dumpProcessResults() const
+{
+    return pimpl->m_dumpProcessResults->getValue().toBool();
+}
+
+void
+GtSettings::setDumpProcessResults(bool value)
+{
+    return pimpl->m_dumpProcessResults->setValue(value);
+}
+
+bool
+GtSettings::monitoringHistory() const
+{
+    return pimpl->m_monitoringHistory->getValue().toBool();
+}
+
+void
+GtSettings::setMonitoringHistory(bool value)
+{
+    return pimpl->m_monitoringHistory->setValue(value);
+}
+
 QStringList
 GtSettings::userModuleDirs() const
 {
@@ -381,6 +381,36 @@ public:
      */
     void setAutostartProcessRunner(bool value);
 
+    /**
+     * @brief Whether the results of a task are dumped into the temporary
+     * directory for diagnostic purposes when merging them into the datamodel.
+     * Can also be enabled with the environment variable
+     * GTLAB_DUMP_PROCESS_RESULTS.
+     * @return Dump process results
+     */
+    bool dumpProcessResults() const;
+
+    /**
+     * @brief Setter for the dump process results property
+     * @param value Value
+     */
+    void setDumpProcessResults(bool value);
+
+    /**
+     * @brief Whether the monitoring data of tasks is streamed into a history
+     * file in the temporary directory, keeping only the most recent
+     * iterations in memory. Can also be enabled with the environment variable
+     * GTLAB_MONITORING_HISTORY.
+     * @return Monitoring history
+     */
+    bool monitoringHistory() const;
+
+    /**
+     * @brief Setter for the monitoring history property
+     * @param value Value
+     */
+    void setMonitoringHistory(bool value);
+
     /**
      * @brief Returns the module directories defined by the user
      */
@@ -17,3 +17,15 @@ GtAbstractExternalizationInterface::GtAbstractExternalizationInterface()
 {
     gtExternalizationManager->registerExernalizationInterface(this);
 }
+
+void
+GtAbstractExternalizationInterface::beginBatch()
+{
+    // nothing to do here
+}
+
+void
+GtAbstractExternalizationInterface::endBatch()
+{
+    // nothing to do here
+}
@@ -32,6 +32,18 @@ public:
      */
     virtual void onProjectLoaded(const QString& projectDir) = 0;
 
+    /**
+     * @brief Called when a batch of externalization operations begins (e.g.
+     * when saving the project). Interfaces may keep resources open until the
+     * batch ends. Batches may be nested.
+     */
+    virtual void beginBatch();
+
+    /**
+     * @brief Called when a batch of externalization operations ends.
+     */
+    virtual void endBatch();
+
 protected:
 
     /**
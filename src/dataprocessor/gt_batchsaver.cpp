@@ -15,6 +15,7 @@
 #include <QTextStream>
 #include <QFile>
 #include <QFileInfo>
+#include <QXmlStreamWriter>
 
 #include <functional>
 
@@ -274,6 +275,32 @@ GtBatchSaver::addXml(const QString& targetPath, const QDomDocument& doc,
     });
 }
 
+void
+GtBatchSaver::addXml(const QString& targetPath,
+                     const std::function<bool(QXmlStreamWriter&)>& writer)
+{
+    addOp(targetPath, [writer](QIODevice& dev) -> bool {
+        QXmlStreamWriter str_w(&dev);
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+        str_w.setCodec("UTF-8");
+#endif
+
+        str_w.setAutoFormatting(true);
+
+        str_w.writeStartDocument(QStringLiteral("1.0"));
+
+        if (!writer(str_w))
+        {
+            return false;
+        }
+
+        str_w.writeEndDocument();
+
+        return !str_w.hasError();
+    });
+}
+
 void
 GtBatchSaver::addBinary(const QString& targetPath, const QByteArray& data)
 {
@@ -20,6 +20,8 @@
 
 #include <functional>
 
+class QXmlStreamWriter;
+
 /**
  * @brief Helper class to perform atomic, all-or-nothing file saves with backups.
  *
@@ -107,6 +109,22 @@ public:
     void addXml(const QString& targetPath, const QDomDocument& doc,
                 bool attrOrdered);
 
+    /**
+     * @brief Convenience method to add an XML file to the batch, which is
+     * streamed without building a QDomDocument first.
+     *
+     * @param targetPath Target file path for the XML.
+     * @param writer     Callback that writes the root element into the given
+     *                   stream writer.
+     *
+     * The stream writer is set up like for a QDomDocument with ordered
+     * attributes. The XML declaration and the end of the document are written
+     * around the callback during commit(). If @p writer returns false,
+     * commit() fails and the target file is not changed.
+     */
+    void addXml(const QString& targetPath,
+                const std::function<bool(QXmlStreamWriter&)>& writer);
+
     /**
      * @brief Convenience method to add raw binary data to the batch.
      *
@@ -17,8 +17,80 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QThread>
 
-GtExternalizationManager::GtExternalizationManager() = default;
+#include <algorithm>
+#include <list>
+
+namespace
+{
+
+/**
+ * @brief Sorts the objects by their class name and uuid. Objects of the same
+ * class share a group in the externalized data. Null objects are removed.
+ * @param objects Objects to sort
+ */
+void
+sortByDataGroup(QList<GtExternalizedObject*>& objects)
+{
+    objects.removeAll(nullptr);
+
+    std::sort(objects.begin(), objects.end(),
+              [](GtExternalizedObject const* a, GtExternalizedObject const* b){
+        int cmp = qstrcmp(a->metaObject()->className(),
+                          b->metaObject()->className());
+        return cmp != 0 ? cmp < 0 : a->uuid() < b->uuid();
+    });
+}
+
+} // namespace
+
+struct GtExternalizationManager::Impl
+{
+    /// Fetched data of an object
+    struct Entry
+    {
+        GtExternalizedObject* obj;
+        qint64 size;
+    };
+
+    /// guards the fetched data
+    mutable QMutex mutex;
+
+    /// serializes the file access
+    std::recursive_mutex fileMutex;
+
+    /// whether the file access is redirected to the scratch data. Only
+    /// accessed while the file access is locked
+    bool scratchAccess{false};
+
+    /// fetched data, least recently used first
+    std::list<Entry> lru;
+
+    /// positions of the objects in the lru list
+    QHash<GtExternalizedObject const*, std::list<Entry>::iterator> entries;
+
+    /// statistics, the size and the number of fetched objects are updated
+    /// on request
+    MemoryStatistics stats;
+
+    /// total size of the fetched data
+    qint64 fetchedSize{0};
+
+    /// memory budget in bytes
+    qint64 budget{
+        qEnvironmentVariableIntValue("GTLAB_EXTERNALIZATION_MEMORY_BUDGET") *
+        qint64{1024 * 1024}
+    };
+};
+
+GtExternalizationManager::GtExternalizationManager() :
+    pimpl(std::make_unique<Impl>())
+{ }
+
+GtExternalizationManager::~GtExternalizationManager() = default;
 
 GtExternalizationManager*
 GtExternalizationManager::instance()
@@ -87,6 +159,270 @@ GtExternalizationManager::registerExernalizationInterface(
     m_externalizationInterfaces.append(interface);
 }
 
+void
+GtExternalizationManager::beginBatch()
+{
+    // the interfaces open and close their shared files
+    auto lock = lockFileAccess();
+
+    for (auto const& interface : qAsConst(m_externalizationInterfaces))
+    {
+        if (interface) interface->beginBatch();
+    }
+}
+
+void
+GtExternalizationManager::endBatch()
+{
+    auto lock = lockFileAccess();
+
+    for (auto const& interface : qAsConst(m_externalizationInterfaces))
+    {
+        if (interface) interface->endBatch();
+    }
+}
+
+std::unique_lock<std::recursive_mutex>
+GtExternalizationManager::lockFileAccess()
+{
+    return std::unique_lock<std::recursive_mutex>{pimpl->fileMutex};
+}
+
+bool
+GtExternalizationManager::isScratchAccess() const
+{
+    return pimpl->scratchAccess;
+}
+
+GtExternalizationManager::ScratchAccess::ScratchAccess(bool enable) :
+    m_previous(instance()->pimpl->scratchAccess)
+{
+    instance()->pimpl->scratchAccess = m_previous || enable;
+}
+
+GtExternalizationManager::ScratchAccess::~ScratchAccess()
+{
+    instance()->pimpl->scratchAccess = m_previous;
+}
+
+bool
+GtExternalizationManager::externalize(QList<GtExternalizedObject*> objects)
+{
+    sortByDataGroup(objects);
+
+    Batch batch;
+
+    bool success = true;
+    for (auto* obj : qAsConst(objects))
+    {
+        success &= obj->externalize();
+    }
+
+    return success;
+}
+
+bool
+GtExternalizationManager::fetch(QList<GtExternalizedObject*> objects)
+{
+    sortByDataGroup(objects);
+
+    Batch batch;
+
+    bool success = true;
+    for (auto* obj : qAsConst(objects))
+    {
+        success &= obj->fetch();
+    }
+
+    return success;
+}
+
+QVector<QVariant>
+GtExternalizationManager::readData(
+        QList<GtExternalizedObject*> const& objects)
+{
+    Batch batch;
+
+    QVector<QVariant> buffers(objects.size());
+    for (int i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i]) objects[i]->readData(buffers[i]);
+    }
+
+    return buffers;
+}
+
+bool
+GtExternalizationManager::fetch(QList<GtExternalizedObject*> const& objects,
+                                QVector<QVariant> buffers)
+{
+    Q_ASSERT(objects.size() == buffers.size());
+
+    bool success = true;
+    for (int i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i]) success &= objects[i]->fetch(buffers[i]);
+    }
+
+    return success;
+}
+
+qint64
+GtExternalizationManager::memoryBudget() const
+{
+    QMutexLocker locker{&pimpl->mutex};
+    return pimpl->budget;
+}
+
+void
+GtExternalizationManager::setMemoryBudget(qint64 bytes)
+{
+    {
+        QMutexLocker locker{&pimpl->mutex};
+        pimpl->budget = std::max(bytes, qint64{0});
+    }
+
+    enforceMemoryBudget();
+}
+
+GtExternalizationManager::MemoryStatistics
+GtExternalizationManager::memoryStatistics() const
+{
+    QMutexLocker locker{&pimpl->mutex};
+
+    MemoryStatistics stats = pimpl->stats;
+    stats.fetchedSize = pimpl->fetchedSize;
+    stats.fetchedObjects = pimpl->entries.size();
+    stats.budget = pimpl->budget;
+
+    return stats;
+}
+
+void
+GtExternalizationManager::resetMemoryStatistics()
+{
+    QMutexLocker locker{&pimpl->mutex};
+    pimpl->stats = {};
+}
+
+void
+GtExternalizationManager::enforceMemoryBudget()
+{
+    if (!isExternalizationEnabled())
+    {
+        return;
+    }
+
+    QThread* thread = QThread::currentThread();
+
+    // collect candidates first, as evicting an object updates the list
+    QVector<QPointer<GtExternalizedObject>> candidates;
+    {
+        QMutexLocker locker{&pimpl->mutex};
+
+        qint64 excess = pimpl->fetchedSize - pimpl->budget;
+        if (pimpl->budget <= 0 || excess <= 0)
+        {
+            return;
+        }
+
+        for (auto const& entry : pimpl->lru)
+        {
+            if (excess <= 0) break;
+
+            // evicting objects of unknown size does not reduce the excess
+            if (entry.size <= 0) continue;
+
+            if (entry.obj->thread() != thread || !entry.obj->canEvict())
+            {
+                continue;
+            }
+
+            candidates.append(entry.obj);
+            excess -= entry.size;
+        }
+    }
+
+    int evicted = 0;
+    for (auto const& obj : qAsConst(candidates))
+    {
+        if (!obj) continue;
+
+        qint64 size = 0;
+        {
+            QMutexLocker locker{&pimpl->mutex};
+            auto iter = pimpl->entries.find(obj.data());
+            if (iter == pimpl->entries.end()) continue;
+            size = iter.value()->size;
+        }
+
+        bool writtenBack = false;
+        if (!obj->evict(writtenBack))
+        {
+            continue;
+        }
+
+        evicted += 1;
+
+        QMutexLocker locker{&pimpl->mutex};
+        pimpl->stats.evictedObjects += 1;
+        pimpl->stats.evictedSize += size;
+        pimpl->stats.writtenBackObjects += writtenBack;
+    }
+
+    if (evicted > 0)
+    {
+        gtDebug().medium() << tr("Evicted %1 externalized objects to meet "
+                                 "the memory budget").arg(evicted);
+    }
+}
+
+void
+GtExternalizationManager::onDataFetched(GtExternalizedObject* obj,
+                                        qint64 size)
+{
+    QMutexLocker locker{&pimpl->mutex};
+
+    auto iter = pimpl->entries.find(obj);
+    if (iter != pimpl->entries.end())
+    {
+        pimpl->fetchedSize -= iter.value()->size;
+        pimpl->lru.erase(iter.value());
+    }
+
+    pimpl->lru.push_back({obj, size});
+    pimpl->entries.insert(obj, std::prev(pimpl->lru.end()));
+    pimpl->fetchedSize += size;
+}
+
+void
+GtExternalizationManager::onDataCleared(GtExternalizedObject* obj)
+{
+    QMutexLocker locker{&pimpl->mutex};
+
+    auto iter = pimpl->entries.find(obj);
+    if (iter == pimpl->entries.end())
+    {
+        return;
+    }
+
+    pimpl->fetchedSize -= iter.value()->size;
+    pimpl->lru.erase(iter.value());
+    pimpl->entries.erase(iter);
+}
+
+bool
+GtExternalizationManager::release(const QList<GtExternalizedObject*>& objects)
+{
+    bool success = true;
+    for (auto* obj : objects)
+    {
+        if (obj) success &= obj->release();
+    }
+
+    return success;
+}
+
 void
 GtExternalizationManager::setProjectDir(QString projectDir)
 {
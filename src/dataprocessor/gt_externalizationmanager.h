@@ -16,12 +16,16 @@
 #include "gt_datamodel_exports.h"
 #include "gt_abstractexternalizationinterface.h"
 
+#include <QList>
 #include <QObject>
 #include <QString>
 #include <QVector>
 #include <QVariant>
 #include <QPointer>
 
+#include <memory>
+#include <mutex>
+
 #define gtExternalizationManager (GtExternalizationManager::instance())
 
 class GtObject;
@@ -39,6 +43,61 @@ class GT_DATAMODEL_EXPORT GtExternalizationManager : public QObject
 
 public:
 
+    /**
+     * @brief The Batch class. Groups externalization operations for its
+     * lifetime, e.g. the externalization interfaces may keep files open
+     * in between the operations. Uses RAII.
+     */
+    class Batch
+    {
+    public:
+        Batch() { GtExternalizationManager::instance()->beginBatch(); }
+        ~Batch() { GtExternalizationManager::instance()->endBatch(); }
+
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+    };
+
+    /**
+     * @brief The ScratchAccess class. Redirects the file operations to the
+     * scratch data of the session for its lifetime (see isScratchAccess).
+     * The file access must be locked meanwhile (see lockFileAccess). Uses
+     * RAII.
+     */
+    class GT_DATAMODEL_EXPORT ScratchAccess
+    {
+    public:
+        explicit ScratchAccess(bool enable = true);
+        ~ScratchAccess();
+
+        ScratchAccess(const ScratchAccess&) = delete;
+        ScratchAccess& operator=(const ScratchAccess&) = delete;
+
+    private:
+        bool m_previous;
+    };
+
+    /**
+     * @brief Statistics of the fetched data, e.g. for monitoring the memory
+     * usage.
+     */
+    struct MemoryStatistics
+    {
+        /// size of the fetched data in bytes
+        qint64 fetchedSize{0};
+        /// number of fetched objects
+        int fetchedObjects{0};
+        /// memory budget in bytes, unlimited if 0
+        qint64 budget{0};
+        /// number of evicted objects
+        int evictedObjects{0};
+        /// size of the evicted data in bytes
+        qint64 evictedSize{0};
+        /// number of modified objects that were written to the scratch data
+        /// when evicted
+        int writtenBackObjects{0};
+    };
+
     /**
      * @brief instance
      * @return singleton instance
@@ -84,6 +143,124 @@ public:
      */
     void registerExernalizationInterface(ExternalizationInterface inter);
 
+    /**
+     * @brief Begins a batch of externalization operations. Must be followed
+     * by a call to endBatch. Prefer using the Batch class.
+     */
+    void beginBatch();
+
+    /**
+     * @brief Ends a batch of externalization operations.
+     */
+    void endBatch();
+
+    /**
+     * @brief Locks the file access of the externalized objects for the
+     * lifetime of the returned lock. The data of some objects may be read in
+     * a background thread (see readData), while other objects are fetched or
+     * externalized. The externalization interfaces share their file handles
+     * and the file formats (e.g. HDF5) do not support concurrent access,
+     * thus all file operations are serialized. The lock is recursive.
+     * @return Lock
+     */
+    std::unique_lock<std::recursive_mutex> lockFileAccess();
+
+    /**
+     * @brief Returns whether the current file operation accesses the scratch
+     * data of the session instead of the project data. Modified data, that
+     * is evicted to meet the memory budget, is stored in the scratch data
+     * until the project is saved. Thus, unsaved changes never end up in the
+     * project data. Externalization interfaces must redirect their file
+     * access accordingly and discard the scratch data when a project is
+     * loaded. Must only be called while the file access is locked.
+     * @return Whether the scratch data is accessed
+     */
+    bool isScratchAccess() const;
+
+    /**
+     * @brief Externalizes the objects within a single batch. The objects are
+     * processed grouped by their class, thus datasets that are stored next to
+     * each other are written consecutively.
+     * @param objects Objects to externalize
+     * @return success
+     */
+    bool externalize(QList<GtExternalizedObject*> objects);
+
+    /**
+     * @brief Fetches the data of the objects within a single batch, grouped
+     * by their class. The data stays fetched until the objects are released
+     * (see release), i.e. each call increments the ref count of the objects.
+     * The objects must be released even if fetching failed.
+     * @param objects Objects to fetch
+     * @return success
+     */
+    bool fetch(QList<GtExternalizedObject*> objects);
+
+    /**
+     * @brief Reads the data of the objects into buffers without modifying
+     * the objects (see GtExternalizedObject::doReadData), e.g. to prefetch
+     * the data in a background thread. The objects must neither be modified
+     * nor destroyed meanwhile. Each object is read while the file access is
+     * locked (see lockFileAccess). Objects that are fetched already or do not
+     * support reading their data into a buffer get a null buffer.
+     * @param objects Objects to read
+     * @return Buffers in the order of the objects
+     */
+    QVector<QVariant> readData(QList<GtExternalizedObject*> const& objects);
+
+    /**
+     * @brief Fetches the objects like fetch, but uses the data read by
+     * readData. Must be called in the thread of the objects.
+     * @param objects Objects to fetch
+     * @param buffers Buffers returned by readData for the objects
+     * @return success
+     */
+    bool fetch(QList<GtExternalizedObject*> const& objects,
+               QVector<QVariant> buffers);
+
+    /**
+     * @brief Returns the memory budget for fetched data.
+     * @return budget in bytes. Unlimited if 0
+     */
+    qint64 memoryBudget() const;
+
+    /**
+     * @brief Sets the memory budget for fetched data. If the size of the
+     * fetched data exceeds the budget, the least recently used objects that
+     * are not accessed anymore are evicted. Modified objects are written to
+     * the scratch data of the session first (see isScratchAccess), they are
+     * written to the project data when saved. Objects that are kept internalized are not evicted. Defaults
+     * to the environment variable GTLAB_EXTERNALIZATION_MEMORY_BUDGET (in
+     * MiB).
+     * @param bytes budget in bytes. Use 0 for an unlimited budget
+     */
+    void setMemoryBudget(qint64 bytes);
+
+    /**
+     * @brief Returns the statistics of the fetched data
+     * @return statistics
+     */
+    MemoryStatistics memoryStatistics() const;
+
+    /**
+     * @brief Resets the eviction counters of the statistics
+     */
+    void resetMemoryStatistics();
+
+    /**
+     * @brief Evicts the least recently used objects until the size of the
+     * fetched data is within the memory budget. Only objects living in the
+     * current thread are evicted.
+     */
+    void enforceMemoryBudget();
+
+    /**
+     * @brief Releases objects that were fetched using fetch.
+     * @param objects Objects to release
+     * @return success
+     */
+    bool release(const QList<GtExternalizedObject*>& objects);
+
 public slots:
 
     /**
@@ -103,11 +280,31 @@ public slots:
 
 private:
 
+    friend class GtExternalizedObject;
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+
     /**
      * @brief GtExternalizationManager
      */
     GtExternalizationManager();
 
+    ~GtExternalizationManager() override;
+
+    /**
+     * @brief Marks the data of the object as fetched and most recently used.
+     * @param obj Object
+     * @param size Size of the fetched data in bytes
+     */
+    void onDataFetched(GtExternalizedObject* obj, qint64 size);
+
+    /**
+     * @brief Removes the object from the fetched data.
+     * @param obj Object
+     */
+    void onDataCleared(GtExternalizedObject* obj);
+
     /// path to the directory of the current project
     QString m_projectDir{};
 
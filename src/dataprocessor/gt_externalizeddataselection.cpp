@@ -0,0 +1,44 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_externalizeddataselection.h"
+
+#include <algorithm>
+
+GtExternalizedDataSelection::GtExternalizedDataSelection(quint64 firstRow,
+                                                         quint64 nRows,
+                                                         quint64 stride) :
+    m_firstRow(firstRow),
+    m_nRows(nRows),
+    m_stride(std::max<quint64>(stride, 1))
+{ }
+
+GtExternalizedDataSelection&
+GtExternalizedDataSelection::setColumns(QVector<quint64> columns)
+{
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+
+    m_columns = std::move(columns);
+    return *this;
+}
+
+bool
+GtExternalizedDataSelection::isFull() const
+{
+    return m_firstRow == 0 && m_nRows == 0 && m_stride == 1 &&
+           m_columns.isEmpty();
+}
+
+bool
+GtExternalizedDataSelection::operator==(
+        const GtExternalizedDataSelection& other) const
+{
+    return m_firstRow == other.m_firstRow &&
+           m_nRows == other.m_nRows &&
+           m_stride == other.m_stride &&
+           m_columns == other.m_columns;
+}
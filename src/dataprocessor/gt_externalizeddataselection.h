@@ -0,0 +1,73 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTEXTERNALIZEDDATASELECTION_H
+#define GTEXTERNALIZEDDATASELECTION_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QVector>
+
+/**
+ * @brief The GtExternalizedDataSelection class.
+ * Selects a part (hyperslab) of the externalized data of an object. The rows
+ * correspond to the first dimension of the data, the columns to the second
+ * one. A default constructed selection selects the entire data.
+ */
+class GT_DATAMODEL_EXPORT GtExternalizedDataSelection
+{
+public:
+
+    GtExternalizedDataSelection() = default;
+
+    /**
+     * @brief Selects a range of rows
+     * @param firstRow first row to select
+     * @param nRows number of rows to select. Selects all remaining rows if 0
+     * @param stride selects every n-th row
+     */
+    GtExternalizedDataSelection(quint64 firstRow,
+                                quint64 nRows,
+                                quint64 stride = 1);
+
+    /**
+     * @brief Selects a subset of the columns. The values of the selected
+     * columns are returned in ascending order.
+     * @param columns column indices. Selects all columns if empty
+     * @return this
+     */
+    GtExternalizedDataSelection& setColumns(QVector<quint64> columns);
+
+    /**
+     * @brief Returns whether the entire data is selected
+     * @return is full selection
+     */
+    bool isFull() const;
+
+    quint64 firstRow() const { return m_firstRow; }
+    quint64 nRows() const { return m_nRows; }
+    quint64 stride() const { return m_stride; }
+    QVector<quint64> const& columns() const { return m_columns; }
+
+    bool operator==(const GtExternalizedDataSelection& other) const;
+    bool operator!=(const GtExternalizedDataSelection& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    /// first row
+    quint64 m_firstRow{0};
+    /// number of rows, 0 selects all remaining rows
+    quint64 m_nRows{0};
+    /// row stride
+    quint64 m_stride{1};
+    /// sorted column indices, empty selects all columns
+    QVector<quint64> m_columns;
+};
+
+#endif // GTEXTERNALIZEDDATASELECTION_H
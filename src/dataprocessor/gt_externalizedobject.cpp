@@ -37,7 +37,10 @@ GtExternalizedObject::GtExternalizedObject() :
     pimpl->pMetaData.setReadOnly(true);
 }
 
-GtExternalizedObject::~GtExternalizedObject() = default;
+GtExternalizedObject::~GtExternalizedObject()
+{
+    gtExternalizationManager->onDataCleared(this);
+}
 
 int
 GtExternalizedObject::refCount() const
@@ -45,12 +48,31 @@ GtExternalizedObject::refCount() const
     return pimpl->refCount;
 }
 
+int
+GtExternalizedObject::refCount(const GtExternalizedDataSelection& selection) const
+{
+    auto iter = pimpl->findSelection(selection);
+    return iter != pimpl->selections.end() ? iter->refCount : 0;
+}
+
 bool
 GtExternalizedObject::isFetched() const
 {
     return pimpl->pFetched;
 }
 
+bool
+GtExternalizedObject::isFetched(const GtExternalizedDataSelection& selection) const
+{
+    auto iter = pimpl->findSelection(selection);
+    if (iter == pimpl->selections.end())
+    {
+        return isFetched();
+    }
+
+    return iter->fetched && (!iter->entire || isFetched());
+}
+
 void
 GtExternalizedObject::setFetchInitialVersion(bool value) const
 {
@@ -128,16 +150,94 @@ GtExternalizedObject::canExternalize() const
     return true;
 }
 
+qint64
+GtExternalizedObject::fetchedDataSize() const
+{
+    // nothing to do here
+    return 0;
+}
+
+bool
+GtExternalizedObject::canFetchSelection() const
+{
+    // nothing to do here
+    return false;
+}
+
+bool
+GtExternalizedObject::doFetchSelection(QVariant& /*metaData*/,
+                                       const GtExternalizedDataSelection&,
+                                       bool /*fetchInitialVersion*/)
+{
+    // nothing to do here
+    return false;
+}
+
+void
+GtExternalizedObject::doClearSelection(const GtExternalizedDataSelection&)
+{
+    // nothing to do here
+}
+
+bool
+GtExternalizedObject::doReadData(const QVariant& /*metaData*/,
+                                 bool /*fetchInitialVersion*/,
+                                 QVariant& /*buffer*/) const
+{
+    // nothing to do here
+    return false;
+}
+
+bool
+GtExternalizedObject::doFetchBuffer(QVariant& /*metaData*/,
+                                    QVariant& /*buffer*/)
+{
+    // nothing to do here
+    return false;
+}
+
 bool
 GtExternalizedObject::fetch()
+{
+    QVariant buffer;
+    return fetch(buffer);
+}
+
+bool
+GtExternalizedObject::fetch(QVariant& buffer)
 {
     pimpl->refCount += 1;
 
-    return fetchHelper();
+    if (!fetchHelper(&buffer))
+    {
+        return false;
+    }
+
+    // mark as most recently used
+    gtExternalizationManager->onDataFetched(this, fetchedDataSize());
+    gtExternalizationManager->enforceMemoryBudget();
+    return true;
+}
+
+bool
+GtExternalizedObject::readData(QVariant& buffer) const
+{
+    if (isFetched())
+    {
+        return false;
+    }
+
+    // may be called in a background thread, while other objects are fetched
+    auto lock = gtExternalizationManager->lockFileAccess();
+    GtExternalizationManager::ScratchAccess scratch{
+        pimpl->states.testFlag(Evicted)};
+
+    return doReadData(pimpl->pMetaData.get(), pimpl->pFetchInitialVersion.get(),
+                      buffer);
 }
 
 bool
-GtExternalizedObject::fetchHelper()
+GtExternalizedObject::fetchHelper(QVariant* buffer)
 {
     // not checking if externalization is enabled here
     // -> fetching should must always be possible
@@ -149,15 +249,22 @@ GtExternalizedObject::fetchHelper()
 
     gtDebug().medium() << "Fetching object..." << gt::quoted(objectName());
 
+    auto lock = gtExternalizationManager->lockFileAccess();
+    GtExternalizationManager::ScratchAccess scratch{
+        pimpl->states.testFlag(Evicted)};
+
+    // data that was read in advance is preferred
+    bool const fetched = buffer && buffer->isValid() &&
+                         doFetchBuffer(pimpl->pMetaData.get(), *buffer);
+
     // fetch
-    if (!doFetchData(pimpl->pMetaData.get(), pimpl->pFetchInitialVersion))
+    if (!fetched &&
+        !doFetchData(pimpl->pMetaData.get(), pimpl->pFetchInitialVersion))
     {
         gtError() << tr("Fetching object failed!")
                   << tr("(Path: '%1')").arg(objectPath());
-        // reset fetched flag
-        pimpl->pFetched = false;
-        // clear any internalized data
-        doClearExternalizedData();
+        // reset fetched flag and clear any internalized data
+        clearFetchedData();
         return false;
     }
 
@@ -166,6 +273,90 @@ GtExternalizedObject::fetchHelper()
     return true;
 }
 
+bool
+GtExternalizedObject::fetch(const GtExternalizedDataSelection& selection)
+{
+    if (selection.isFull() || !canFetchSelection())
+    {
+        return fetch();
+    }
+
+    auto iter = pimpl->findSelection(selection);
+    if (iter == pimpl->selections.end())
+    {
+        pimpl->selections.push_back({selection});
+        iter = std::prev(pimpl->selections.end());
+    }
+
+    // selection is already fetched
+    if (iter->refCount++ > 0)
+    {
+        return iter->fetched;
+    }
+
+    // the entirely fetched data can be used directly
+    if (isFetched())
+    {
+        iter->entire = true;
+        iter->fetched = fetch();
+        return iter->fetched;
+    }
+
+    gtDebug().medium() << "Fetching selection of object..."
+                       << gt::quoted(objectName());
+
+    {
+        auto lock = gtExternalizationManager->lockFileAccess();
+        GtExternalizationManager::ScratchAccess scratch{
+            pimpl->states.testFlag(Evicted)};
+        iter->fetched = doFetchSelection(pimpl->pMetaData.get(), selection,
+                                         pimpl->pFetchInitialVersion);
+    }
+
+    if (!iter->fetched)
+    {
+        gtError() << tr("Fetching selection of object failed!")
+                  << tr("(Path: '%1')").arg(objectPath());
+        doClearSelection(selection);
+    }
+
+    return iter->fetched;
+}
+
+bool
+GtExternalizedObject::release(const GtExternalizedDataSelection& selection)
+{
+    if (selection.isFull() || !canFetchSelection())
+    {
+        return release();
+    }
+
+    auto iter = pimpl->findSelection(selection);
+    if (iter == pimpl->selections.end())
+    {
+        gtError() << tr("Releasing selection of object failed, "
+                        "selection was not fetched before!")
+                  << tr("(Path: '%1')").arg(objectPath());
+        return false;
+    }
+
+    if (--iter->refCount > 0)
+    {
+        return true;
+    }
+
+    bool const entire = iter->entire;
+    pimpl->selections.erase(iter);
+
+    if (entire)
+    {
+        return release();
+    }
+
+    doClearSelection(selection);
+    return true;
+}
+
 bool
 GtExternalizedObject::release()
 {
@@ -199,13 +390,20 @@ GtExternalizedObject::release()
     {
         setFetchInitialVersion(false);
         pimpl->setExternalizeState(ExternalizeOnSave, true);
+
+        // data is kept until saved or evicted
+        gtExternalizationManager->onDataFetched(this, fetchedDataSize());
+        gtExternalizationManager->enforceMemoryBudget();
         return true;
     }
 
-    // clear fetched state and free internal data
-    pimpl->setExternalizeState(ExternalizeOnSave, false);
-    pimpl->pFetched = false;
-    doClearExternalizedData();
+    // clear fetched state and free internal data. Evicted data still has to
+    // be moved into the project data on save
+    if (!(pimpl->states & Evicted))
+    {
+        pimpl->setExternalizeState(ExternalizeOnSave, false);
+    }
+    clearFetchedData();
 
     return true;
 }
@@ -213,7 +411,18 @@ GtExternalizedObject::release()
 bool
 GtExternalizedObject::externalize()
 {
-    if (!gtExternalizationManager->isExternalizationEnabled() || !isFetched())
+    if (!gtExternalizationManager->isExternalizationEnabled())
+    {
+        return true;
+    }
+
+    // evicted data is moved from the scratch data into the project data
+    if (pimpl->states & Evicted && !isFetched() && !fetchHelper())
+    {
+        return false;
+    }
+
+    if (!isFetched())
     {
         return true;
     }
@@ -240,6 +449,8 @@ GtExternalizedObject::externalize()
     // swap with old hash
     hash.swap(pimpl->pCachedHash.get());
 
+    auto lock = gtExternalizationManager->lockFileAccess();
+
     // externalize
     if (!doExternalizeData(pimpl->pMetaData.get()))
     {
@@ -254,17 +465,86 @@ GtExternalizedObject::externalize()
     pimpl->pFetchInitialVersion = false;
     pimpl->setExternalizeState(ExternalizeOnSave, false);
     pimpl->setExternalizeState(KeepInternalized, false);
+    pimpl->setExternalizeState(Evicted, false);
 
     // clear data
     if (pimpl->refCount == 0)
     {
-        pimpl->pFetched = false;
-        doClearExternalizedData();
+        clearFetchedData();
+    }
+
+    return true;
+}
+
+bool
+GtExternalizedObject::canEvict() const
+{
+    return isFetched() && pimpl->refCount == 0 &&
+           !(pimpl->states & KeepInternalized);
+}
+
+bool
+GtExternalizedObject::evict(bool& writtenBack)
+{
+    writtenBack = false;
+
+    if (!canEvict())
+    {
+        return false;
+    }
+
+    QString hash{calcExtHash()};
+
+    // data that is in sync with the scratch data can be cleared
+    bool const modified = (pimpl->states & Evicted) ?
+                              hasModifiedData(hash) :
+                              (pimpl->states & ExternalizeOnSave) ||
+                                  hasModifiedData(hash);
+
+    // modified data is written to the scratch data of the session, the
+    // project data must not change until the project is saved
+    if (modified)
+    {
+        gtDebug().medium() << "Evicting object..." << gt::quoted(objectName());
+
+        hash.swap(pimpl->pCachedHash.get());
+
+        auto lock = gtExternalizationManager->lockFileAccess();
+        GtExternalizationManager::ScratchAccess scratch;
+
+        if (!doExternalizeData(pimpl->pMetaData.get()))
+        {
+            gtError() << tr("Evicting object failed!")
+                      << tr("(Path: '%1')").arg(objectPath());
+            pimpl->pCachedHash = hash;
+            return false;
+        }
+
+        // the data has to be externalized on next save
+        pimpl->pFetchInitialVersion = false;
+        pimpl->setExternalizeState(ExternalizeOnSave, true);
+        pimpl->setExternalizeState(Evicted, true);
+        writtenBack = true;
     }
+    else if (!(pimpl->states & Evicted))
+    {
+        pimpl->setExternalizeState(ExternalizeOnSave, false);
+    }
+
+    clearFetchedData();
 
     return true;
 }
 
+void
+GtExternalizedObject::clearFetchedData()
+{
+    pimpl->pFetched = false;
+    doClearExternalizedData();
+
+    gtExternalizationManager->onDataCleared(this);
+}
+
 bool
 GtExternalizedObject::internalize()
 {
@@ -280,15 +560,27 @@ GtExternalizedObject::internalize()
 
     pimpl->setExternalizeState(KeepInternalized, true);
 
+    gtExternalizationManager->onDataFetched(this, fetchedDataSize());
+    gtExternalizationManager->enforceMemoryBudget();
+
     return true;
 }
 
 GtExternalizedObjectData::GtExternalizedObjectData(GtExternalizedObject* base) :
-    m_base{base}
+    GtExternalizedObjectData{base, GtExternalizedDataSelection{}}
+{
+
+}
+
+GtExternalizedObjectData::GtExternalizedObjectData(
+        GtExternalizedObject* base,
+        GtExternalizedDataSelection selection) :
+    m_base{base},
+    m_selection{std::move(selection)}
 {
     if (m_base)
     {
-        m_base->fetch();
+        m_base->fetch(m_selection);
     }
 }
 
@@ -296,12 +588,29 @@ GtExternalizedObjectData::~GtExternalizedObjectData()
 {
     if (m_base)
     {
-        m_base->release();
+        m_base->release(m_selection);
     }
 }
 
 bool
 GtExternalizedObjectData::isValid() const
 {
-    return m_base != nullptr && m_base->isFetched() && m_base->isDataValid();
+    if (!m_base)
+    {
+        return false;
+    }
+
+    // partially fetched data is not checked by the object
+    if (!m_selection.isFull() && m_base->canFetchSelection())
+    {
+        return m_base->isFetched(m_selection);
+    }
+
+    return m_base->isFetched() && m_base->isDataValid();
+}
+
+GtExternalizedDataSelection const&
+GtExternalizedObjectData::selection() const
+{
+    return m_selection;
 }
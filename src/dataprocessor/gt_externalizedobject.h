@@ -13,6 +13,7 @@
 #define GTEXTERNALIZEDOBJECT_H
 
 #include "gt_datamodel_exports.h"
+#include "gt_externalizeddataselection.h"
 #include "gt_object.h"
 
 #include <QPointer>
@@ -45,6 +46,31 @@ T_Data fetchExternalizedData(T_Base* obj)
     return T_Data{obj};
 }
 
+/**
+ * @brief Will fetch a helper object for accessing a selection of an
+ * externalized object. Only the selected data is fetched if supported by the
+ * object.
+ * @tparam T_Base Base object class. Must be a subclass of GtExternalizedObject
+ * @tparam T_Data Data object class. Must be a subclass of
+ * GtExternalizedObjectData and constructible using a selection.
+ * @param obj Object to fetch a helper object for.
+ * @param selection Selection of the data to fetch
+ * @return helper object
+ */
+template<typename T_Base, typename T_Data = typename T_Base::Data>
+T_Data fetchExternalizedData(T_Base* obj,
+                             GtExternalizedDataSelection selection)
+{
+    static_assert (
+        std::is_base_of<GtExternalizedObject, T_Base>(),
+        "T_Base must be derived of GtExternalizedObject");
+    static_assert (
+        std::is_base_of<GtExternalizedObjectData, T_Data>(),
+        "T_Data must be derived of GtExternalizedObjectData");
+
+    return T_Data{obj, std::move(selection)};
+}
+
 } // namespace gt
 
 
@@ -55,6 +81,10 @@ T_Data fetchExternalizedData(T_Base* obj)
     public: using Data = DataClass; \
     template <typename T = Data> T fetchData() { \
         return gt::fetchExternalizedData(this); \
+    } \
+    template <typename T = Data> \
+    T fetchData(GtExternalizedDataSelection selection) { \
+        return gt::fetchExternalizedData(this, std::move(selection)); \
     } private:
 
 /// Marco for adding a dedicated base method impl for accessing the base class.
@@ -79,6 +109,16 @@ class GT_DATAMODEL_EXPORT GtExternalizedObjectData
 public:
 
     explicit GtExternalizedObjectData(GtExternalizedObject* base);
+
+    /**
+     * @brief Accesses a selection of the data. The selected data is read
+     * only.
+     * @param base Object to access
+     * @param selection Selection of the data
+     */
+    GtExternalizedObjectData(GtExternalizedObject* base,
+                             GtExternalizedDataSelection selection);
+
     virtual ~GtExternalizedObjectData();
 
     GtExternalizedObjectData(const GtExternalizedObjectData&) = default;
@@ -92,10 +132,19 @@ public:
      */
     bool isValid() const;
 
+    /**
+     * @brief Returns the accessed selection of the data
+     * @return selection. Selects the entire data by default
+     */
+    GtExternalizedDataSelection const& selection() const;
+
 protected:
 
     /// pointer to base class
     QPointer<Base> m_base{};
+
+    /// accessed selection
+    GtExternalizedDataSelection m_selection{};
 };
 
 /**
@@ -124,6 +173,14 @@ public:
      */
     int refCount() const;
 
+    /**
+     * @brief Returns the current number of accesses of the selection.
+     * Accesses of the entire data are not included.
+     * @param selection Selection of the data
+     * @return ref count
+     */
+    int refCount(const GtExternalizedDataSelection& selection) const;
+
     /**
      * @brief Externalize. Will externalize the object only if its fetched and
      * the object has changed. Call this function with care, as the previous
@@ -146,6 +203,14 @@ public:
      */
     Q_INVOKABLE bool isFetched() const;
 
+    /**
+     * @brief Returns whether the data of the selection is fetched, i.e. either
+     * the selection or the entire data is fetched.
+     * @param selection Selection of the data
+     * @return whether the selection is fetched
+     */
+    bool isFetched(const GtExternalizedDataSelection& selection) const;
+
     /**
      * @brief Calculates a special hash of this object used to check for changes
      * in the externalized data. Member variables of this class do not count
@@ -190,6 +255,78 @@ protected:
      */
     virtual bool doFetchData(QVariant& metaData, bool fetchInitialVersion) = 0;
 
+    /**
+     * @brief Method for reading the externalized data into a buffer without
+     * modifying the object. Used to prefetch the data in a background
+     * thread, thus it must neither modify the object nor access its
+     * properties or emit signals. The buffer is passed to doFetchBuffer once
+     * the object is fetched in its own thread. The default implementation
+     * reads nothing, the data is then fetched using doFetchData. None of
+     * the externalized objects of the core implements it, i.e. prefetching
+     * only reads data in the background for classes that override it.
+     * The file access is locked while reading (see
+     * GtExternalizationManager::lockFileAccess).
+     * @param metaData Data that may need to be saved in between sessions to
+     * help fetch/externalize the dataset.
+     * @param fetchInitialVersion Whether to read the intial version of the
+     * data (i.e. the original data that has not changed)
+     * @param buffer Buffer to read the data into
+     * @return Whether the data was read
+     */
+    virtual bool doReadData(const QVariant& metaData,
+                            bool fetchInitialVersion,
+                            QVariant& buffer) const;
+
+    /**
+     * @brief Method for fetching the data from a buffer read by doReadData.
+     * If it fails, the data is fetched using doFetchData instead.
+     * @param metaData Data that may need to be saved in between sessions to
+     * help fetch/externalize the dataset.
+     * @param buffer Buffer holding the data
+     * @return success
+     */
+    virtual bool doFetchBuffer(QVariant& metaData, QVariant& buffer);
+
+    /**
+     * @brief Returns the size of the fetched data. Used to keep the fetched
+     * data within the memory budget of the externalization manager (see
+     * GtExternalizationManager::setMemoryBudget). The default implementation
+     * returns 0, i.e. the data does not count towards the budget.
+     * @return size in bytes
+     */
+    virtual qint64 fetchedDataSize() const;
+
+    /**
+     * @brief Returns whether the object can fetch selections of its data
+     * (see doFetchSelection). Otherwise the entire data is fetched when
+     * accessing a selection.
+     * @return can fetch selections
+     */
+    virtual bool canFetchSelection() const;
+
+    /**
+     * @brief Method for fetching a selection of the externalized data. Will
+     * only be called if canFetchSelection returns true and the data is not
+     * fetched entirely. The selected data is read only and must be kept
+     * until doClearSelection is called.
+     * @param metaData Data that may need to be saved in between sessions to
+     * help fetch/externalize the dataset.
+     * @param selection Selection of the data to fetch
+     * @param fetchInitialVersion Whether to fetch the intial version of the
+     * data (i.e. the original data that has not changed)
+     * @return success
+     */
+    virtual bool doFetchSelection(QVariant& metaData,
+                                  const GtExternalizedDataSelection& selection,
+                                  bool fetchInitialVersion);
+
+    /**
+     * @brief Method for clearing the data of a selection. Called once the
+     * selection is no longer accessed.
+     * @param selection Selection of the data to clear
+     */
+    virtual void doClearSelection(const GtExternalizedDataSelection& selection);
+
     /**
      * @brief Method to implement for externalizing the data. Will only be
      * called if canExternalize returns true.
@@ -220,6 +357,23 @@ private:
      */
     bool fetch();
 
+    /**
+     * @brief Increments ref count and fetches the data from the buffer (see
+     * readData) if not fetched yet.
+     * @param buffer Buffer holding the data. May be null
+     * @return whether fetching was successfull.
+     */
+    bool fetch(QVariant& buffer);
+
+    /**
+     * @brief Reads the data into a buffer without modifying the object (see
+     * doReadData). May be called from another thread as long as the object
+     * is neither modified nor destroyed meanwhile.
+     * @param buffer Buffer to read the data into
+     * @return Whether the data was read
+     */
+    bool readData(QVariant& buffer) const;
+
     /**
      * @brief Decrements ref count. Will flag this object for externalization
      * if data has changed.
@@ -227,11 +381,51 @@ private:
      */
     bool release();
 
+    /**
+     * @brief Increments the ref count of the selection and fetches the
+     * selected data if not fetched yet.
+     * @param selection Selection of the data
+     * @return whether fetching was successfull.
+     */
+    bool fetch(const GtExternalizedDataSelection& selection);
+
+    /**
+     * @brief Decrements the ref count of the selection. Clears the selected
+     * data if it is no longer accessed.
+     * @param selection Selection of the data
+     * @return success
+     */
+    bool release(const GtExternalizedDataSelection& selection);
+
+    /**
+     * @brief Returns whether the data can be evicted, i.e. the data is
+     * fetched but not accessed and not kept internalized.
+     * @return can evict
+     */
+    bool canEvict() const;
+
+    /**
+     * @brief Evicts the fetched data. Modified data is written to the
+     * scratch data of the session first (see
+     * GtExternalizationManager::isScratchAccess), from where it is fetched
+     * again and moved into the project data on the next externalization.
+     * @param writtenBack Whether the data was modified and written to the
+     * scratch data
+     * @return success
+     */
+    bool evict(bool& writtenBack);
+
+    /**
+     * @brief Clears the fetched data and the fetched flag.
+     */
+    void clearFetchedData();
+
     /**
      * @brief Helper method for fetching. Should not be called directly.
+     * @param buffer Buffer read by readData, if any
      * @return success
      */
-    bool fetchHelper();
+    bool fetchHelper(QVariant* buffer = nullptr);
 
     /**
      * @brief Setter for the fetchInitialVersion property
@@ -15,7 +15,9 @@
 #include "gt_externalizedobject.h"
 
 #include <QPointer>
+#include <cassert>
 #include <memory>
+#include <type_traits>
 
 /**
  * @brief The GtExternalizedObjectFetcher class.
@@ -33,6 +35,15 @@ public:
     GtExternalizedObjectFetcher() = default;
     explicit GtExternalizedObjectFetcher(T_Base* object);
 
+    /**
+     * @brief Fetches only a selection of the data. T_Data must be
+     * constructible using a selection.
+     * @param object object to fetch
+     * @param selection selection of the data
+     */
+    GtExternalizedObjectFetcher(T_Base* object,
+                                GtExternalizedDataSelection selection);
+
     /**
      * @brief access object
      * @return base ptr
@@ -67,6 +78,22 @@ public:
      */
     void set(T_Base* object);
 
+    /**
+     * @brief returns the selection of the data to fetch
+     * @return selection
+     */
+    GtExternalizedDataSelection const& selection() const
+    {
+        return m_selection;
+    }
+
+    /**
+     * @brief sets the selection of the data to fetch and fetches a new data
+     * object
+     * @param selection new selection
+     */
+    void setSelection(GtExternalizedDataSelection selection);
+
     /**
      * @brief operator -> to access underlying object
      * @return pointer to object
@@ -82,6 +109,8 @@ private:
     QPointer<T_Base> m_objPtr;
     /// pointer to data object
     std::unique_ptr<T_Data> m_dataPtr;
+    /// selection of the data
+    GtExternalizedDataSelection m_selection;
 };
 
 template<class T_Base, class T_Data>
@@ -98,6 +127,19 @@ GtExternalizedObjectFetcher<T_Base, T_Data>::GtExternalizedObjectFetcher(
     fetch();
 }
 
+template<class T_Base, class T_Data>
+GtExternalizedObjectFetcher<T_Base, T_Data>::GtExternalizedObjectFetcher(
+        T_Base* object, GtExternalizedDataSelection selection) :
+    m_objPtr(object),
+    m_selection(std::move(selection))
+{
+    static_assert (
+        std::is_constructible<T_Data, T_Base*,
+                              GtExternalizedDataSelection>::value,
+        "T_Data must be constructible using a selection");
+    fetch();
+}
+
 template<class T_Base, class T_Data>
 inline bool GtExternalizedObjectFetcher<T_Base, T_Data>::isValid() const
 {
@@ -113,7 +155,16 @@ inline void GtExternalizedObjectFetcher<T_Base, T_Data>::clear()
 template<class T_Base, class T_Data>
 inline void GtExternalizedObjectFetcher<T_Base, T_Data>::fetch()
 {
-    m_dataPtr = std::make_unique<T_Data>(m_objPtr);
+    if constexpr (std::is_constructible<T_Data, T_Base*,
+                                        GtExternalizedDataSelection>::value)
+    {
+        m_dataPtr = std::make_unique<T_Data>(m_objPtr.data(), m_selection);
+    }
+    else
+    {
+        assert(m_selection.isFull());
+        m_dataPtr = std::make_unique<T_Data>(m_objPtr.data());
+    }
 }
 
 template<class T_Base, class T_Data>
@@ -123,4 +174,12 @@ inline void GtExternalizedObjectFetcher<T_Base, T_Data>::set(T_Base* object)
     fetch();
 }
 
+template<class T_Base, class T_Data>
+inline void GtExternalizedObjectFetcher<T_Base, T_Data>::setSelection(
+        GtExternalizedDataSelection selection)
+{
+    m_selection = std::move(selection);
+    fetch();
+}
+
 #endif // GTEXTERNALIZEDOBJECTFETCHER_H
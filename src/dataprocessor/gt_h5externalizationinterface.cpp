@@ -17,18 +17,122 @@
 
 #include "genh5_file.h"
 
+#include "H5Opublic.h"
+
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QMutex>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
 
 const QString GtH5ExternalizationInterface::S_PROJECT_BASENAME =
         QStringLiteral("project.ext");
 const QString GtH5ExternalizationInterface::S_BACKUP_SUFFIX =
         QStringLiteral("_backup");
+const QString GtH5ExternalizationInterface::S_SCRATCH_SUFFIX =
+        QStringLiteral("_scratch");
 
 static auto* s_h5Interface = GtH5ExternalizationInterface::instance();
 
-GtH5ExternalizationInterface::GtH5ExternalizationInterface() = default;
+namespace
+{
+
+/// default number of elements per chunk (128 KiB for doubles)
+constexpr int s_defaultChunkSize = 16384;
+
+/// default deflate compression level, compromise of speed and file size
+constexpr int s_defaultCompressionLevel = 4;
+
+/**
+ * @brief Reads an integer from the environment variable
+ * @param name Name of the variable
+ * @param defaultValue Value to use if the variable is not set or invalid
+ * @return value
+ */
+int
+envValue(const char* name, int defaultValue)
+{
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue(name, &ok);
+    return ok ? value : defaultValue;
+}
+
+/**
+ * @brief Determines the dimensions of a chunk with at most nElements
+ * elements. Halves the largest dimension until the chunk is small enough.
+ * @param dims Dimensions of the dataset
+ * @param nElements Maximum number of elements per chunk
+ * @return chunk dimensions
+ */
+GenH5::Dimensions
+chunkDimensions(GenH5::Dimensions dims, hsize_t nElements)
+{
+    for (auto& dim : dims)
+    {
+        dim = std::max<hsize_t>(dim, 1);
+    }
+
+    auto const product = [&dims](){
+        return std::accumulate(dims.begin(), dims.end(), hsize_t{1},
+                               std::multiplies<hsize_t>());
+    };
+
+    while (product() > nElements)
+    {
+        auto largest = std::max_element(dims.begin(), dims.end());
+        if (*largest <= 1) break;
+
+        *largest = (*largest + 1) / 2;
+    }
+
+    return dims;
+}
+
+} // namespace
+
+struct GtH5ExternalizationInterface::Impl
+{
+    /// Cached file handle of a file session
+    struct CachedFile
+    {
+        QString filePath;
+        GenH5::File file;
+    };
+
+    /// guards the session data
+    mutable QMutex mutex;
+
+    /// number of nested file sessions
+    int sessionDepth{0};
+
+    /// main project file. Opened for reading and writing
+    CachedFile mainFile;
+
+    /// backup file. Opened read only
+    CachedFile backupFile;
+
+    /// scratch file holding the evicted data. Opened for reading and writing
+    CachedFile scratchFile;
+
+    /// number of elements per chunk of new datasets
+    std::atomic<int> chunkSize{
+        std::max(envValue("GTLAB_H5_CHUNK_SIZE", s_defaultChunkSize), 0)};
+
+    /// compression level of new datasets
+    std::atomic<int> compressionLevel{
+        qBound(0, envValue("GTLAB_H5_COMPRESSION", s_defaultCompressionLevel),
+               9)};
+};
+
+GtH5ExternalizationInterface::GtH5ExternalizationInterface() :
+    pimpl(std::make_unique<Impl>())
+{ }
+
+GtH5ExternalizationInterface::~GtH5ExternalizationInterface() = default;
 
 GtH5ExternalizationInterface*
 GtH5ExternalizationInterface::instance()
@@ -40,6 +144,21 @@ GtH5ExternalizationInterface::instance()
 void
 GtH5ExternalizationInterface::onProjectLoaded(const QString& /*projectDir*/)
 {
+    {
+        // unsaved data evicted in a previous session is discarded
+        auto lock = gtExternalizationManager->lockFileAccess();
+        GtExternalizationManager::ScratchAccess scratch;
+
+        QString scratchFilePath{projectHDF5FilePath(false)};
+
+        if (QFileInfo::exists(scratchFilePath) &&
+            !QFile::remove(scratchFilePath))
+        {
+            gtWarning() << tr("Failed to remove HDF5 scratch file!")
+                        << scratchFilePath;
+        }
+    }
+
     // file path without suffix
     QString filePath{projectHDF5FilePath(false)};
 
@@ -95,7 +214,221 @@ GtH5ExternalizationInterface::projectHDF5FilePath(bool useBackupFile) const
     {
         name += S_BACKUP_SUFFIX;
     }
+    else if (gtExternalizationManager->isScratchAccess())
+    {
+        name += S_SCRATCH_SUFFIX;
+    }
 
     return projectDir.absoluteFilePath(name + GenH5::File::dotFileSuffix());
 }
+
+GenH5::File
+GtH5ExternalizationInterface::projectHDF5File(bool useBackupFile,
+                                              bool writable) noexcept(false)
+{
+    QString filePath = projectHDF5FilePath(useBackupFile);
+
+    if (filePath.isEmpty())
+    {
+        throw GenH5::FileException{"Invalid HDF5 file path"};
+    }
+
+    QMutexLocker locker{&pimpl->mutex};
+
+    if (pimpl->sessionDepth == 0)
+    {
+        if (writable && !useBackupFile)
+        {
+            return GenH5::File{filePath.toUtf8(), GenH5::Create | GenH5::Open};
+        }
+        return GenH5::File{filePath.toUtf8(), GenH5::Open | GenH5::ReadOnly};
+    }
+
+    auto& cached = useBackupFile ? pimpl->backupFile :
+                   gtExternalizationManager->isScratchAccess() ?
+                   pimpl->scratchFile : pimpl->mainFile;
+
+    if (cached.file.isValid() && cached.filePath == filePath)
+    {
+        return cached.file;
+    }
+
+    // close the file of a previous project first
+    cached.file = GenH5::File{};
+    cached.filePath = filePath;
+
+    if (useBackupFile)
+    {
+        cached.file = GenH5::File{filePath.toUtf8(),
+                                  GenH5::Open | GenH5::ReadOnly};
+    }
+    // the main file is opened for writing in any case as hdf5 does not allow
+    // to reopen a file with different access flags while it is still in use
+    else if (writable)
+    {
+        cached.file = GenH5::File{filePath.toUtf8(),
+                                  GenH5::Create | GenH5::Open};
+    }
+    else
+    {
+        cached.file = GenH5::File{filePath.toUtf8(), GenH5::Open};
+    }
+
+    return cached.file;
+}
+
+void
+GtH5ExternalizationInterface::beginBatch()
+{
+    QMutexLocker locker{&pimpl->mutex};
+    pimpl->sessionDepth += 1;
+}
+
+void
+GtH5ExternalizationInterface::endBatch()
+{
+    QMutexLocker locker{&pimpl->mutex};
+
+    assert(pimpl->sessionDepth > 0);
+    if (pimpl->sessionDepth == 0 || --pimpl->sessionDepth > 0)
+    {
+        return;
+    }
+
+    // close files
+    pimpl->mainFile = {};
+    pimpl->backupFile = {};
+    pimpl->scratchFile = {};
+}
+
+bool
+GtH5ExternalizationInterface::hasFileSession() const
+{
+    QMutexLocker locker{&pimpl->mutex};
+    return pimpl->sessionDepth > 0;
+}
+
+int
+GtH5ExternalizationInterface::chunkSize() const
+{
+    return pimpl->chunkSize;
+}
+
+void
+GtH5ExternalizationInterface::setChunkSize(int nElements)
+{
+    pimpl->chunkSize = std::max(nElements, 0);
+}
+
+int
+GtH5ExternalizationInterface::compressionLevel() const
+{
+    return pimpl->compressionLevel;
+}
+
+void
+GtH5ExternalizationInterface::setCompressionLevel(int level)
+{
+    pimpl->compressionLevel = qBound(0, level, 9);
+}
+
+GenH5::DataSetCProperties
+GtH5ExternalizationInterface::dataSetProperties(
+        const GenH5::DataSpace& dataSpace) const
+{
+    GenH5::DataSetCProperties props;
+
+    int const nElements = chunkSize();
+
+    // scalar and empty datasets cannot be chunked
+    if (nElements <= 0 || dataSpace.nDims() == 0 ||
+        dataSpace.selectionSize() == 0)
+    {
+        return props;
+    }
+
+    props.setChunkDimensions(chunkDimensions(dataSpace.dimensions(),
+                                             static_cast<hsize_t>(nElements)));
+
+    int const level = compressionLevel();
+    if (level > 0)
+    {
+        props.setCompression(level);
+    }
+
+    return props;
+}
+
+bool
+GtH5ExternalizationInterface::repackFile(const QString& filePath)
+{
+    if (!QFileInfo::exists(filePath))
+    {
+        gtError() << tr("HDF5 file does not exist:") << filePath;
+        return false;
+    }
+
+    QString const tmpFilePath = filePath + QStringLiteral(".repack");
+    QString const backupFilePath = filePath + QStringLiteral(".repack_backup");
+    qint64 const oldSize = QFileInfo{filePath}.size();
+
+    // data may be read in the background meanwhile
+    auto lock = gtExternalizationManager->lockFileAccess();
+
+    try
+    {
+        GenH5::File src{filePath.toUtf8(), GenH5::Open | GenH5::ReadOnly};
+        GenH5::File dst{tmpFilePath.toUtf8(), GenH5::Overwrite};
+
+        // copying the objects recursively allocates only the used space
+        auto const nodes = src.root().findChildNodes(GenH5::FindDirectOnly);
+        for (auto const& node : nodes)
+        {
+            if (H5Ocopy(src.root().id(), node.path.constData(),
+                        dst.root().id(), node.path.constData(),
+                        H5P_DEFAULT, H5P_DEFAULT) < 0)
+            {
+                throw GenH5::FileException{"Copying object failed"};
+            }
+        }
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << tr("Repacking HDF5 file failed!") << e.what();
+        QFile::remove(tmpFilePath);
+        return false;
+    }
+
+    // the original file is kept until the repacked file is in place
+    QFile::remove(backupFilePath);
+    if (!QFile::rename(filePath, backupFilePath))
+    {
+        gtError() << tr("Failed to replace HDF5 file with the repacked "
+                        "file!") << tmpFilePath;
+        QFile::remove(tmpFilePath);
+        return false;
+    }
+
+    if (!QFile::rename(tmpFilePath, filePath))
+    {
+        gtError() << tr("Failed to replace HDF5 file with the repacked "
+                        "file!") << tmpFilePath;
+
+        if (!QFile::rename(backupFilePath, filePath))
+        {
+            gtError() << tr("Failed to restore the original HDF5 file!")
+                      << backupFilePath;
+        }
+        return false;
+    }
+
+    QFile::remove(backupFilePath);
+
+    gtInfo() << tr("Repacked HDF5 file '%1' (%2 kB -> %3 kB)")
+                .arg(filePath)
+                .arg(oldSize / 1024)
+                .arg(QFileInfo{filePath}.size() / 1024);
+
+    return true;
+}
 #endif
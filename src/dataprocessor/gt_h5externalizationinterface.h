@@ -15,6 +15,12 @@
 #ifdef GT_H5
 #include "gt_abstractexternalizationinterface.h"
 
+#include "genh5_datasetcproperties.h"
+#include "genh5_dataspace.h"
+#include "genh5_file.h"
+
+#include <memory>
+
 #define gtH5ExternalizationInterface (GtH5ExternalizationInterface::instance())
 
 /**
@@ -22,7 +28,23 @@
  * Used when externalizing objects to the HDF5 format.
  * Manages the main project HDF5 file. Creates a backup file when a project is
  * loaded, which is used t retrieve the initial version of each dataset,
- * while the main project file contains the modified datasets.
+ * while the main project file contains the modified datasets. Data evicted
+ * to meet the memory budget is written to a scratch file instead of the main
+ * project file, while the file access is redirected (see
+ * GtExternalizationManager::isScratchAccess). The scratch file is discarded
+ * when a project is loaded.
+ *
+ * During a batch of externalization operations (file session) the project
+ * files are opened only once and the handles are shared by all accesses.
+ * Thus, the files must only be accessed while the file access of the
+ * externalization manager is locked (see
+ * GtExternalizationManager::lockFileAccess), which is the case for the
+ * externalization methods of GtExternalizedObject.
+ *
+ * New datasets are chunked, compressed and extendible, thus changing their
+ * shape does not require to reallocate them. The chunk size and compression
+ * level default to the environment variables GTLAB_H5_CHUNK_SIZE and
+ * GTLAB_H5_COMPRESSION, which are clamped like the values of the setters.
  */
 class GT_DATAMODEL_EXPORT GtH5ExternalizationInterface :
         public GtAbstractExternalizationInterface
@@ -34,6 +56,9 @@ class GT_DATAMODEL_EXPORT GtH5ExternalizationInterface :
     /// file suffix indicating a backup file
     static const QString S_BACKUP_SUFFIX;
 
+    /// file suffix indicating the scratch file of the session
+    static const QString S_SCRATCH_SUFFIX;
+
 public:
 
     /**
@@ -51,17 +76,97 @@ public:
     /**
      * @brief returns the file path to the hdf5 file.
      * @param useBackupFile whether to sue the backup file or main project file.
-     * The backup file should not be modified.
+     * The backup file should not be modified. The main project file is
+     * replaced by the scratch file while the file access is redirected (see
+     * GtExternalizationManager::isScratchAccess).
      * @return file path to hdf5 file
      */
     QString projectHDF5FilePath(bool useBackupFile) const;
 
+    /**
+     * @brief Opens the hdf5 file. Within a file session the handle is cached
+     * and shared, otherwise a new handle is opened for each call.
+     * @param useBackupFile whether to use the backup file or main project
+     * file. The backup file is always opened read only.
+     * @param writable whether the file will be written to
+     * @return file (will throw if operation fails)
+     */
+    GenH5::File projectHDF5File(bool useBackupFile,
+                                bool writable) noexcept(false);
+
+    /**
+     * @brief Begins a file session. The project files are kept open until
+     * the session ends.
+     */
+    void beginBatch() override;
+
+    /**
+     * @brief Ends a file session. Closes the project files once the
+     * outermost session ends.
+     */
+    void endBatch() override;
+
+    /**
+     * @brief Returns whether a file session is active.
+     * @return has file session
+     */
+    bool hasFileSession() const;
+
+    /**
+     * @brief Returns the number of elements per chunk of new datasets.
+     * @return chunk size. Datasets are stored contiguous if 0
+     */
+    int chunkSize() const;
+
+    /**
+     * @brief Sets the number of elements per chunk of new datasets.
+     * @param nElements chunk size. Use 0 to store datasets contiguous
+     * (compression requires chunking)
+     */
+    void setChunkSize(int nElements);
+
+    /**
+     * @brief Returns the deflate compression level of new datasets.
+     * @return compression level (0-9). No compression if 0
+     */
+    int compressionLevel() const;
+
+    /**
+     * @brief Sets the deflate compression level of new datasets.
+     * @param level compression level (0-9). Use 0 to disable compression
+     */
+    void setCompressionLevel(int level);
+
+    /**
+     * @brief Creates the creation properties for a new dataset using the
+     * current chunk size and compression level.
+     * @param dataSpace dataspace of the dataset
+     * @return creation properties
+     */
+    GenH5::DataSetCProperties dataSetProperties(
+            const GenH5::DataSpace& dataSpace) const;
+
+    /**
+     * @brief Rewrites the hdf5 file without the space of deleted or
+     * reallocated datasets, which is never reclaimed by hdf5. The file must
+     * not be in use. The original file is kept as a backup until the
+     * repacked file replaced it and is restored if replacing fails.
+     * @param filePath hdf5 file
+     * @return success
+     */
+    static bool repackFile(const QString& filePath);
+
 private:
 
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+
     /**
      * @brief GtH5ExternalizationInterface
      */
     GtH5ExternalizationInterface();
+
+    ~GtH5ExternalizationInterface() override;
 };
 #endif
 
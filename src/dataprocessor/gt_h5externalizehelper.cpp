@@ -14,16 +14,24 @@
 
 #ifdef GT_H5
 #include "gt_externalizedobject.h"
+#include "gt_finally.h"
 #include "gt_h5externalizationinterface.h"
 
 #include "genh5_file.h"
 #include "genh5_reference.h"
 
+#include "H5Dpublic.h"
+#include "H5Spublic.h"
+
 #include <QDir>
 #include <QDirIterator>
 #include <QFile>
 #include <QFileInfo>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 static const auto S_GT_VERSION_ATTR = QByteArrayLiteral("GT_VERSION");
 static const auto S_EXT_HASH_ATTR = QByteArrayLiteral("GT_EXT_HASH");
 
@@ -43,7 +51,8 @@ namespace
  * @return datasaet (invalid if derferencing failed)
  */
 inline GenH5::DataSet
-dereferenceDataSet(GenH5::File& file, const QVariant& refVariant)
+dereferenceDataSet(GenH5::File& file, const QVariant& refVariant,
+                   QString const& path)
 {
     bool success = true;
     auto refData = refVariant.toInt(&success);
@@ -53,9 +62,15 @@ dereferenceDataSet(GenH5::File& file, const QVariant& refVariant)
     {
         try
         {
-            return ref.toDataSet(file);
+            auto dset = ref.toDataSet(file);
+
+            // references are outdated once the file was repacked
+            if (QString{dset.path()}.endsWith(path))
+            {
+                return dset;
+            }
         }
-        catch (GenH5::ReferenceException const& )
+        catch (GenH5::Exception const& )
         {
             // nothing to do here
         }
@@ -63,6 +78,66 @@ dereferenceDataSet(GenH5::File& file, const QVariant& refVariant)
     return {};
 }
 
+/**
+ * @brief Tries to resize an extendible dataset to the new dataspace
+ * @param dset dataset
+ * @param dataType datatype of the data to write
+ * @param dataSpace dataspace of the data to write
+ * @return whether the dataset can be used to write the data
+ */
+inline bool
+resizeDataSet(GenH5::DataSet& dset,
+              const GenH5::DataType& dataType,
+              const GenH5::DataSpace& dataSpace)
+{
+    if (dset.dataType() != dataType)
+    {
+        return false;
+    }
+
+    // extendible dataspaces differ in their maximum dimensions
+    if (dset.dataSpace().dimensions() == dataSpace.dimensions())
+    {
+        return true;
+    }
+
+    // only chunked datasets with the same rank are extendible
+    if (!dset.cProperties().isChunked() ||
+        dset.dataSpace().nDims() != dataSpace.nDims())
+    {
+        return false;
+    }
+
+    try
+    {
+        return dset.resize(dataSpace.dimensions());
+    }
+    catch (GenH5::Exception const& )
+    {
+        return false;
+    }
+}
+
+/**
+ * @brief Creates an extendible dataspace with the same dimensions
+ * @param dataSpace dataspace
+ * @return extendible dataspace. Scalar and empty dataspaces are returned
+ * unchanged
+ */
+inline GenH5::DataSpace
+extendibleDataSpace(const GenH5::DataSpace& dataSpace)
+{
+    if (dataSpace.nDims() == 0 || dataSpace.selectionSize() == 0)
+    {
+        return dataSpace;
+    }
+
+    auto dims = dataSpace.dimensions();
+    GenH5::Dimensions maxDims(dims.size(), H5S_UNLIMITED);
+
+    return GenH5::DataSpace{dims, maxDims};
+}
+
 /**
  * @brief Writes the dataset reference to the metadata varaint
  * @param dset dataset
@@ -193,14 +268,16 @@ GtH5ExternalizeHelper::overwriteDataSet(const GenH5::DataType& dataType,
                                         QVariant& refVariant
                                         ) const noexcept(false)
 {
-    GenH5::File file = openFile({ GenH5::Create | GenH5::Open});
+    GenH5::File file = gtH5ExternalizationInterface->projectHDF5File(
+                false, true);
 
     // try retrieving by h5 reference
-    auto dset = dereferenceDataSet(file, refVariant);
+    auto dset = dereferenceDataSet(file, refVariant, dataSetPath());
     if (dset.isValid())
     {
-        // make sure dataset has enough space
-        if (dset.dataSpace() != dataSpace || dset.dataType() != dataType)
+        // make sure dataset has enough space. Chunked datasets are resized,
+        // others are recreated
+        if (!resizeDataSet(dset, dataType, dataSpace))
         {
             dset.deleteRecursively();
             dset = GenH5::DataSet{};
@@ -210,10 +287,17 @@ GtH5ExternalizeHelper::overwriteDataSet(const GenH5::DataType& dataType,
     // recreate by path
     if (!dset.isValid())
     {
+        auto* h5Interface = gtH5ExternalizationInterface;
+        auto props = h5Interface->dataSetProperties(dataSpace);
+
+        // only chunked datasets may be extendible
+        auto fileSpace = props.isChunked() ? extendibleDataSpace(dataSpace) :
+                                             dataSpace;
 
         // try retrieving by path
         auto group =  file.root().createGroup(className(m_metaData).toUtf8());
-        dset = group.createDataSet(m_objUuid.toUtf8(), dataType, dataSpace);
+        dset = group.createDataSet(m_objUuid.toUtf8(), dataType,
+                                   fileSpace, props);
 
         // update ref
         referenceDataSet(dset, refVariant);
@@ -228,16 +312,15 @@ GtH5ExternalizeHelper::openDataSet(QVariant& refVariant,
                                    bool fetchInitialVersion
                                    ) const noexcept(false)
 {
-    GenH5::File file = openFile({GenH5::Open | GenH5::ReadOnly},
-                                fetchInitialVersion);
+    GenH5::File file = gtH5ExternalizationInterface->projectHDF5File(
+                fetchInitialVersion, false);
 
     // try retrieving by h5 reference
-    auto dset = dereferenceDataSet(file, refVariant);
+    auto dset = dereferenceDataSet(file, refVariant, dataSetPath());
     if (!dset.isValid())
     {
         // try retrieving by path
-        QStringList path{className(m_metaData), m_objUuid};
-        dset = file.root().openDataSet(path.join('/').toUtf8());
+        dset = file.root().openDataSet(dataSetPath().toUtf8());
 
         // update ref
         referenceDataSet(dset, refVariant);
@@ -246,4 +329,124 @@ GtH5ExternalizeHelper::openDataSet(QVariant& refVariant,
     checkAttributes(dset, extHash(m_metaData));
     return dset;
 }
+
+QString
+GtH5ExternalizeHelper::dataSetPath() const
+{
+    return className(m_metaData) + QStringLiteral("/") + m_objUuid;
+}
+
+bool
+GtH5ExternalizeHelper::readHyperslab(const GenH5::DataSet& dset,
+                                     const GtExternalizedDataSelection& selection,
+                                     const GenH5::DataType& memType,
+                                     const Allocator& allocate) noexcept(false)
+{
+    hid_t fileSpace = H5Dget_space(dset.id());
+    if (fileSpace < 0)
+    {
+        throw GenH5::DataSetException{"Invalid dataspace"};
+    }
+    auto closeFileSpace = gt::finally([fileSpace](){ H5Sclose(fileSpace); });
+    Q_UNUSED(closeFileSpace)
+
+    int const rank = H5Sget_simple_extent_ndims(fileSpace);
+    if (rank < 1)
+    {
+        gtError() << QObject::tr("HDF5: Could not read from the dataset!")
+                  << QObject::tr("(Scalar datasets cannot be selected)");
+        return false;
+    }
+
+    std::vector<hsize_t> dims(rank);
+    H5Sget_simple_extent_dims(fileSpace, dims.data(), nullptr);
+
+    // rows
+    hsize_t const firstRow = selection.firstRow();
+    hsize_t const stride = selection.stride();
+
+    hsize_t available = 0;
+    if (firstRow < dims[0])
+    {
+        available = (dims[0] - firstRow + stride - 1) / stride;
+    }
+
+    hsize_t nRows = available;
+    if (selection.nRows() > 0)
+    {
+        nRows = std::min<hsize_t>(selection.nRows(), available);
+    }
+
+    // contiguous runs of the selected columns (start, count)
+    std::vector<std::pair<hsize_t, hsize_t>> runs;
+    if (rank < 2 || selection.columns().isEmpty())
+    {
+        runs.emplace_back(0, rank < 2 ? 1 : dims[1]);
+    }
+    else
+    {
+        for (quint64 column : selection.columns())
+        {
+            if (column >= dims[1]) break;
+
+            if (!runs.empty() &&
+                runs.back().first + runs.back().second == column)
+            {
+                runs.back().second += 1;
+                continue;
+            }
+            runs.emplace_back(column, 1);
+        }
+    }
+
+    if (nRows == 0 || runs.empty())
+    {
+        allocate(0);
+        return true;
+    }
+
+    std::vector<hsize_t> start(rank, 0);
+    std::vector<hsize_t> strides(rank, 1);
+    std::vector<hsize_t> count(dims);
+
+    start[0] = firstRow;
+    strides[0] = stride;
+    count[0] = nRows;
+
+    H5S_seloper_t op = H5S_SELECT_SET;
+    for (auto const& run : runs)
+    {
+        if (rank >= 2)
+        {
+            start[1] = run.first;
+            count[1] = run.second;
+        }
+
+        if (H5Sselect_hyperslab(fileSpace, op, start.data(), strides.data(),
+                                count.data(), nullptr) < 0)
+        {
+            throw GenH5::DataSpaceException{"Selecting hyperslab failed"};
+        }
+        op = H5S_SELECT_OR;
+    }
+
+    hssize_t const nElements = H5Sget_select_npoints(fileSpace);
+
+    hsize_t memDims = static_cast<hsize_t>(nElements);
+    hid_t memSpace = H5Screate_simple(1, &memDims, nullptr);
+    auto closeMemSpace = gt::finally([memSpace](){ H5Sclose(memSpace); });
+    Q_UNUSED(closeMemSpace)
+
+    void* buffer = allocate(static_cast<size_t>(nElements));
+
+    if (H5Dread(dset.id(), memType.id(), memSpace, fileSpace,
+                H5P_DEFAULT, buffer) < 0)
+    {
+        gtError() << QObject::tr("HDF5: Could not read from the dataset!")
+                  << QObject::tr("(Reading selection failed)");
+        return false;
+    }
+
+    return true;
+}
 #endif
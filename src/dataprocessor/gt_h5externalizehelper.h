@@ -22,6 +22,10 @@
 #include "genh5_dataset.h"
 #include "genh5_file.h"
 
+#include "gt_externalizeddataselection.h"
+
+#include <functional>
+
 class GtExternalizedObject;
 /**
  * @brief The GtH5ExternalizeHelper class.
@@ -61,7 +65,27 @@ public:
               bool fetchInitialVersion) const noexcept(false);
 
     /**
-     * @brief Opens the associated HDF5 file
+     * @brief reads the selected part (hyperslab) of the desired dataset.
+     * Only the selected elements are read from the file. The values are
+     * returned in the order they are stored, i.e. row by row.
+     * @tparam T value type. Must match the type of the dataset elements
+     * @param values selected values
+     * @param refVariant varaint containing the reference to a HDF5 dataset
+     * @param selection selection of the rows (first dimension) and columns
+     * (second dimension)
+     * @param fetchInitialVersion whether to fetch the initial version
+     * @return success (will throw if operation fails)
+     */
+    template<typename T>
+    bool readSelection(QVector<T>& values,
+                       QVariant& refVariant,
+                       const GtExternalizedDataSelection& selection,
+                       bool fetchInitialVersion) const noexcept(false);
+
+    /**
+     * @brief Opens a new handle to the associated HDF5 file. Reading and
+     * writing datasets uses the shared handle of the current file session
+     * instead (see GtH5ExternalizationInterface::projectHDF5File).
      * @param flags Access flags of the file
      * @param accessBackupFile whether to fetch the backup or main project file
      * @return file (will throw if operation fails)
@@ -70,7 +94,10 @@ public:
                          bool accessBackupFile = false) const noexcept(false);
 
     /**
-     * @brief helper method to fetch the desired dataset to (over)write
+     * @brief helper method to fetch the desired dataset to (over)write. New
+     * datasets are chunked, compressed and extendible (see
+     * GtH5ExternalizationInterface::dataSetProperties), thus they are resized
+     * instead of recreated if the dataspace changes.
      * @param dataType hdf5 datatype
      * @param dataSpace hdf5 dataspace
      * @param refVariant varaint containing the reference to a HDF5 dataset
@@ -92,6 +119,28 @@ public:
 
 private:
 
+    /// allocates a buffer for the given number of elements
+    using Allocator = std::function<void*(size_t)>;
+
+    /**
+     * @brief Reads the selected part of the dataset into the buffer
+     * @param dset dataset
+     * @param selection selection of the rows and columns
+     * @param memType datatype of the buffer elements
+     * @param allocate allocates the buffer
+     * @return success (will throw if operation fails)
+     */
+    static bool readHyperslab(const GenH5::DataSet& dset,
+                              const GtExternalizedDataSelection& selection,
+                              const GenH5::DataType& memType,
+                              const Allocator& allocate) noexcept(false);
+
+    /**
+     * @brief Returns the path of the dataset relative to the root group
+     * @return dataset path
+     */
+    QString dataSetPath() const;
+
     /// meta data of the object (e.g. class name)
     QString m_metaData;
     /// uuid of the externalized object
@@ -143,6 +192,23 @@ GtH5ExternalizeHelper::read(Data& data,
 
     return true;
 }
+
+template<typename T>
+inline bool
+GtH5ExternalizeHelper::readSelection(QVector<T>& values,
+                                     QVariant& refVariant,
+                                     const GtExternalizedDataSelection& selection,
+                                     bool fetchInitialVersion) const noexcept(false)
+{
+    // open the associated dataset
+    auto dset = openDataSet(refVariant, fetchInitialVersion);
+
+    return readHyperslab(dset, selection, GenH5::dataType<T>(),
+                         [&values](size_t n) -> void* {
+        values.resize(static_cast<int>(n));
+        return values.data();
+    });
+}
 #endif
 
 #endif // GTH5EXTERNALIZEHELPER
@@ -24,9 +24,25 @@
 
 #include <QUuid>
 #include <QThread>
+#include <QChildEvent>
+#include <QHash>
+#include <QMultiHash>
+#include <QSet>
+#include <QSignalBlocker>
 
 #include <algorithm>
 
+/// Uuid index of an object tree
+struct UuidIndex
+{
+    /// Maps uuids to the objects of the tree
+    QMultiHash<QString, GtObject*> objects;
+
+    /// Placeholders of the tree, that were not materialized yet. Their
+    /// children are unknown until they are loaded
+    QSet<GtObject*> placeholders;
+};
+
 struct DummyData
 {
     QVector<GtObjectMemento::PropertyData> properties;
@@ -87,6 +103,296 @@ struct GtObject::Impl
     /// TODO: use a variant here
     DummyData dummyData;
 
+    /// Linked object file and base directory of its links. Set, if the
+    /// object is a placeholder or was loaded from or saved to the file
+    QString linkedFilePath, linkedFileBaseDir;
+
+    /// False, if the object is a placeholder that was not materialized yet
+    bool materialized{true};
+
+    /// Cached fast hash of the object including its children. Null, if the
+    /// hash has to be recomputed
+    mutable QByteArray hash;
+
+    /// Cached snapshot of the object. Null, if the snapshot has to be
+    /// recreated
+    mutable GtObjectMemento snapshot;
+
+    /// Uuid index of the object tree. Only allocated for root objects once
+    /// an object was requested by its uuid
+    std::unique_ptr<UuidIndex> uuidIndex;
+
+    /// Direct children in the order of QObject::children(). Built on first
+    /// access and kept up to date in childEvent
+    mutable std::vector<GtObject*> children;
+
+    /// Positions of the direct children
+    mutable QHash<QObject const*, int> childNumbers;
+
+    /// False, if the cached children have to be rebuilt
+    mutable bool childrenCached{false};
+
+    /**
+     * @brief Returns the cached direct children of the object. The cache is
+     * rebuilt if necessary.
+     * @param obj Object
+     * @return Direct children
+     */
+    static std::vector<GtObject*> const& directChildren(GtObject const& obj)
+    {
+        Impl& d = *obj.pimpl;
+
+        if (!d.childrenCached)
+        {
+            d.children.clear();
+            d.childNumbers.clear();
+
+            for (QObject* c : obj.children())
+            {
+                if (auto* child = qobject_cast<GtObject*>(c))
+                {
+                    d.childNumbers.insert(child, int(d.children.size()));
+                    d.children.push_back(child);
+                }
+            }
+
+            d.childrenCached = true;
+        }
+
+        return d.children;
+    }
+
+    /**
+     * @brief Updates the cached children once a child was added or removed.
+     * Appending and removing the last child is O(1), otherwise the cache is
+     * invalidated.
+     * @param obj Object
+     * @param event Child event
+     */
+    static void updateChildren(GtObject& obj, QChildEvent& event)
+    {
+        Impl& d = *obj.pimpl;
+
+        if (!d.childrenCached) return;
+
+        if (event.added())
+        {
+            // the child may not be fully constructed yet
+            if (auto* child = qobject_cast<GtObject*>(event.child()))
+            {
+                if (!d.childNumbers.contains(child))
+                {
+                    d.childNumbers.insert(child, int(d.children.size()));
+                    d.children.push_back(child);
+                }
+                return;
+            }
+        }
+        else if (!d.children.empty() && d.children.back() == event.child())
+        {
+            d.childNumbers.remove(d.children.back());
+            d.children.pop_back();
+            return;
+        }
+        else if (!d.childNumbers.contains(event.child()))
+        {
+            // not a cached child
+            return;
+        }
+
+        d.childrenCached = false;
+        d.children.clear();
+        d.childNumbers.clear();
+    }
+
+    /**
+     * @brief Returns the top most object of the GtObject hierarchy the
+     * object belongs to. The uuid index is stored in this object.
+     * @param obj Object
+     * @return Root object
+     */
+    static GtObject& indexRoot(GtObject& obj)
+    {
+        GtObject* root = &obj;
+        while (GtObject* p = root->parentObject())
+        {
+            root = p;
+        }
+        return *root;
+    }
+
+    /**
+     * @brief Returns the uuid index of the object tree or nullptr if no
+     * index was build yet.
+     * @param obj Object of the tree
+     * @return Uuid index
+     */
+    static UuidIndex* activeIndex(GtObject& obj)
+    {
+        return indexRoot(obj).pimpl->uuidIndex.get();
+    }
+
+    /**
+     * @brief Returns the uuid index of the object tree. The index is build if
+     * it does not exist yet.
+     * @param obj Object of the tree
+     * @return Uuid index
+     */
+    static UuidIndex& index(GtObject& obj)
+    {
+        GtObject& root = indexRoot(obj);
+
+        if (!root.pimpl->uuidIndex)
+        {
+            root.pimpl->uuidIndex = std::make_unique<UuidIndex>();
+            insertSubtree(*root.pimpl->uuidIndex, root);
+        }
+
+        return *root.pimpl->uuidIndex;
+    }
+
+    /// Adds the object and all its children to the index
+    static void insertSubtree(UuidIndex& index, GtObject& obj)
+    {
+        if (!obj.pimpl->uuid.isEmpty())
+        {
+            index.objects.insert(obj.pimpl->uuid, &obj);
+        }
+
+        if (!obj.pimpl->materialized)
+        {
+            index.placeholders.insert(&obj);
+        }
+
+        for (GtObject* child : obj.findDirectChildren())
+        {
+            insertSubtree(index, *child);
+        }
+    }
+
+    /// Removes the object and all its children from the index
+    static void removeSubtree(UuidIndex& index, GtObject& obj)
+    {
+        index.objects.remove(obj.pimpl->uuid, &obj);
+        index.placeholders.remove(&obj);
+
+        for (GtObject* child : obj.findDirectChildren())
+        {
+            removeSubtree(index, *child);
+        }
+    }
+
+    /// Sets the uuid of the object and updates the index of the object tree
+    static void updateUuid(GtObject& obj, QString uuid)
+    {
+        UuidIndex* index = activeIndex(obj);
+
+        if (index)
+        {
+            index->objects.remove(obj.pimpl->uuid, &obj);
+        }
+
+        obj.pimpl->uuid = std::move(uuid);
+        invalidateCaches(obj);
+
+        if (index)
+        {
+            index->objects.insert(obj.pimpl->uuid, &obj);
+        }
+    }
+
+    /// Sets whether the object is materialized and updates the placeholders
+    /// of the index of the object tree
+    static void updateMaterialized(GtObject& obj, bool materialized)
+    {
+        obj.pimpl->materialized = materialized;
+
+        if (UuidIndex* index = activeIndex(obj))
+        {
+            if (materialized) index->placeholders.remove(&obj);
+            else index->placeholders.insert(&obj);
+        }
+    }
+
+    /**
+     * @brief Searches the indexed object with the given uuid within the
+     * subtree of the object.
+     * @param obj Root of the subtree
+     * @param uuid Uuid to search for
+     * @return Object or nullptr
+     */
+    static GtObject* findIndexed(GtObject& obj, QString const& uuid)
+    {
+        // the index is shared by the whole object tree, thus only objects
+        // within this subtree are accepted
+        GtObject* retval = nullptr;
+
+        for (GtObject* candidate : index(obj).objects.values(uuid))
+        {
+            if (!isDescendant(*candidate, obj))
+            {
+                continue;
+            }
+
+            // multiple objects share the same uuid, search recursively to
+            // return the same object as a recursive lookup
+            if (retval)
+            {
+                return gt::findObject(uuid, obj.findChildren());
+            }
+
+            retval = candidate;
+        }
+
+        return retval;
+    }
+
+    /**
+     * @brief Returns a placeholder of the subtree of the object.
+     * @param obj Root of the subtree
+     * @return Placeholder or nullptr, if there is none
+     */
+    static GtObject* nextPlaceholder(GtObject& obj)
+    {
+        for (GtObject* placeholder : qAsConst(index(obj).placeholders))
+        {
+            if (placeholder == &obj || isDescendant(*placeholder, obj))
+            {
+                return placeholder;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// Invalidates the cached hash and snapshot of the object and of all its
+    /// parents
+    static void invalidateCaches(GtObject& obj)
+    {
+        for (GtObject* o = &obj; o; o = o->parentObject())
+        {
+            // the caches of the parents cannot be valid either
+            if (o->pimpl->hash.isNull() && o->pimpl->snapshot.isNull()) break;
+
+            o->pimpl->hash.clear();
+            o->pimpl->snapshot = GtObjectMemento();
+        }
+    }
+
+    /// Returns true if obj is a (grand) child of parent
+    static bool isDescendant(GtObject const& obj, GtObject const& parent)
+    {
+        GtObject const* p = obj.parentObject();
+        while (p)
+        {
+            if (p == &parent)
+            {
+                return true;
+            }
+            p = p->parentObject();
+        }
+        return false;
+    }
 };
 
 GtObject::GtObject(GtObject* parent) :
@@ -106,7 +412,16 @@ GtObject::GtObject(GtObject* parent) :
     connect(this, SIGNAL(objectNameChanged(QString)), SLOT(changed()));
 }
 
-GtObject::~GtObject() = default;
+GtObject::~GtObject()
+{
+    // the children are not able to reach the root object once this object
+    // is destroyed, thus the whole subtree is removed from the index here
+    GtObject& root = Impl::indexRoot(*this);
+    if (&root != this && root.pimpl->uuidIndex)
+    {
+        Impl::removeSubtree(*root.pimpl->uuidIndex, *this);
+    }
+}
 
 GtObject::ObjectFlags
 GtObject::objectFlags() const
@@ -181,6 +496,18 @@ GtObject::revertDiff(GtObjectMementoDiff& diff)
     return GtObjectIO::revertDiff(diff, this);
 }
 
+bool
+GtObject::applyDiff(const GtTypedMementoDiff& diff)
+{
+    return GtObjectIO::applyDiff(diff, this);
+}
+
+bool
+GtObject::revertDiff(const GtTypedMementoDiff& diff)
+{
+    return GtObjectIO::revertDiff(diff, this);
+}
+
 namespace {
 GtObject* copyCloneHelper(const GtObject* toCopy,
                           GtAbstractObjectFactory* fac,
@@ -276,7 +603,9 @@ GtObject::appendChildren(const QList<GtObject*>& list)
 void
 GtObject::disconnectFromParent()
 {
-    if (GtObject* p = parentObject())
+    GtObject* p = parentObject();
+
+    if (p)
     {
         // disconnect old signals and slots
         disconnect(this, qOverload<GtObject*>(&GtObject::dataChanged),
@@ -294,6 +623,9 @@ GtObject::disconnectFromParent()
     }
 
     setParent(nullptr);
+
+    // the object was moved away from its parent
+    if (p) p->changed();
 }
 
 QString
@@ -310,13 +642,13 @@ GtObject::setUuid(const QString& val)
         return;
     }
 
-    pimpl->uuid = val;
+    Impl::updateUuid(*this, val);
 }
 
 void
 GtObject::newUuid(bool renewChildUUIDs)
 {
-    pimpl->uuid = QUuid::createUuid().toString();
+    Impl::updateUuid(*this, QUuid::createUuid().toString());
 
     if (renewChildUUIDs)
     {
@@ -333,6 +665,68 @@ GtObject::calcHash() const
     return mem.fullHash().toHex();
 }
 
+GtObjectMemento
+GtObject::snapshot() const
+{
+    if (!pimpl->snapshot.isNull())
+    {
+        return pimpl->snapshot;
+    }
+
+    GtObjectMemento memento = GtObjectIO().toMemento(this, true, true);
+
+    // reuse the snapshots of the children
+    auto const children = findDirectChildren();
+    memento.childObjects.reserve(children.size());
+    for (GtObject const* child : children)
+    {
+        memento.childObjects.push_back(child->snapshot());
+    }
+
+    // only the properties of this object have to be hashed, the snapshots
+    // of the children are hashed already
+    memento.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+
+    pimpl->snapshot = memento;
+
+    return memento;
+}
+
+QByteArray
+GtObject::hash() const
+{
+    if (!pimpl->hash.isNull())
+    {
+        return pimpl->hash;
+    }
+
+    if (!pimpl->snapshot.isNull())
+    {
+        pimpl->hash = pimpl->snapshot.fullHash();
+        return pimpl->hash;
+    }
+
+    // the properties are hashed using a memento without children, the
+    // children contribute their (cached) hashes
+    GtObjectMemento memento = GtObjectIO().toMemento(this, true, true);
+    memento.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+
+    auto const children = findDirectChildren();
+
+    QVector<QByteArray> childHashes;
+    childHashes.reserve(children.size());
+    for (GtObject const* child : children)
+    {
+        childHashes.push_back(child->hash());
+    }
+
+    pimpl->hash = GtObjectMemento::combineHashes(
+        GtObjectMemento::HashAlgorithm::Fast,
+        memento.propertyHash(), childHashes);
+
+    return pimpl->hash;
+}
+
 bool
 GtObject::isDefault() const
 {
@@ -384,7 +778,152 @@ void
 GtObject::setSaveAsOwnFile(bool val)
 {
     setFlag(GtObject::SaveAsOwnFile, val);
+    Impl::invalidateCaches(*this);
+}
+
+bool
+GtObject::isMaterialized() const
+{
+    return pimpl->materialized;
+}
+
+bool
+GtObject::materialize()
+{
+    if (isMaterialized()) return true;
 
+    return materialize(loadLinkedData());
+}
+
+GtObjectMemento
+GtObject::loadLinkedData() const
+{
+    if (isMaterialized()) return {};
+
+    GtObjectMemento placeholder;
+    exportPlaceholderIntoMemento(placeholder);
+
+    QStringList warnings;
+    GtObjectMemento memento = placeholder.loadLinkedFile(&warnings);
+
+    for (const QString& warning : qAsConst(warnings))
+    {
+        gtWarning() << warning;
+    }
+
+    return memento;
+}
+
+bool
+GtObject::materialize(const GtObjectMemento& memento)
+{
+    if (isMaterialized()) return true;
+
+    GtObjectMemento placeholder;
+    exportPlaceholderIntoMemento(placeholder);
+
+    GtAbstractObjectFactory& factory =
+        pimpl->factory ? *pimpl->factory : *gtObjectFactory;
+
+    const GtObject::ObjectFlags flags = objectFlags();
+
+    // mark as materialized before merging, the merge accesses the properties
+    setLinkedFile({}, {});
+
+    // loading the data is no modification, the parents must not be notified
+    QSignalBlocker signalBlocker(this);
+
+    if (memento.isNull() || !memento.mergeTo(*this, factory))
+    {
+        gtError() << tr("Failed to load the linked object file '%1' of '%2'!")
+                     .arg(placeholder.linkedFilePath(), objectName());
+
+        // keep the linked file untouched when saving
+        placeholder.setLinkedFile({}, {});
+        placeholder.setFlagEnabled(GtObjectMemento::IsUnresolved, true);
+        placeholder.mergeTo(*this, factory);
+        return false;
+    }
+
+    for (GtObject* child : findDirectChildren())
+    {
+        child->acceptChangesRecursively();
+    }
+    pimpl->objectFlags = flags;
+
+    // the linked file stays in sync until the object is changed
+    setLinkedFileLocation(placeholder.linkedFilePath(),
+                          placeholder.linkedFileBaseDir());
+
+    return true;
+}
+
+bool
+GtObject::materializeAll()
+{
+    bool success = materialize();
+
+    for (GtObject* child : findDirectChildren())
+    {
+        success = child->materializeAll() && success;
+    }
+
+    return success;
+}
+
+QString
+GtObject::linkedFilePath() const
+{
+    return pimpl->linkedFilePath;
+}
+
+QString
+GtObject::linkedFileBaseDir() const
+{
+    return pimpl->linkedFileBaseDir;
+}
+
+bool
+GtObject::isLinkedFileInSync() const
+{
+    return !pimpl->linkedFilePath.isEmpty() && saveAsOwnFile() &&
+           !hasChanges() && !hasChildChanged() && !newlyCreated();
+}
+
+void
+GtObject::setLinkedFileLocation(const QString& filePath,
+                                const QString& baseDir)
+{
+    if (!isMaterialized() && filePath.isEmpty()) return;
+
+    pimpl->linkedFilePath = filePath;
+    pimpl->linkedFileBaseDir = filePath.isEmpty() ? QString{} : baseDir;
+
+    // the memento of a placeholder references the file
+    if (!isMaterialized()) Impl::invalidateCaches(*this);
+}
+
+void
+GtObject::setLinkedFile(const QString& filePath, const QString& baseDir)
+{
+    pimpl->linkedFilePath = filePath;
+    pimpl->linkedFileBaseDir = filePath.isEmpty() ? QString{} : baseDir;
+    Impl::updateMaterialized(*this, filePath.isEmpty());
+    Impl::invalidateCaches(*this);
+}
+
+void
+GtObject::exportPlaceholderIntoMemento(GtObjectMemento& memento) const
+{
+    memento.setClassName(metaObject()->className());
+    memento.setLinkedFile(pimpl->linkedFilePath, pimpl->linkedFileBaseDir);
+    memento.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+}
+
+void
+GtObject::materializeOnAccess()
+{
+    if (!isMaterialized()) materialize();
 }
 
 void
@@ -405,12 +944,74 @@ GtObject::childNumber() const
 
     if (p)
     {
-        return p->findDirectChildren().indexOf(this);
+        Impl::directChildren(*p);
+        return p->pimpl->childNumbers.value(this, -1);
     }
 
     return -1;
 }
 
+int
+GtObject::directChildCount() const
+{
+    return int(Impl::directChildren(*this).size());
+}
+
+GtObject*
+GtObject::childAt(int index)
+{
+    auto const& children = Impl::directChildren(*this);
+
+    if (index < 0 || index >= int(children.size()))
+    {
+        return nullptr;
+    }
+
+    return children[index];
+}
+
+GtObject const*
+GtObject::childAt(int index) const
+{
+    return const_cast<GtObject*>(this)->childAt(index);
+}
+
+bool
+GtObject::insertChildImpl(int pos, GtObject* obj)
+{
+    auto const& children = Impl::directChildren(*this);
+    int const size = int(children.size());
+
+    if (pos > size)
+    {
+        return false;
+    }
+
+    if (pos == size)
+    {
+        return appendChild(obj);
+    }
+
+    std::vector<GtObject*> elementsBehindPos(children.begin() + pos,
+                                             children.end());
+
+    // detach from the back, thus the cached children are kept
+    for (auto iter = elementsBehindPos.rbegin();
+         iter != elementsBehindPos.rend(); ++iter)
+    {
+        (*iter)->setParent(nullptr);
+    }
+
+    appendChild(obj);
+
+    for (GtObject* element : elementsBehindPos)
+    {
+        element->setParent(this);
+    }
+
+    return true;
+}
+
 QObject*
 GtObject::parent()
 {
@@ -521,6 +1122,7 @@ GtObject::debugObjectTree(int indent)
 const QList<GtAbstractProperty*>&
 GtObject::properties()
 {
+    materializeOnAccess();
     return pimpl->properties;
 }
 
@@ -533,9 +1135,11 @@ GtObject::properties() const
 QList<GtAbstractProperty*>
 GtObject::fullPropertyList()
 {
+    materializeOnAccess();
+
     QList<GtAbstractProperty*> retval;
 
-    for (GtAbstractProperty* prop : properties())
+    for (GtAbstractProperty* prop : qAsConst(pimpl->properties))
     {
         fullPropertyListHelper(prop, retval);
     }
@@ -546,13 +1150,26 @@ GtObject::fullPropertyList()
 QList<GtAbstractProperty const*>
 GtObject::fullPropertyList() const
 {
-    return gt::container_const_cast(
-        const_cast<GtObject*>(this)->fullPropertyList()
-    );
+    QList<GtAbstractProperty*> retval;
+
+    for (GtAbstractProperty* prop : qAsConst(pimpl->properties))
+    {
+        fullPropertyListHelper(prop, retval);
+    }
+
+    return gt::container_const_cast(std::move(retval));
 }
 
 GtAbstractProperty*
 GtObject::findProperty(const QString& id)
+{
+    materializeOnAccess();
+    return const_cast<GtAbstractProperty*>(
+        const_cast<const GtObject*>(this)->findProperty(id));
+}
+
+GtAbstractProperty const*
+GtObject::findProperty(const QString& id) const
 {
     for (GtAbstractProperty* property : qAsConst(pimpl->properties))
     {
@@ -570,14 +1187,16 @@ GtObject::findProperty(const QString& id)
     return nullptr;
 }
 
-GtAbstractProperty const*
-GtObject::findProperty(const QString& id) const
+GtAbstractProperty*
+GtObject::findPropertyByName(const QString& name)
 {
-    return const_cast<GtObject*>(this)->findProperty(id);
+    materializeOnAccess();
+    return const_cast<GtAbstractProperty*>(
+        const_cast<const GtObject*>(this)->findPropertyByName(name));
 }
 
-GtAbstractProperty*
-GtObject::findPropertyByName(const QString& name)
+GtAbstractProperty const*
+GtObject::findPropertyByName(const QString& name) const
 {
     for (GtAbstractProperty* property : qAsConst(pimpl->properties))
     {
@@ -595,12 +1214,6 @@ GtObject::findPropertyByName(const QString& name)
     return nullptr;
 }
 
-GtAbstractProperty const*
-GtObject::findPropertyByName(const QString& name) const
-{
-    return const_cast<GtObject*>(this)->findPropertyByName(name);
-}
-
 GtPropertyStructContainer const *
 GtObject::findPropertyContainer(const QString &id) const
 {
@@ -624,6 +1237,7 @@ GtObject::findPropertyContainer(const QString &id) const
 GtPropertyStructContainer*
 GtObject::findPropertyContainer(const QString &id)
 {
+    materializeOnAccess();
     return const_cast<GtPropertyStructContainer*>
         (const_cast<const GtObject*>(this)->findPropertyContainer(id));
 }
@@ -631,6 +1245,7 @@ GtObject::findPropertyContainer(const QString &id)
 std::vector<std::reference_wrapper<GtPropertyStructContainer>>&
 GtObject::propertyContainers()
 {
+    materializeOnAccess();
     return pimpl->propertyContainer;
 }
 
@@ -643,6 +1258,7 @@ GtObject::propertyContainers() const
 void
 GtObject::changed()
 {
+    Impl::invalidateCaches(*this);
     setFlag(GtObject::HasOwnChanges);
     emit dataChanged(this);
 }
@@ -747,7 +1363,65 @@ GtObject::getObjectByUuid(const QString& objectUUID)
         return this;
     }
 
-    return gt::findObject(objectUUID, findChildren());
+    if (objectUUID.isEmpty())
+    {
+        return nullptr;
+    }
+
+    return Impl::findIndexed(*this, objectUUID);
+}
+
+GtObject*
+GtObject::materializeObjectByUuid(const QString& objectUUID)
+{
+    if (GtObject* retval = getObjectByUuid(objectUUID))
+    {
+        return retval;
+    }
+
+    if (objectUUID.isEmpty())
+    {
+        return nullptr;
+    }
+
+    // materializing a placeholder removes it from the index, thus the loop
+    // ends once all placeholders of the subtree were loaded
+    while (GtObject* placeholder = Impl::nextPlaceholder(*this))
+    {
+        placeholder->materialize();
+
+        if (GtObject* retval = Impl::findIndexed(*this, objectUUID))
+        {
+            return retval;
+        }
+    }
+
+    return nullptr;
+}
+
+GtObject*
+GtObject::materializeObjectByPath(const QString& objectPath)
+{
+    QStringList path = objectPath.split(QStringLiteral(";"));
+
+    if (path.isEmpty() || path.first() != objectName())
+    {
+        return nullptr;
+    }
+
+    GtObject* obj = this;
+    path.removeFirst();
+
+    // only the placeholders on the path are loaded
+    for (const QString& name : qAsConst(path))
+    {
+        obj->materialize();
+
+        obj = obj->findDirectChild(name);
+        if (!obj) return nullptr;
+    }
+
+    return obj;
 }
 
 const GtObject*
@@ -786,6 +1460,7 @@ GtObject::connectProperty(GtAbstractProperty& property)
 {
     connect(&property, &GtAbstractProperty::changed, this,
             [this, p = &property]() {
+        Impl::invalidateCaches(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this, p);
     });
@@ -830,12 +1505,14 @@ void
 GtObject::makeDummy()
 {
     pimpl->makeDummy();
+    Impl::invalidateCaches(*this);
 }
 
 void
 GtObject::importMementoIntoDummy(const GtObjectMemento& memento)
 {
     pimpl->importDummy(memento);
+    Impl::invalidateCaches(*this);
 }
 
 void
@@ -894,18 +1571,21 @@ GtObject::registerPropertyStructContainer(GtPropertyStructContainer & c)
 
     connect(&c, &GtPropertyStructContainer::entryChanged, this,
             [this](int, GtAbstractProperty* property) {
+        Impl::invalidateCaches(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this, property);
     });
 
     connect(&c, &GtPropertyStructContainer::entryAdded, this,
             [this](int) {
+        Impl::invalidateCaches(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this);
     });
 
     connect(&c, &GtPropertyStructContainer::entryRemoved, this,
             [this](int) {
+        Impl::invalidateCaches(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this);
     });
@@ -976,6 +1656,44 @@ GtObject::childAccepted(GtObject* /*child*/)
     return true;
 }
 
+void
+GtObject::childEvent(QChildEvent* event)
+{
+    QObject::childEvent(event);
+
+    if (event->added() || event->removed())
+    {
+        Impl::invalidateCaches(*this);
+        Impl::updateChildren(*this, *event);
+    }
+
+    // the child may already be partially destroyed, in this case the cast
+    // fails and the child was removed from the index in its destructor
+    auto* child = qobject_cast<GtObject*>(event->child());
+    if (!child)
+    {
+        return;
+    }
+
+    if (event->added())
+    {
+        // the subtree is now indexed by the root of this object
+        child->pimpl->uuidIndex.reset();
+
+        if (UuidIndex* index = Impl::activeIndex(*this))
+        {
+            Impl::insertSubtree(*index, *child);
+        }
+    }
+    else if (event->removed())
+    {
+        if (UuidIndex* index = Impl::activeIndex(*this))
+        {
+            Impl::removeSubtree(*index, *child);
+        }
+    }
+}
+
 bool
 gt::isDerivedFromClass(GtObject* obj, const QString& superClassName)
 {
@@ -1048,17 +1766,21 @@ gt::moveToThread(GtObject& object, QThread* thread)
 
     for (auto* obj : qAsConst(objs))
     {
-        const auto allChildProps = obj->fullPropertyList();
+        // use const access, placeholders must not be materialized here
+        GtObject const* cobj = obj;
+
+        const auto allChildProps = cobj->fullPropertyList();
         // move all properties of current object to new thread
         for (auto* childProp : allChildProps)
         {
-            ::moveToThread(childProp, thread);
+            ::moveToThread(const_cast<GtAbstractProperty*>(childProp), thread);
         }
 
         // iterate over struct container and move to new thread
-        for (auto& container: obj->propertyContainers())
+        for (auto& container: cobj->propertyContainers())
         {
-            ::moveToThread(container, thread);
+            ::moveToThread(const_cast<GtPropertyStructContainer&>(
+                               container.get()), thread);
         }
     }
 
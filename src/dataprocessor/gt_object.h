@@ -26,6 +26,7 @@ class GtAbstractObjectFactory;
 class GtAbstractProperty;
 class GtObjectIO;
 class GtObjectMementoDiff;
+class GtTypedMementoDiff;
 class GtPropertyStructContainer;
 
 #define GT_CLASSNAME(A) A::staticMetaObject.className()
@@ -165,6 +166,20 @@ public:
      */
     GtObjectMemento toMemento(bool clone = true) const;
 
+    /**
+     * @brief Creates a memento of the internal object state, which equals
+     * `toMemento(true)`. The snapshot is cached, subsequent snapshots reuse
+     * the (implicitly shared) mementos of all subtrees that did not change in
+     * the meantime. Thus, taking snapshots of large and mostly unchanged
+     * object trees is cheap and diffing them can skip the shared subtrees
+     * (see `GtObjectMemento::isSharedWith`). The hashes of the snapshot are
+     * already computed using `GtObjectMemento::HashAlgorithm::Fast`.
+     *
+     * The cache is invalidated like the cache of `hash`.
+     * @return Memento of the object
+     */
+    GtObjectMemento snapshot() const;
+
     /**
      * @brief fromMemento
      * @param memento
@@ -185,6 +200,20 @@ public:
      */
     bool revertDiff(GtObjectMementoDiff& diff);
 
+    /**
+     * @brief Applies the typed diff on this object and its children.
+     * @param diff Typed diff
+     * @return Success
+     */
+    bool applyDiff(const GtTypedMementoDiff& diff);
+
+    /**
+     * @brief Reverts the typed diff on this object and its children.
+     * @param diff Typed diff
+     * @return Success
+     */
+    bool revertDiff(const GtTypedMementoDiff& diff);
+
     /**
      * @brief copy
      * A second object is creaated which is nearly identical to the object.
@@ -251,6 +280,23 @@ public:
      */
     QString calcHash() const;
 
+    /**
+     * @brief Returns a hash of the object including all its children, which
+     * is meant for in-memory change detection only (e.g. to quickly check
+     * whether two object trees differ). The hash is computed using a fast
+     * non-cryptographic hash function and equals the full hash of the
+     * object memento computed with `GtObjectMemento::HashAlgorithm::Fast`.
+     *
+     * The hash is cached and only recomputed for the subtrees that changed
+     * since the last call. The cache is invalidated by property changes,
+     * by adding or removing children, by renaming the object and by
+     * `changed()`. Changes of the
+     * object state that are not signaled must be followed by a call to
+     * `changed()`. Use `calcHash` for hashes that are persisted.
+     * @return Hash of the object
+     */
+    QByteArray hash() const;
+
     /**
      * @brief Returns true if is default flag is active. Otherwise false is
      * returned.
@@ -304,6 +350,87 @@ public:
      */
     void setSaveAsOwnFile(bool);
 
+    /**
+     * @brief Returns false, if the object is a placeholder of a linked object
+     * file, that was not loaded yet (see gt::xml::LinkedObjectLoading).
+     *
+     * A placeholder only knows its class, name and uuid. Its properties are
+     * loaded on the first non-const property access, its children by calling
+     * `materialize`. Const access and lookups never load placeholders, use
+     * `materializeObjectByUuid` or `materializeObjectByPath` to search the
+     * linked object files explicitly.
+     * @return Whether the object data is loaded
+     */
+    bool isMaterialized() const;
+
+    /**
+     * @brief Loads the data of a placeholder object from its linked file.
+     * Nested linked objects become placeholders themselves. If the file
+     * cannot be loaded, the object is turned into an unresolved dummy.
+     * Does nothing, if the object is materialized already.
+     * @return Whether the object data is loaded
+     */
+    bool materialize();
+
+    /**
+     * @brief Reads the data of a placeholder object from its linked file
+     * without applying it, e.g. to announce the children before they are
+     * added. Use `materialize(const GtObjectMemento&)` to apply the data.
+     * @return Data of the object. Null, if the object is materialized or the
+     * file cannot be loaded
+     */
+    GtObjectMemento loadLinkedData() const;
+
+    /**
+     * @brief Materializes a placeholder object using the data read by
+     * `loadLinkedData`. If the data is null, the object is turned into an
+     * unresolved dummy.
+     * @param memento Data of the object
+     * @return Whether the object data is loaded
+     */
+    bool materialize(const GtObjectMemento& memento);
+
+    /**
+     * @brief Materializes the object and all of its children recursively,
+     * e.g. before the object tree is exported or processed as a whole.
+     * @return Whether all objects could be materialized
+     */
+    bool materializeAll();
+
+    /**
+     * @brief Returns the linked object file (see `saveAsOwnFile`) the object
+     * data is stored in. For placeholders, the data is loaded from this file.
+     * Otherwise, it is the file the object was loaded from or saved to last,
+     * which is only in sync with the object as long as it has no changes
+     * (see `isLinkedFileInSync`).
+     * @return Absolute file path or an empty string
+     */
+    QString linkedFilePath() const;
+
+    /**
+     * @brief Returns the directory the object references inside the linked
+     * object file are relative to.
+     * @return Base directory or an empty string
+     */
+    QString linkedFileBaseDir() const;
+
+    /**
+     * @brief Returns true, if the object is stored in its own file and
+     * neither the object nor its children changed since the file was loaded
+     * or saved. In this case, the file does not have to be written again.
+     * @return Whether the linked object file is up to date
+     */
+    bool isLinkedFileInSync() const;
+
+    /**
+     * @brief Sets the linked object file the object was saved to. An empty
+     * path resets the location of a materialized object.
+     * @param filePath Absolute path of the linked object file
+     * @param baseDir Directory the references in the file are relative to
+     */
+    void setLinkedFileLocation(const QString& filePath,
+                               const QString& baseDir);
+
     /**
      * @brief setFactory
      * @param factory
@@ -311,11 +438,28 @@ public:
     void setFactory(GtAbstractObjectFactory* factory);
 
     /**
-     * @brief Returns the position index from the parent child list
+     * @brief Returns the position index from the parent child list. The
+     * child list of the parent is cached, thus this is O(1) in general.
      * @return position index. Returns -1 if the obejct does not have a parent
      */
     int childNumber() const;
 
+    /**
+     * @brief Returns the number of direct GtObject children. Uses the cached
+     * child list.
+     * @return Number of direct children
+     */
+    int directChildCount() const;
+
+    /**
+     * @brief Returns the direct GtObject child at the given position. Uses
+     * the cached child list.
+     * @param index Position of the child (see childNumber)
+     * @return Child object. Null if the index is out of range
+     */
+    GtObject* childAt(int index);
+    GtObject const* childAt(int index) const;
+
     /**
      * @brief Reimplemented from QObject. Returns the parent with const
      * correctness
@@ -510,6 +654,7 @@ public:
 
     /**
      * @brief findChildren
+     * The children of placeholders are not included (see isMaterialized).
      * @param name - optional string to search child with given name
      * @return returns list of pointers to children of the template class
      */
@@ -581,6 +726,11 @@ public:
             return false;
         }
 
+        if constexpr (std::is_same<T, GtObject*>::value)
+        {
+            return insertChildImpl(pos, obj);
+        }
+
         QList<T> list = findDirectChildren<T>();
 
         if (pos > list.size())
@@ -616,6 +766,10 @@ public:
      * Searches for an object with the uuid.
      * The functions checks the object itself and all children if one of them
      * has an identical uuid to the given argument.
+     * The lookup uses a uuid index stored in the root object, which is build
+     * on first use and kept up to date while the object tree changes.
+     * Placeholders are not loaded, use materializeObjectByUuid to search
+     * their linked files as well.
      * @param uuid
      * @return the pointer to the found object with the given uuid,
      * if no object was found return nullptr.
@@ -623,6 +777,24 @@ public:
     GtObject* getObjectByUuid(const QString& objectUUID);
     GtObject const* getObjectByUuid(const QString& objectUUID) const;
 
+    /**
+     * @brief Searches for an object with the uuid like getObjectByUuid. If it
+     * is not found, the placeholders of the subtree are materialized one
+     * after another until it is found. Thus, all linked object files of the
+     * subtree are loaded if the object does not exist.
+     * @param objectUUID Uuid of the object
+     * @return Object or nullptr
+     */
+    GtObject* materializeObjectByUuid(const QString& objectUUID);
+
+    /**
+     * @brief Searches for an object with the path like getObjectByPath. The
+     * placeholders on the path are materialized to search their children.
+     * @param objectPath Object path
+     * @return Object or nullptr
+     */
+    GtObject* materializeObjectByPath(const QString& objectPath);
+
     /**
      * @brief getDirectChildByUuid
      * @param objectUUID
@@ -760,6 +932,13 @@ protected:
      */
     virtual bool childAccepted(GtObject* child);
 
+    /**
+     * @brief Reimplemented from QObject. Keeps the uuid index of the root
+     * object up to date if children are added or removed.
+     * @param event Child event
+     */
+    void childEvent(QChildEvent* event) override;
+
 protected slots:
     /**
      * @brief changed
@@ -771,6 +950,15 @@ private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
 
+    /**
+     * @brief Inserts the object at the given position of the cached child
+     * list
+     * @param pos Position
+     * @param obj Object to insert
+     * @return Success
+     */
+    bool insertChildImpl(int pos, GtObject* obj);
+
     /**
      * @brief objectPath
      * @return
@@ -805,6 +993,18 @@ private:
     void importMementoIntoDummy(const GtObjectMemento&);
     void exportDummyIntoMemento(GtObjectMemento&) const;
 
+    /**
+     * @brief Turns the object into a placeholder of the given linked object
+     * file or, if the path is empty, marks the object as materialized.
+     */
+    void setLinkedFile(const QString& filePath, const QString& baseDir);
+    void exportPlaceholderIntoMemento(GtObjectMemento&) const;
+
+    /**
+     * @brief Materializes a placeholder on non-const property access
+     */
+    void materializeOnAccess();
+
     // ObjectPtr may be const
     template <typename R, typename ObjectPtr>
     static R propertiesByTypeHelper(ObjectPtr obj)
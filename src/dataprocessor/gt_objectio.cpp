@@ -12,6 +12,8 @@
 #include <QStringList>
 #include <QMetaProperty>
 #include <QDomDocument>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 #include <QUuid>
 #include <QPointF>
 #include <QDataStream>
@@ -19,8 +21,10 @@
 #include <QDebug>
 #include <QMetaType>
 #include <QStringRef>
+#include <QHash>
 
 #include <cfloat>
+#include <memory>
 #include <typeinfo>
 
 #include "gt_object.h"
@@ -28,6 +32,7 @@
 #include "gt_objectfactory.h"
 #include "gt_objectmemento.h"
 #include "gt_objectmementodiff.h"
+#include "gt_typedmementodiff.h"
 #include "gt_abstractproperty.h"
 #include "gt_propertystructcontainer.h"
 #include "gt_structproperty.h"
@@ -55,6 +60,18 @@ namespace
         Revert
     };
 
+    /// Assigns new uuids to the memento and its children
+    void
+    renewUuids(GtObjectMemento& memento)
+    {
+        memento.setUuid(QUuid::createUuid().toString());
+
+        for (GtObjectMemento& child : memento.childObjects)
+        {
+            renewUuids(child);
+        }
+    }
+
     QVariant
     propertyToVariant(const QString& value, const QString& type);
     QVariant
@@ -222,14 +239,35 @@ GtObjectIO::setFactory(GtAbstractObjectFactory* factory)
 }
 
 GtObjectMemento
-GtObjectIO::toMemento(const GtObject* o, bool clone)
+GtObjectIO::toMemento(const GtObject* o, bool clone, bool skipChildren)
 {
     // global object element
     GtObjectMemento memento;
 
 
     // class name
-    if (o->isDummy())
+    if (!o->isMaterialized())
+    {
+        // the data is still stored in the linked file
+        o->exportPlaceholderIntoMemento(memento);
+        memento.setUuid(o->uuid());
+        memento.setIdent(o->objectName());
+
+        if (clone) return memento;
+
+        // a copy must not share the uuids of the linked objects
+        GtObjectMemento copy = memento.loadLinkedFile(nullptr, true);
+        if (copy.isNull())
+        {
+            gtWarning() << QObject::tr("Could not load the linked object file "
+                                       "'%1' of '%2'!")
+                           .arg(memento.linkedFilePath(), o->objectName());
+            copy = memento;
+        }
+        renewUuids(copy);
+        return copy;
+    }
+    else if (o->isDummy())
     {
         o->exportDummyIntoMemento(memento);
     }
@@ -255,6 +293,11 @@ GtObjectIO::toMemento(const GtObject* o, bool clone)
 
     memento.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, o->saveAsOwnFile());
 
+    if (skipChildren)
+    {
+        return memento;
+    }
+
     // child objects
     auto const directChildren = o->findDirectChildren();
     memento.childObjects.reserve(directChildren.size());
@@ -272,6 +315,20 @@ QDomElement
 GtObjectIO::toDomElement(const GtObjectMemento& memento, QDomDocument& doc,
                          bool skipChildren)
 {
+    if (memento.isFlagEnabled(GtObjectMemento::IsPlaceholder))
+    {
+        // keep the reference to the linked file, which was not loaded yet
+        QDomElement element = doc.createElement(gt::xml::S_OBJECTREF_TAG);
+        element.setAttribute(gt::xml::S_CLASS_TAG, memento.className());
+        element.setAttribute(gt::xml::S_NAME_TAG, memento.ident());
+        element.setAttribute(gt::xml::S_UUID_TAG, memento.uuid());
+        element.setAttribute(gt::xml::S_HREF_TAG, memento.linkedFilePath());
+        element.setAttribute(gt::xml::S_LOAD_TAG, gt::xml::S_LOAD_ONDEMAND);
+        element.setAttribute(gt::xml::S_LINKBASE_TAG,
+                             memento.linkedFileBaseDir());
+        return element;
+    }
+
     // global object element
     QDomElement element = doc.createElement(gt::xml::S_OBJECT_TAG);
 
@@ -319,6 +376,160 @@ GtObjectIO::toDomElement(const GtObjectMemento& memento, QDomDocument& doc,
     return element;
 }
 
+namespace
+{
+
+/// Writes the text like gt::xml::writeDomElementOrderedAttribute does
+void
+writeXmlText(QXmlStreamWriter& writer, QString text)
+{
+    // remove carriage returns to avoid double definitions
+    if (text.contains(QLatin1Char('\r')))
+    {
+        text.remove(QLatin1Char('\r'));
+    }
+
+    writer.writeCharacters(text);
+}
+
+} // namespace
+
+void
+GtObjectIO::writeXml(const GtObjectMemento& memento, QXmlStreamWriter& writer,
+                     bool skipChildren)
+{
+    // attributes are written in alphabetical order
+    if (memento.isFlagEnabled(GtObjectMemento::IsPlaceholder))
+    {
+        writer.writeStartElement(gt::xml::S_OBJECTREF_TAG);
+        writer.writeAttribute(gt::xml::S_CLASS_TAG, memento.className());
+        writer.writeAttribute(gt::xml::S_HREF_TAG, memento.linkedFilePath());
+        writer.writeAttribute(gt::xml::S_LINKBASE_TAG,
+                              memento.linkedFileBaseDir());
+        writer.writeAttribute(gt::xml::S_LOAD_TAG, gt::xml::S_LOAD_ONDEMAND);
+        writer.writeAttribute(gt::xml::S_NAME_TAG, memento.ident());
+        writer.writeAttribute(gt::xml::S_UUID_TAG, memento.uuid());
+        writer.writeEndElement();
+        return;
+    }
+
+    writer.writeStartElement(gt::xml::S_OBJECT_TAG);
+
+    if (memento.isFlagEnabled(GtObjectMemento::SaveAsOwnFile))
+    {
+        writer.writeAttribute(gt::xml::S_ASLINK_TAG,
+                              memento.isFlagEnabled(
+                                  GtObjectMemento::IsUnresolved) ?
+                                  QStringLiteral("refonly") :
+                                  QStringLiteral("true"));
+    }
+
+    writer.writeAttribute(gt::xml::S_CLASS_TAG, memento.className());
+    writer.writeAttribute(gt::xml::S_NAME_TAG, memento.ident());
+    writer.writeAttribute(gt::xml::S_UUID_TAG, memento.uuid());
+
+    for (const GtObjectMemento::PropertyData& property : memento.properties)
+    {
+        writeXml(property, writer);
+    }
+
+    for (const GtObjectMemento::PropertyData& container :
+         memento.propertyContainers)
+    {
+        writer.writeStartElement(QStringLiteral("property-container"));
+        writer.writeAttribute(gt::xml::S_NAME_TAG, container.name);
+
+        for (const auto& childProperty : container.childProperties)
+        {
+            writeXml(childProperty, writer);
+        }
+
+        writer.writeEndElement();
+    }
+
+    if (!skipChildren && !memento.childObjects.isEmpty())
+    {
+        writer.writeStartElement(gt::xml::S_OBJECTLIST_TAG);
+
+        for (const GtObjectMemento& child : memento.childObjects)
+        {
+            writeXml(child, writer);
+        }
+
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+}
+
+void
+GtObjectIO::writeXml(const GtObjectMemento::PropertyData& property,
+                     QXmlStreamWriter& writer)
+{
+    using PD = GtObjectMemento::PropertyData;
+
+    bool const isList = property.type() == PD::DATA_T &&
+                        usePropertyList(property.data());
+
+    writer.writeStartElement(isList ? gt::xml::S_PROPERTYLIST_TAG :
+                                      gt::xml::S_PROPERTY_TAG);
+
+    // only write active, if active == false, otherwise assume true
+    if (!property.isActive)
+    {
+        writer.writeAttribute(gt::xml::S_ACTIVE_TAG,
+                              QVariant(false).toString());
+    }
+
+    writer.writeAttribute(gt::xml::S_NAME_TAG, property.name);
+
+    switch (property.type())
+    {
+    case PD::ENUM_T:
+        writer.writeAttribute(gt::xml::S_TYPE_TAG, property.dataType());
+        writeXmlText(writer, property.data().toString());
+        break;
+    case PD::STRUCT_T:
+    {
+        writer.writeAttribute(gt::xml::S_TYPE_TAG, property.dataType());
+
+        QString value = variantToString(property.data());
+        if (!value.isEmpty())
+        {
+            writeXmlText(writer, std::move(value));
+        }
+
+        for (const auto& subchild : property.childProperties)
+        {
+            writeXml(subchild, writer);
+        }
+        break;
+    }
+    case PD::DATA_T:
+        if (isList)
+        {
+            QString varStr, varType;
+            propertyListStringType(property.data(), varStr, varType);
+
+            writer.writeAttribute(gt::xml::S_TYPE_TAG, varType);
+            writeXmlText(writer, std::move(varStr));
+        }
+        else
+        {
+            writer.writeAttribute(gt::xml::S_TYPE_TAG, property.dataType());
+
+            QString value = variantToString(property.data());
+            if (!value.isEmpty())
+            {
+                writeXmlText(writer, std::move(value));
+            }
+        }
+        break;
+    }
+
+    writer.writeEndElement();
+}
+
 GtObjectMemento
 GtObjectIO::toMemento(const QDomElement& e)
 {
@@ -329,6 +540,16 @@ GtObjectIO::toMemento(const QDomElement& e)
         .setUuid(e.attribute(gt::xml::S_UUID_TAG))
         .setIdent(e.attribute(gt::xml::S_NAME_TAG));
 
+    if (e.tagName() == gt::xml::S_OBJECTREF_TAG &&
+        e.hasAttribute(gt::xml::S_LINKBASE_TAG))
+    {
+        // The reader kept the object ref to load it on demand
+        memento.setLinkedFile(e.attribute(gt::xml::S_HREF_TAG),
+                              e.attribute(gt::xml::S_LINKBASE_TAG));
+        memento.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+        return memento;
+    }
+
     if (e.tagName() == gt::xml::S_OBJECTREF_TAG)
     {
         // The object ref could not be resolved by the reader, so we
@@ -367,6 +588,238 @@ GtObjectIO::toMemento(const QDomElement& e)
     return memento;
 }
 
+namespace
+{
+
+/// Returns true, if the current element of the reader has the given tag
+inline bool
+isElement(const QXmlStreamReader& reader, const char* tag)
+{
+    return reader.name() == QLatin1String(tag);
+}
+
+/// Returns the value of the attribute or an empty string
+inline QString
+attributeValue(const QXmlStreamAttributes& attrs, const char* name)
+{
+    return attrs.value(QLatin1String(name)).toString();
+}
+
+/**
+ * @brief Reads the text of the current element including the text of its
+ * child elements like QDomElement::text() does. Whitespace-only text is
+ * dropped by the DOM parser, thus it is ignored as well.
+ * Afterwards, the reader is positioned at the end element.
+ */
+QString
+readElementText(QXmlStreamReader& reader)
+{
+    QString text;
+    int depth = 1;
+
+    while (depth > 0 && !reader.atEnd())
+    {
+        switch (reader.readNext())
+        {
+        case QXmlStreamReader::StartElement:
+            ++depth;
+            break;
+        case QXmlStreamReader::EndElement:
+            --depth;
+            break;
+        case QXmlStreamReader::Characters:
+            if (reader.isCDATA() || !reader.isWhitespace())
+            {
+                text += reader.text();
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    return text;
+}
+
+/// Streaming counterpart of readProperty
+GtObjectMemento::PropertyData
+readXmlProperty(QXmlStreamReader& reader)
+{
+    QXmlStreamAttributes const attrs = reader.attributes();
+
+    GtObjectMemento::PropertyData propData;
+    propData.name = attributeValue(attrs, gt::xml::S_NAME_TAG);
+    propData.setData(propertyToVariant(readElementText(reader),
+                                       attributeValue(attrs,
+                                                      gt::xml::S_TYPE_TAG)));
+
+    QString fieldActive = attributeValue(attrs, gt::xml::S_ACTIVE_TAG);
+    if (!fieldActive.isEmpty())
+    {
+        propData.isActive = QVariant(fieldActive).toBool();
+    }
+
+    return propData;
+}
+
+/// Streaming counterpart of readStructPropertyEntry
+bool
+readXmlStructPropertyEntry(QXmlStreamReader& reader,
+                           GtObjectMemento::PropertyData& pd)
+{
+    QXmlStreamAttributes const attrs = reader.attributes();
+
+    const auto typeName = attributeValue(attrs, gt::xml::S_TYPE_TAG);
+    const auto name = attributeValue(attrs, gt::xml::S_NAME_TAG);
+
+    if (typeName.isEmpty() || name.isEmpty())
+    {
+        gtError().noquote().nospace()
+                << "Empty " << (typeName.isEmpty() ? "type" : "name")
+                << " in property container entry on line "
+                << reader.lineNumber();
+        reader.skipCurrentElement();
+        return false;
+    }
+
+    pd.toStruct(typeName);
+    pd.name = name;
+
+    while (reader.readNextStartElement())
+    {
+        if (isElement(reader, gt::xml::S_PROPERTY_TAG))
+        {
+            pd.childProperties.push_back(readXmlProperty(reader));
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    return true;
+}
+
+/// Streaming counterpart of readPropertyContainer
+GtObjectMemento::PropertyData
+readXmlPropertyContainer(QXmlStreamReader& reader)
+{
+    GtObjectMemento::PropertyData pd;
+    pd.name = attributeValue(reader.attributes(), gt::xml::S_NAME_TAG);
+
+    while (reader.readNextStartElement())
+    {
+        if (!isElement(reader, gt::xml::S_PROPERTY_TAG))
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        GtObjectMemento::PropertyData entry;
+        if (readXmlStructPropertyEntry(reader, entry))
+        {
+            pd.childProperties.push_back(std::move(entry));
+        }
+    }
+
+    return pd;
+}
+
+} // namespace
+
+GtObjectMemento
+GtObjectIO::readXml(QXmlStreamReader& reader,
+                    const ObjectRefReader& readObjectRef)
+{
+    QXmlStreamAttributes const attrs = reader.attributes();
+
+    auto memento = GtObjectMemento{}
+        .setClassName(attributeValue(attrs, gt::xml::S_CLASS_TAG))
+        .setUuid(attributeValue(attrs, gt::xml::S_UUID_TAG))
+        .setIdent(attributeValue(attrs, gt::xml::S_NAME_TAG));
+
+    if (isElement(reader, gt::xml::S_OBJECTREF_TAG))
+    {
+        if (attrs.hasAttribute(QLatin1String(gt::xml::S_LINKBASE_TAG)))
+        {
+            // The reader kept the object ref to load it on demand
+            memento.setLinkedFile(attributeValue(attrs, gt::xml::S_HREF_TAG),
+                                  attributeValue(attrs,
+                                                 gt::xml::S_LINKBASE_TAG));
+            memento.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+        }
+        else
+        {
+            // The object ref could not be resolved by the reader
+            memento.setFlagEnabled(GtObjectMemento::IsUnresolved, true);
+        }
+
+        reader.skipCurrentElement();
+        return memento;
+    }
+
+    // like toMemento, only the first object list is read
+    bool childrenRead = false;
+
+    while (reader.readNextStartElement())
+    {
+        if (isElement(reader, gt::xml::S_PROPERTY_TAG))
+        {
+            memento.properties.push_back(readXmlProperty(reader));
+        }
+        else if (isElement(reader, gt::xml::S_PROPERTYLIST_TAG))
+        {
+            QXmlStreamAttributes const listAttrs = reader.attributes();
+            QString fieldType = attributeValue(listAttrs, gt::xml::S_TYPE_TAG);
+            QString fieldName = attributeValue(listAttrs, gt::xml::S_NAME_TAG);
+            QString value = readElementText(reader);
+
+            if (!fieldType.isEmpty() && !fieldName.isEmpty())
+            {
+                GtObjectMemento::PropertyData propData;
+                propData.name = fieldName;
+                propData.setData(propertyListToVariant(value, fieldType));
+
+                memento.properties.push_back(propData);
+            }
+        }
+        else if (isElement(reader, gt::xml::S_PROPERTYCONT_TAG))
+        {
+            memento.propertyContainers.push_back(
+                readXmlPropertyContainer(reader));
+        }
+        else if (isElement(reader, gt::xml::S_OBJECTLIST_TAG) &&
+                 !childrenRead)
+        {
+            childrenRead = true;
+
+            while (reader.readNextStartElement())
+            {
+                if (isElement(reader, gt::xml::S_OBJECT_TAG))
+                {
+                    memento.childObjects.push_back(
+                        readXml(reader, readObjectRef));
+                }
+                else if (isElement(reader, gt::xml::S_OBJECTREF_TAG))
+                {
+                    memento.childObjects.push_back(
+                        readObjectRef ? readObjectRef(reader) :
+                                        readXml(reader));
+                }
+                else
+                {
+                    reader.skipCurrentElement();
+                }
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    return memento;
+}
 
 bool
 applyDiffOnObject(QDomElement& parent, GtObject* parentObject, DiffMode mode)
@@ -398,6 +851,9 @@ applyDiffOnObject(QDomElement& parent, GtObject* parentObject, DiffMode mode)
         ext->internalize();
     }
 
+    // the same applies for linked objects, that were not loaded yet
+    parentObject->materialize();
+
     do
     {
         auto iter = diffFuncs.find(diffTag.tagName());
@@ -1601,3 +2057,387 @@ handleIndexChange(GtObject& parent,
 }
 
 } // namespace
+
+namespace
+{
+
+using Operation = GtTypedMementoDiff::Operation;
+using OperationType = GtTypedMementoDiff::OperationType;
+
+bool
+applyTypedPropertyChange(GtAbstractProperty* prop, QObject& target,
+                         const Operation& op, DiffMode mode)
+{
+    const bool revert = mode == DiffMode::Revert;
+    const QVariant& newVal = revert ? op.oldValue : op.newValue;
+
+    if (!prop)
+    {
+        if (target.property(op.id.toLatin1()) != newVal)
+        {
+            return target.setProperty(op.id.toLatin1(), newVal);
+        }
+        return true;
+    }
+
+    if (op.oldValue != op.newValue)
+    {
+        prop->setValueFromVariant(newVal);
+    }
+
+    if (op.oldActive != op.newActive)
+    {
+        prop->setActive(revert ? op.oldActive : op.newActive);
+    }
+
+    return true;
+}
+
+bool
+applyTypedContainerEntryAdd(GtPropertyStructContainer& container,
+                            const Operation& op, int index)
+{
+    const GtObjectMemento::PropertyData& pd = op.entry;
+
+    // check of entry already included
+    if (container.findEntry(pd.name) != container.end())
+    {
+        return false;
+    }
+
+    if (index < 0 || index > static_cast<long>(container.size()))
+    {
+        return false;
+    }
+
+    auto pos = container.begin();
+    std::advance(pos, index);
+
+    try
+    {
+        // might throw due to unknown typeid
+        auto& entry = container.newEntry(pd.dataType(), pos, pd.name);
+
+        // import memento to struct
+        gt::importStructEntryFromMemento(pd, entry);
+    }
+    catch(GTlabException& e)
+    {
+        gtError() << e.what();
+    }
+
+    return true;
+}
+
+bool
+applyTypedContainerOperation(GtObject& target, const Operation& op,
+                             DiffMode mode)
+{
+    auto container = target.findPropertyContainer(op.id);
+    if (!container)
+    {
+        gtError() << "Invalid container name in memento diff. Cannot apply";
+        return false;
+    }
+
+    if (op.type == OperationType::ContainerEntryChange)
+    {
+        auto entry = container->findEntry(op.entryId);
+        if (entry == container->end())
+        {
+            gtError() << "Invalid entryName value in memento diff";
+            return false;
+        }
+
+        for (const Operation& change : op.changes)
+        {
+            auto* prop = entry->findProperty(change.id);
+            if (prop)
+                applyTypedPropertyChange(prop, target, change, mode);
+            else
+                gtError() << "Property " << change.id
+                          << "not found in property container entry";
+        }
+
+        return true;
+    }
+
+    const bool doAdd = (op.type == OperationType::ContainerEntryAdd) !=
+                       (mode == DiffMode::Revert);
+
+    if (doAdd)
+    {
+        return applyTypedContainerEntryAdd(*container, op,
+                                           mode == DiffMode::Apply ?
+                                               op.newIndex : op.oldIndex);
+    }
+
+    auto iter = container->findEntry(op.entry.name);
+    if (iter == container->end())
+    {
+        // uuid not in container
+        return false;
+    }
+
+    container->removeEntry(iter);
+
+    return true;
+}
+
+bool
+isChildOperation(const Operation& op)
+{
+    return op.type == OperationType::ObjectAdd ||
+           op.type == OperationType::ObjectRemove ||
+           op.type == OperationType::IndexChange;
+}
+
+/**
+ * @brief Applies a single operation. Operations on the children are only
+ * applied here in apply mode, see `revertTypedChildChanges`.
+ */
+bool
+applyTypedOperation(GtObject& target, const Operation& op, DiffMode mode)
+{
+    const bool revert = mode == DiffMode::Revert;
+
+    switch (op.type)
+    {
+    case OperationType::AttributeChange:
+        if (op.id == gt::xml::S_NAME_TAG)
+        {
+            target.setObjectName(revert ? op.oldValue.toString()
+                                        : op.newValue.toString());
+        }
+        return true;
+
+    case OperationType::PropertyChange:
+        return applyTypedPropertyChange(target.findProperty(op.id), target,
+                                        op, mode);
+
+    case OperationType::ObjectAdd:
+    {
+        auto newObj = op.object.toObject(*GtObjectFactory::instance());
+
+        if (!newObj)
+        {
+            gtDebug() << "Could not restore object from memento";
+            return false;
+        }
+
+        if (op.newIndex >= target.findDirectChildren().size())
+        {
+            return target.appendChild(newObj.release());
+        }
+
+        return target.insertChild(op.newIndex, newObj.release());
+    }
+
+    case OperationType::ObjectRemove:
+    {
+        GtObject* toRemove = target.getDirectChildByUuid(op.object.uuid());
+
+        if (!toRemove)
+        {
+            gtDebug() << "object not found! (" << op.object.uuid() << ")";
+            return false;
+        }
+
+        delete toRemove;
+        return true;
+    }
+
+    case OperationType::IndexChange:
+    {
+        GtObject* toMove = target.getDirectChildByUuid(op.object.uuid());
+
+        if (!toMove)
+        {
+            return false;
+        }
+
+        toMove->setParent(nullptr);
+
+        if (op.newIndex > target.findDirectChildren().size())
+        {
+            return target.appendChild(toMove);
+        }
+
+        return target.insertChild(op.newIndex, toMove);
+    }
+
+    case OperationType::ContainerEntryAdd:
+    case OperationType::ContainerEntryRemove:
+    case OperationType::ContainerEntryChange:
+        return applyTypedContainerOperation(target, op, mode);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Reverts the added, removed and moved children of the target.
+ * Instead of moving the children one by one, the original child order is
+ * restored at once: Removed and moved children are placed at their old
+ * indices, all other children keep their relative order.
+ */
+bool
+revertTypedChildChanges(GtObject& target,
+                        const std::vector<Operation>& operations)
+{
+    QHash<QString, int> oldIndices;
+    std::vector<std::unique_ptr<GtObject>> restored;
+
+    for (const Operation& op : operations)
+    {
+        if (op.type == OperationType::ObjectAdd)
+        {
+            GtObject* added = target.getDirectChildByUuid(op.object.uuid());
+
+            if (!added)
+            {
+                gtDebug() << "object not found! (" << op.object.uuid() << ")";
+                return false;
+            }
+
+            delete added;
+        }
+        else if (op.type == OperationType::ObjectRemove)
+        {
+            auto obj = op.object.toObject(*GtObjectFactory::instance());
+
+            if (!obj)
+            {
+                gtDebug() << "Could not restore object from memento";
+                return false;
+            }
+
+            oldIndices.insert(op.object.uuid(), op.oldIndex);
+            restored.push_back(std::move(obj));
+        }
+        else if (op.type == OperationType::IndexChange)
+        {
+            oldIndices.insert(op.object.uuid(), op.oldIndex);
+        }
+    }
+
+    const QList<GtObject*> children = target.findDirectChildren();
+    const int size = children.size() + static_cast<int>(restored.size());
+
+    QVector<GtObject*> order(size, nullptr);
+    QList<GtObject*> remaining;
+
+    auto const place = [&](GtObject* obj) {
+        int idx = oldIndices.value(obj->uuid(), -1);
+
+        if (idx >= 0 && idx < size && !order[idx]) order[idx] = obj;
+        else remaining.append(obj);
+    };
+
+    for (GtObject* child : children) place(child);
+    for (auto& obj : restored) place(obj.get());
+
+    auto next = remaining.begin();
+    for (GtObject*& slot : order)
+    {
+        if (!slot) slot = *next++;
+    }
+
+    // children in front of the first misplaced child stay untouched
+    int first = 0;
+    while (first < children.size() && children[first] == order[first])
+    {
+        ++first;
+    }
+
+    for (int i = first; i < children.size(); ++i)
+    {
+        children[i]->setParent(nullptr);
+    }
+
+    for (int i = first; i < size; ++i)
+    {
+        target.appendChild(order[i]);
+    }
+
+    for (auto& obj : restored) obj.release();
+
+    return true;
+}
+
+bool
+applyTypedChange(GtObject& target,
+                 const GtTypedMementoDiff::ObjectChange& change,
+                 DiffMode mode)
+{
+    // object must be fetched when applying/reverting diff
+    if (auto* ext = qobject_cast<GtExternalizedObject*>(&target))
+    {
+        ext->internalize();
+    }
+
+    // the same applies for linked objects, that were not loaded yet
+    target.materialize();
+
+    bool okay = true;
+    bool hasChildChanges = false;
+
+    for (const Operation& op : change.operations)
+    {
+        if (mode == DiffMode::Revert && isChildOperation(op))
+        {
+            hasChildChanges = true;
+            continue;
+        }
+
+        okay = okay && applyTypedOperation(target, op, mode);
+    }
+
+    if (okay && hasChildChanges)
+    {
+        okay = revertTypedChildChanges(target, change.operations);
+    }
+
+    return okay;
+}
+
+} // namespace
+
+bool
+GtObjectIO::applyDiff(const GtTypedMementoDiff& diff, GtObject* obj)
+{
+    return applyTypedDiff(diff, obj, false);
+}
+
+bool
+GtObjectIO::revertDiff(const GtTypedMementoDiff& diff, GtObject* obj)
+{
+    return applyTypedDiff(diff, obj, true);
+}
+
+bool
+GtObjectIO::applyTypedDiff(const GtTypedMementoDiff& diff, GtObject* obj,
+                           bool revert)
+{
+    for (const GtTypedMementoDiff::ObjectChange& change : diff.objectChanges())
+    {
+        if (change.uuid.isEmpty())
+        {
+            return false;
+        }
+
+        GtObject* target = obj->getObjectByUuid(change.uuid);
+
+        if (!target ||
+            !applyTypedChange(*target, change,
+                              revert ? DiffMode::Revert : DiffMode::Apply))
+        {
+            return false;
+        }
+
+        target->onObjectDataMerged();
+        target->onObjectDiffMerged();
+    }
+
+    return true;
+}
@@ -15,14 +15,19 @@
 #include <QPointF>
 #include <QSet>
 
+#include <functional>
+
 #include "gt_objectmemento.h"
 #include "gt_qtutilities.h"
 
 class QDomElement;
 class QDomDocument;
+class QXmlStreamWriter;
+class QXmlStreamReader;
 class GtObject;
 class GtAbstractObjectFactory;
 class GtObjectMementoDiff;
+class GtTypedMementoDiff;
 class GtAbstractProperty;
 
 /**
@@ -46,8 +51,10 @@ public:
     /** Creates Memento from given GtObject.
         @param o GtObject pointer
         @param clone Wether identiy information should be cloned or not
+        @param skipChildren Wether only the properties of this GtObject should be stored or also all child-GtObjects
         @return GtObjectMemento memento */
-    GtObjectMemento toMemento(const GtObject* o, bool clone = true);
+    GtObjectMemento toMemento(const GtObject* o, bool clone = true,
+                              bool skipChildren = false);
 
     /** Creates QDomElement from given GtObjectMemento.
         @param m GtObjectMemento
@@ -67,11 +74,55 @@ public:
     QDomElement toDomElement(const GtObjectMemento::PropertyData& m,
                              QDomDocument& doc);
 
+    /**
+     * @brief Writes the memento directly to the stream writer.
+     *
+     * The output is identical to writing the element created by
+     * toDomElement using gt::xml::writeDomElementOrderedAttribute, but no
+     * intermediate DOM tree is built.
+     * @param m GtObjectMemento
+     * @param writer Stream writer
+     * @param skipChildren Wether the child objects should be omitted
+     */
+    void writeXml(const GtObjectMemento& m,
+                  QXmlStreamWriter& writer,
+                  bool skipChildren = false);
+
+    /**
+     * @brief Writes the property memento data directly to the stream writer.
+     * Counterpart of toDomElement for property data.
+     * @param m A memento property
+     * @param writer Stream writer
+     */
+    void writeXml(const GtObjectMemento::PropertyData& m,
+                  QXmlStreamWriter& writer);
+
     /** Creates Memento from given QDomElement.
         @param e QDomElement with memento data
         @return GtObjectMemento memento */
     GtObjectMemento toMemento(const QDomElement& e);
 
+    /// Function reading the objectref element the reader is positioned at.
+    /// It has to consume the element.
+    using ObjectRefReader = std::function<GtObjectMemento(QXmlStreamReader&)>;
+
+    /**
+     * @brief Creates a memento directly from the object element the reader
+     * is positioned at, without building a DOM tree.
+     *
+     * The result is identical to toMemento(const QDomElement&) of the
+     * parsed element. Afterwards, the reader is positioned at the end
+     * element of the object.
+     * @param reader Stream reader positioned at an object or objectref
+     * start element
+     * @param readObjectRef Optional function reading the objectref elements
+     * of the child objects, e.g. to resolve the linked files. By default,
+     * they are read like toMemento(const QDomElement&) does.
+     * @return GtObjectMemento memento
+     */
+    GtObjectMemento readXml(QXmlStreamReader& reader,
+                            const ObjectRefReader& readObjectRef = {});
+
 
     /**
      * @brief applyDiff
@@ -89,6 +140,23 @@ public:
      */
     static bool revertDiff(GtObjectMementoDiff& diff, GtObject* obj);
 
+    /**
+     * @brief Applies the typed diff on the object tree. The typed values
+     * of the diff are set directly, no XML has to be parsed.
+     * @param diff Typed diff
+     * @param obj Root object
+     * @return Whether the diff could be applied
+     */
+    static bool applyDiff(const GtTypedMementoDiff& diff, GtObject* obj);
+
+    /**
+     * @brief Reverts the typed diff on the object tree.
+     * @param diff Typed diff
+     * @param obj Root object
+     * @return Whether the diff could be reverted
+     */
+    static bool revertDiff(const GtTypedMementoDiff& diff, GtObject* obj);
+
     /**
      *  Converts given QVariant to QString.
      *  @param var QVariant
@@ -133,6 +201,16 @@ private:
     /// Pointer to current object factory
     GtAbstractObjectFactory* m_factory;
 
+    /**
+     * @brief Applies or reverts the typed diff on the object tree.
+     * @param diff Typed diff
+     * @param obj Root object
+     * @param revert Whether to revert the diff
+     * @return Success
+     */
+    static bool applyTypedDiff(const GtTypedMementoDiff& diff, GtObject* obj,
+                               bool revert);
+
     /**
      * @brief writeProperties
      * @param m memento
@@ -13,6 +13,7 @@
 #include <QIODevice>
 #include <QDataStream>
 #include <QMetaProperty>
+#include <QXmlStreamReader>
 
 #include "gt_externalizedobject.h"
 #include "gt_objectmemento.h"
@@ -22,7 +23,9 @@
 #include "gt_propertystructcontainer.h"
 #include "gt_structproperty.h"
 #include "gt_exceptions.h"
+#include "gt_xmlutilities.h"
 #include "internal/varianthasher.h"
+#include "internal/gt_mementobinaryformat.h"
 #include "internal/gt_externalizedobjectprivate.h"
 
 using PD = GtObjectMemento::PropertyData;
@@ -48,15 +51,33 @@ GtObjectMemento::GtObjectMemento(const QDomElement& element)
 
 GtObjectMemento::GtObjectMemento(const QByteArray& byteArray)
 {
+    if (isBinary(byteArray))
+    {
+        *this = gt::detail::MementoBinaryFormat::read(byteArray);
+        return;
+    }
 
-    QDomDocument doc;
-    if (!doc.setContent(byteArray))
+    // read the memento directly without building a DOM document
+    QXmlStreamReader reader(byteArray);
+    if (!reader.readNextStartElement())
     {
         return;
     }
 
-    *this = GtObjectIO().toMemento(doc.documentElement());
+    GtObjectMemento memento = GtObjectIO().readXml(reader);
+
+    // the rest of the document must be well-formed as well
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+    }
 
+    if (reader.hasError())
+    {
+        return;
+    }
+
+    *this = std::move(memento);
 }
 
 bool
@@ -96,6 +117,26 @@ GtObjectMemento::toByteArray() const
     return doc.toByteArray();
 }
 
+QByteArray
+GtObjectMemento::toByteArray(Format format) const
+{
+    switch (format)
+    {
+    case Format::Binary:
+        return gt::detail::MementoBinaryFormat::write(*this);
+    case Format::Xml:
+        break;
+    }
+
+    return toByteArray();
+}
+
+bool
+GtObjectMemento::isBinary(const QByteArray& data)
+{
+    return gt::detail::MementoBinaryFormat::isBinary(data);
+}
+
 const QString&
 GtObjectMemento::className() const
 {
@@ -144,11 +185,34 @@ GtObjectMemento::canCastTo(const QString& classname,
     return classHierarchy.contains(classname);
 }
 
+namespace
+{
+
+/// Creates a hash object of the given type
+template <typename Hash>
+struct HashInit;
+
+template <>
+struct HashInit<QCryptographicHash>
+{
+    static QCryptographicHash make()
+    {
+        return QCryptographicHash(QCryptographicHash::Sha256);
+    }
+};
+
+template <>
+struct HashInit<gt::detail::FastHash>
+{
+    static gt::detail::FastHash make() { return gt::detail::FastHash(0); }
+};
+
+template <typename Hash>
 void
-propertyHashHelper(const PD& property, QCryptographicHash& hash,
-                                    gt::detail::VariantHasher& variantHasher)
+propertyHashHelper(const PD& property, Hash& hash,
+                   gt::detail::VariantHasher& variantHasher)
 {
-    QCryptographicHash propHash(QCryptographicHash::Sha256);
+    Hash propHash = HashInit<Hash>::make();
 
     // hash property
     propHash.addData(property.name.toUtf8());
@@ -181,45 +245,126 @@ propertyHashHelper(const PD& property, QCryptographicHash& hash,
     hash.addData(property.hash);
 }
 
+template <typename Hash>
 void
-GtObjectMemento::calculateHashes() const
+calculateHashesHelper(const GtObjectMemento& memento,
+                      GtObjectMemento::HashAlgorithm algorithm,
+                      QByteArray& propertyHash, QByteArray& fullHash)
 {
-    if (!m_fullHash.isNull())
-    {
-        return;
-    }
-
     // initialize hash function
-    QCryptographicHash hash(QCryptographicHash::Sha256);
+    Hash hash = HashInit<Hash>::make();
 
     // hash members
-    hash.addData(className().toUtf8());
-    hash.addData(uuid().toUtf8());
-    hash.addData(ident().toUtf8());
+    hash.addData(memento.className().toUtf8());
+    hash.addData(memento.uuid().toUtf8());
+    hash.addData(memento.ident().toUtf8());
+    // placeholders never equal the loaded data
+    if (memento.isFlagEnabled(GtObjectMemento::IsPlaceholder))
+    {
+        hash.addData(memento.linkedFilePath().toUtf8());
+    }
     // hash properties
     gt::detail::VariantHasher variantHasher;
-    foreach(const auto &p, properties)
+    foreach(const auto &p, memento.properties)
     {
         propertyHashHelper(p, hash, variantHasher);
     }
 
-    foreach(const PropertyData &p, propertyContainers)
+    foreach(const PD &p, memento.propertyContainers)
     {
         propertyHashHelper(p, hash, variantHasher);
     }
 
     // store property hash
-    m_propertyHash = hash.result();
-    hash.reset();
+    propertyHash = hash.result();
 
     // hash over property hash and child elements
-    hash.addData(m_propertyHash);
-    for (int i = 0; i < childObjects.size(); i++)
+    QVector<QByteArray> childHashes;
+    childHashes.reserve(memento.childObjects.size());
+    for (const GtObjectMemento& child : memento.childObjects)
+    {
+        child.calculateHashes(algorithm);
+        childHashes.push_back(child.fullHash());
+    }
+    fullHash = GtObjectMemento::combineHashes(algorithm, propertyHash,
+                                              childHashes);
+}
+
+template <typename Hash>
+QByteArray
+combineHashesHelper(const QByteArray& propertyHash,
+                    const QVector<QByteArray>& childHashes)
+{
+    Hash hash = HashInit<Hash>::make();
+
+    hash.addData(propertyHash);
+    for (const QByteArray& childHash : childHashes)
+    {
+        hash.addData(childHash);
+    }
+    return hash.result();
+}
+
+} // namespace
+
+void
+GtObjectMemento::calculateHashes() const
+{
+    calculateHashes(HashAlgorithm::Sha256);
+}
+
+bool
+GtObjectMemento::isSharedWith(const GtObjectMemento& other) const
+{
+    return properties.constData() == other.properties.constData() &&
+           propertyContainers.constData() ==
+               other.propertyContainers.constData() &&
+           childObjects.constData() == other.childObjects.constData() &&
+           m_flags == other.m_flags &&
+           m_linkedFilePath == other.m_linkedFilePath &&
+           m_uuid == other.m_uuid &&
+           m_className == other.m_className &&
+           m_ident == other.m_ident;
+}
+
+QByteArray
+GtObjectMemento::combineHashes(HashAlgorithm algorithm,
+                               const QByteArray& propertyHash,
+                               const QVector<QByteArray>& childHashes)
+{
+    switch (algorithm)
     {
-        childObjects[i].calculateHashes();
-        hash.addData(childObjects[i].m_fullHash);
+    case HashAlgorithm::Fast:
+        return combineHashesHelper<gt::detail::FastHash>(propertyHash,
+                                                         childHashes);
+    case HashAlgorithm::Sha256:
+        break;
+    }
+
+    return combineHashesHelper<QCryptographicHash>(propertyHash, childHashes);
+}
+
+void
+GtObjectMemento::calculateHashes(HashAlgorithm algorithm) const
+{
+    if (!m_fullHash.isNull() && m_hashAlgorithm == algorithm)
+    {
+        return;
+    }
+
+    m_hashAlgorithm = algorithm;
+
+    switch (algorithm)
+    {
+    case HashAlgorithm::Fast:
+        calculateHashesHelper<gt::detail::FastHash>(
+            *this, algorithm, m_propertyHash, m_fullHash);
+        break;
+    case HashAlgorithm::Sha256:
+        calculateHashesHelper<QCryptographicHash>(
+            *this, algorithm, m_propertyHash, m_fullHash);
+        break;
     }
-    m_fullHash = hash.result();
 }
 
 bool
@@ -241,6 +386,45 @@ GtObjectMemento::setFlagEnabled(GtObjectMemento::Flag flag, bool enable)
     }
 }
 
+const QString&
+GtObjectMemento::linkedFilePath() const
+{
+    return m_linkedFilePath;
+}
+
+const QString&
+GtObjectMemento::linkedFileBaseDir() const
+{
+    return m_linkedFileBaseDir;
+}
+
+GtObjectMemento&
+GtObjectMemento::setLinkedFile(const QString& filePath, const QString& baseDir)
+{
+    m_linkedFilePath = filePath;
+    m_linkedFileBaseDir = filePath.isEmpty() ? QString{} : baseDir;
+    setFlagEnabled(IsPlaceholder, !filePath.isEmpty());
+    return *this;
+}
+
+GtObjectMemento
+GtObjectMemento::loadLinkedFile(QStringList* warnings, bool recursive) const
+{
+    if (!isFlagEnabled(IsPlaceholder)) return {};
+
+    GtObjectMemento memento = gt::xml::loadLinkedObjectMemento(
+        m_linkedFilePath, QDir(m_linkedFileBaseDir), warnings,
+        recursive ? gt::xml::LinkedObjectLoading::Eager :
+                    gt::xml::LinkedObjectLoading::OnDemand);
+
+    if (memento.isNull()) return {};
+
+    memento.setUuid(m_uuid).setIdent(m_ident);
+    memento.m_flags = m_flags & ~IsPlaceholder;
+
+    return memento;
+}
+
 bool
 GtObjectMemento::isRestorable(GtAbstractObjectFactory* factory) const
 {
@@ -600,6 +784,17 @@ GtObjectMemento::mergeTo(GtObject& obj, GtAbstractObjectFactory& factory) const
     obj.setUuid(uuid());
     obj.setObjectName(ident());
 
+    if (isFlagEnabled(IsPlaceholder))
+    {
+        // the data is loaded on first access
+        obj.setLinkedFile(m_linkedFilePath, m_linkedFileBaseDir);
+        obj.setFlag(GtObject::SaveAsOwnFile, true);
+        return true;
+    }
+
+    // the merged data replaces a placeholder
+    obj.setLinkedFile({}, {});
+
     if (isFlagEnabled(IsUnresolved))
     {
         // we need to make it a dummy, to avoid changing the original object
@@ -27,6 +27,14 @@ class QCryptographicHash;
 class VariantHasher;
 class GtPropertyStructInstance;
 
+namespace gt
+{
+namespace detail
+{
+class MementoBinaryFormat;
+} // namespace detail
+} // namespace gt
+
 /**
  * @brief The GtObjectMemento class
  */
@@ -47,8 +55,9 @@ public:
     explicit GtObjectMemento(const QDomElement& element);
 
     /**
-     * @brief GtObjectMemento
-     * @param byteArray
+     * @brief Restores a serialized memento. Both the XML and the binary
+     * format are supported.
+     * @param byteArray Serialized memento
      */
     explicit GtObjectMemento(const QByteArray& byteArray);
 
@@ -67,6 +76,32 @@ public:
      */
     QByteArray toByteArray() const;
 
+    /**
+     * @brief Serialization format of a memento
+     */
+    enum class Format
+    {
+        Xml,   /// XML representation, used for project files
+        Binary /// Compact versioned binary representation, used for
+               /// in-process and inter-process transfers
+    };
+
+    /**
+     * @brief Serializes the memento using the given format. The byte array
+     * constructor detects the format automatically.
+     * @param format Serialization format
+     * @return Serialized memento
+     */
+    QByteArray toByteArray(Format format) const;
+
+    /**
+     * @brief Returns whether the data contains a memento serialized using the
+     * binary format.
+     * @param data Serialized memento
+     * @return Is binary
+     */
+    static bool isBinary(const QByteArray& data);
+
     /**
      * TODO: move to object io
      *
@@ -212,6 +247,8 @@ public:
         mutable QByteArray hash;
 
     private:
+        friend class gt::detail::MementoBinaryFormat;
+
         QVariant _data;    /// The data as a variant
         QString _dataType; /// The type of the data
         PropertyType _type  {DATA_T};
@@ -237,11 +274,52 @@ public:
      */
     const QByteArray& fullHash() const {return m_fullHash;}
 
+    /**
+     * @brief Algorithm used to compute the property and full hashes
+     */
+    enum class HashAlgorithm
+    {
+        Sha256, /// Cryptographic hash, use it for persisted hashes
+        Fast    /// Non-cryptographic 128 bit hash for in-memory comparisons
+    };
+
     /**
      * @brief update fullHash and propertyHash, needs to be called before accessing these
      */
     void calculateHashes() const;
 
+    /**
+     * @brief update fullHash and propertyHash using the given algorithm.
+     * The hashes are only recomputed if they were not computed yet or if they
+     * were computed using a different algorithm.
+     * @param algorithm Hash algorithm
+     */
+    void calculateHashes(HashAlgorithm algorithm) const;
+
+    /**
+     * @brief Returns true, if this memento and the other memento share the
+     * same (implicitly shared) data, which is the case for copies of the same
+     * memento, e.g. snapshots of unchanged subtrees (see
+     * `GtObject::snapshot`). Shared mementos are always equal, mementos that
+     * are not shared may still be equal.
+     * @param other Other memento
+     * @return Whether the mementos share their data
+     */
+    bool isSharedWith(const GtObjectMemento& other) const;
+
+    /**
+     * @brief Computes the full hash of an object from its property hash and
+     * the full hashes of its children. The result equals `fullHash` of the
+     * corresponding memento.
+     * @param algorithm Hash algorithm
+     * @param propertyHash Property hash of the object
+     * @param childHashes Full hashes of the child objects
+     * @return Full hash
+     */
+    static QByteArray combineHashes(HashAlgorithm algorithm,
+                                    const QByteArray& propertyHash,
+                                    const QVector<QByteArray>& childHashes);
+
     struct ExternalizationInfo
     {
         bool isFetched = true;
@@ -256,8 +334,11 @@ public:
     enum Flag
     {
         SaveAsOwnFile = 1, /// The memento should be serialized into an own file
-        IsUnresolved  = 2  /// Is enabled, if the memento data could not be fully
+        IsUnresolved  = 2, /// Is enabled, if the memento data could not be fully
                            /// restored from disk, e.g. the linked file was not found
+        IsPlaceholder = 4  /// The memento is a placeholder of a linked object
+                           /// file, that was not loaded yet. It holds neither
+                           /// properties nor children (see linkedFilePath)
     };
 
     /**
@@ -270,6 +351,43 @@ public:
      */
     void setFlagEnabled(Flag, bool enabled);
 
+    /**
+     * @brief Path of the linked object file of a placeholder memento
+     * @return Absolute file path. Empty, if the memento is no placeholder
+     */
+    const QString& linkedFilePath() const;
+
+    /**
+     * @brief Base directory of the links inside the linked object file of a
+     * placeholder memento
+     * @return Absolute directory path. Empty, if the memento is no placeholder
+     */
+    const QString& linkedFileBaseDir() const;
+
+    /**
+     * @brief Sets the linked object file of a placeholder memento. The flag
+     * IsPlaceholder is set accordingly.
+     * @param filePath Absolute path of the linked object file. If empty, the
+     * memento is no placeholder anymore.
+     * @param baseDir Base directory of the links inside the file
+     * @return This
+     */
+    GtObjectMemento& setLinkedFile(const QString& filePath,
+                                   const QString& baseDir);
+
+    /**
+     * @brief Loads the linked object file of a placeholder memento.
+     *
+     * The uuid, ident and flags of the placeholder are kept.
+     * @param warnings Optional output list for warning messages
+     * @param recursive Whether nested linked objects are loaded as well.
+     * Otherwise, they are placeholders themselves.
+     * @return The memento of the linked object. Null, if the file could not
+     * be loaded or if this memento is no placeholder.
+     */
+    GtObjectMemento loadLinkedFile(QStringList* warnings = nullptr,
+                                   bool recursive = false) const;
+
     QVector<PropertyData> properties;
     QVector<PropertyData> propertyContainers;
     QVector<GtObjectMemento> childObjects;
@@ -286,11 +404,17 @@ private:
 
     QString m_className, m_uuid, m_ident;
 
+    /// linked object file of placeholder mementos
+    QString m_linkedFilePath, m_linkedFileBaseDir;
+
     /**
      * @brief cached hashes of a GtObject (properties only) and the full GtObject (including all its children)
      */
     mutable QByteArray m_propertyHash, m_fullHash;
 
+    /// algorithm used to compute the cached hashes
+    mutable HashAlgorithm m_hashAlgorithm{HashAlgorithm::Sha256};
+
     /**
      * if true, the memento likes to be serialized into a separate file
      */
@@ -11,31 +11,41 @@
 
 #include "gt_objectmementodiff.h"
 #include "gt_objectmemento.h"
-#include "gt_externalizedobject.h"
-#include "gt_qtutilities.h"
+#include "gt_object.h"
 #include "gt_objectio.h"
-#include "gt_algorithms.h"
 #include "gt_xmlexpr.h"
-#include "gt_objectfactory.h"
-
-#include <QCryptographicHash>
-#include <QHash>
-
-#include <algorithm>
-#include <optional>
 
 using PD = GtObjectMemento::PropertyData;
+using Operation = GtTypedMementoDiff::Operation;
+using OperationType = GtTypedMementoDiff::OperationType;
 
 GtObjectMementoDiff::GtObjectMementoDiff(const GtObjectMemento& left,
-        const GtObjectMemento& right)
+        const GtObjectMemento& right) :
+    GtObjectMementoDiff(GtTypedMementoDiff(left, right))
+{
+}
+
+GtObjectMementoDiff::GtObjectMementoDiff(const GtTypedMementoDiff& diff)
 {
-    if (!left.isNull() && !right.isNull())
+    if (diff.hasRootMismatch())
+    {
+        appendChild(createElement(QStringLiteral("ROOT_ERROR")));
+        return;
+    }
+
+    for (const GtTypedMementoDiff::ObjectChange& change : diff.objectChanges())
     {
-        QDomElement nullElem;
-        if (!makeDiff(left, right, nullElem))
+        QDomElement diffObj = createElement(gt::xml::S_OBJECT_TAG);
+        diffObj.setAttribute(gt::xml::S_NAME_TAG, change.ident);
+        diffObj.setAttribute(gt::xml::S_UUID_TAG, change.uuid);
+        diffObj.setAttribute(gt::xml::S_CLASS_TAG, change.className);
+
+        for (const Operation& op : change.operations)
         {
-            gtError() << QObject::tr("DIFF FAILED!!!");
+            appendOperation(op, diffObj);
         }
+
+        appendChild(diffObj);
     }
 }
 
@@ -169,331 +179,39 @@ GtObjectMementoDiff::numberOfDiffSteps()
     return retval;
 }
 
-/// helper struct for return value of setup function
-struct FetchMementoResult
-{
-    // indicates if setup was sucessful
-    bool success = true;
-    // optional replacement for left or right memento
-    std::optional<GtObjectMemento> left{}, right{};
-};
-
-FetchMementoResult
-fetchExternalizedMementos(const GtObjectMemento& leftOrig,
-                          const GtObjectMemento& rightOrig,
-                          GtAbstractObjectFactory& factory)
+void
+GtObjectMementoDiff::appendOperation(const Operation& op, QDomElement& diffObj)
 {
-    auto const externalizationInfoLeft = leftOrig.externalizationInfo(factory);
-
-    // not an externalized object -> nothing to do
-    if (!externalizationInfoLeft.isValid()) return {};
-
-    auto const externalizationInfoRight = rightOrig.externalizationInfo(factory);
-    assert(externalizationInfoRight.isValid());
-
-    // check if we can diff the data
-    if (!externalizationInfoLeft.isFetched &&
-        !externalizationInfoRight.isFetched &&
-        externalizationInfoLeft.hash != externalizationInfoRight.hash)
-    {
-        gtError() << QObject::tr("Inconsitency in externalized data for '%1' "
-                                 "detected! Aborting diff operation!")
-                     .arg(leftOrig.ident());
-        return { false };
-    }
-
-    if (externalizationInfoLeft.isFetched && externalizationInfoRight.isFetched)
-    {
-        // nothing to do here ->  both object mementos are fetched!
-        return {};
-    }
-
-    auto tmpInstanceLeft  = std::unique_ptr<QObject>(externalizationInfoLeft.metaObject->newInstance());
-    auto tmpInstanceRight = std::unique_ptr<QObject>(externalizationInfoRight.metaObject->newInstance());
-
-    auto externalizedObjectLeft  = gt::unique_qobject_cast<GtExternalizedObject>(std::move(tmpInstanceLeft));
-    auto externalizedObjectRight = gt::unique_qobject_cast<GtExternalizedObject>(std::move(tmpInstanceRight));
-
-    // check if object was recreated successfully
-    if (!externalizedObjectLeft ||
-        !externalizedObjectRight ||
-        !leftOrig.mergeTo(*externalizedObjectLeft, factory) ||
-        !rightOrig.mergeTo(*externalizedObjectRight, factory))
-    {
-        gtError() << QObject::tr("Failed to restore externalized object data "
-                                 "of '%1' for diff creation!")
-                     .arg(leftOrig.ident());
-        return { false };
+    switch (op.type)
+    {
+    case OperationType::AttributeChange:
+        handleAttributeChange(op.id, op.oldValue.toString(),
+                              op.newValue.toString(), diffObj);
+        break;
+    case OperationType::PropertyChange:
+        handlePropertyChange(op, diffObj);
+        break;
+    case OperationType::ObjectAdd:
+        handleObjectAdded(GtObjectIO().toDomElement(op.object, *this),
+                          op.newIndex, diffObj);
+        break;
+    case OperationType::ObjectRemove:
+        handleObjectRemoved(GtObjectIO().toDomElement(op.object, *this),
+                            op.oldIndex, diffObj);
+        break;
+    case OperationType::IndexChange:
+        handleIndexChanged(op.object, op.oldIndex, op.newIndex, diffObj);
+        break;
+    case OperationType::ContainerEntryAdd:
+        handleContainerElementAdded(op.id, op.newIndex, op.entry, diffObj);
+        break;
+    case OperationType::ContainerEntryRemove:
+        handleContainerElementRemoved(op.id, op.oldIndex, op.entry, diffObj);
+        break;
+    case OperationType::ContainerEntryChange:
+        handleContainerElementChanged(op.id, op.entryId, op.changes, diffObj);
+        break;
     }
-
-    // check which memento to fetch
-    bool fetchLeft = !externalizationInfoLeft.isFetched;
-
-    auto const& externalizationInfo =
-            fetchLeft ? externalizationInfoLeft : externalizationInfoRight;
-    auto& objectToFetch =
-            fetchLeft ? externalizedObjectLeft  : externalizedObjectRight;
-    auto& fetchedObject =
-            fetchLeft ? externalizedObjectRight : externalizedObjectLeft;
-
-    // check if object must be fetched
-    if (externalizationInfo.hash == fetchedObject->calcExtHash())
-    {
-        // nothing to do here -> diffs are equal
-        return {};
-    }
-
-    if (!objectToFetch->internalize())
-    {
-        gtError() << QObject::tr("Failed to internalize %1 memento for '%2'!")
-                     .arg(fetchLeft ? "left" : "right", leftOrig.ident());
-        return { false };
-    }
-
-    FetchMementoResult result{};
-    (fetchLeft ? result.left : result.right) = objectToFetch->toMemento();
-    return result;
-}
-
-bool
-GtObjectMementoDiff::makeDiff(const GtObjectMemento& leftOrig,
-                              const GtObjectMemento& rightOrig,
-                              QDomElement& diffRoot)
-{
-    // update hashes if needed
-    leftOrig.calculateHashes();
-    rightOrig.calculateHashes();
-    if (leftOrig.fullHash() == rightOrig.fullHash() && diffRoot.isNull())
-    {
-        gtDebug() << QObject::tr("compared object mementos are identical!");
-        return true;
-    }
-
-    if (leftOrig.uuid() != rightOrig.uuid())
-    {
-        gtWarning() << QObject::tr("root objects not equal!");
-        QDomElement rootError =
-            this->createElement(QStringLiteral("ROOT_ERROR"));
-        if (diffRoot.isNull())
-        {
-            this->appendChild(rootError);
-        }
-        else
-        {
-            diffRoot.appendChild(rootError);
-        }
-        return false;
-    }
-
-    // left or right memento may needs to be fetched in case it belongs to an
-    // externalized object
-    auto setup = fetchExternalizedMementos(leftOrig, rightOrig, *gtObjectFactory);
-
-    if (!setup.success) return false;
-
-    const GtObjectMemento& left =  setup.left.value_or(leftOrig);
-    const GtObjectMemento& right = setup.right.value_or(rightOrig);
-
-    // create diff element to store changes
-    QDomElement diffObj = this->createElement(gt::xml::S_OBJECT_TAG);
-    diffObj.setAttribute(gt::xml::S_NAME_TAG, left.ident());
-    diffObj.setAttribute(gt::xml::S_UUID_TAG, left.uuid());
-    diffObj.setAttribute(gt::xml::S_CLASS_TAG, left.className());
-    // modified child elements are stored in their own element
-    // this way we may not want to actually add the diffObj element (if empty)!
-    bool diffObjectEmpty = true;
-
-    // check properties & attributes
-    if (left.propertyHash() != right.propertyHash())
-    {
-        diffObjectEmpty = false;
-
-        if (left.className() != right.className())
-        {
-            handleAttributeChange(gt::xml::S_CLASS_TAG,
-                                  left.className(),
-                                  right.className(),
-                                  diffObj);
-        }
-
-        if (left.ident() != right.ident())
-        {
-            handleAttributeChange(gt::xml::S_NAME_TAG,
-                                  left.ident(),
-                                  right.ident(),
-                                  diffObj);
-        }
-
-
-        detectPropertyChanges(left.properties, right.properties, diffObj);
-        detectDynamicPropertyChanges(left.propertyContainers,
-                                     right.propertyContainers,
-                                     diffObj);
-    }
-
-    // create map of child object uuids
-    QHash<QString,int> leftChildIndexMap;
-    QHash<QString, int> completeMap;
-    QHash<QString, int> indexChangeMap;
-    for (int lchildIndex = 0; lchildIndex < left.childObjects.size(); lchildIndex++)
-    {
-        const GtObjectMemento& lchild(left.childObjects[lchildIndex]);
-        leftChildIndexMap.insert(lchild.uuid(), lchildIndex);
-        completeMap.insert(lchild.uuid(), lchildIndex);
-    }
-
-    // look for modified/added children
-    for (int rchildIndex = 0; rchildIndex < right.childObjects.size(); rchildIndex++)
-    {
-        const GtObjectMemento& rchild (right.childObjects[rchildIndex]);
-        auto lchildIter = leftChildIndexMap.find(rchild.uuid());
-        if (lchildIter != leftChildIndexMap.end())
-        {
-            // check for modifications
-            const GtObjectMemento& lchild(left.childObjects[*lchildIter]);
-            if (lchild.fullHash() != rchild.fullHash())
-            {
-                if (!makeDiff(lchild, rchild, diffRoot))
-                {
-                    return false;
-                }
-            }
-            // take item from list to track removed objects
-            leftChildIndexMap.erase(lchildIter);
-        }
-        else
-        {
-            diffObjectEmpty = false;
-            // added child
-            GtObjectIO oio;
-            QDomElement rchildElem = oio.toDomElement(rchild, *this, false);
-            handleObjectAdded(rchildElem, rchildIndex, diffObj);
-
-            completeMap.insert(rchild.uuid(), rchildIndex);
-            gt::for_each_key(completeMap, [&](const QString& uuid)
-            {
-                if (uuid != rchild.uuid())
-                {
-                    if (completeMap.value(uuid) >= rchildIndex)
-                    {
-                        completeMap.insert(uuid, completeMap.value(uuid) + 1);
-
-                        if (!indexChangeMap.contains(uuid))
-                        {
-                            indexChangeMap.insert(uuid, 1);
-                        }
-                        else
-                        {
-                            indexChangeMap.insert(uuid, indexChangeMap.value(uuid) + 1);
-                        }
-                    }
-                }
-            });
-        }
-    }
-
-    QList<int> leftChildIndexSort = leftChildIndexMap.values();
-    std::sort(std::begin(leftChildIndexSort), std::end(leftChildIndexSort));
-
-    // look for removed children
-    foreach (int lchildIndex, leftChildIndexSort)
-    {
-        diffObjectEmpty = false;
-        const GtObjectMemento& lchild(left.childObjects[lchildIndex]);
-        GtObjectIO oio;
-        QDomElement lchildElem = oio.toDomElement(lchild, *this, false);
-        handleObjectRemoved(lchildElem, lchildIndex, diffObj);
-
-        int completeMapIndex = completeMap.value(lchild.uuid());
-        gt::for_each_key(completeMap, [&](const QString& uuid)
-        {
-            if (uuid != lchild.uuid())
-            {
-                int index = completeMap.value(uuid);
-                if (index > completeMapIndex)
-                {
-                    if (indexChangeMap.contains(uuid))
-                    {
-                        indexChangeMap.insert(uuid, indexChangeMap.value(uuid) - 1);
-                    }
-                    else
-                    {
-                        indexChangeMap.insert(uuid, -1);
-                    }
-                }
-            }
-        });
-
-        if (indexChangeMap.contains(lchild.uuid()))
-        {
-            indexChangeMap.remove(lchild.uuid());
-        }
-    }
-
-    gt::for_each_key(indexChangeMap, [&](const QString& uuid)
-    {
-        if (indexChangeMap.value(uuid) == 0)
-        {
-            indexChangeMap.remove(uuid);
-        }
-    });
-
-//  look for index changes
-    QHash<QString, int> lchildMap;
-    for (int lchildIndex = 0; lchildIndex < left.childObjects.size(); lchildIndex++)
-    {
-        const GtObjectMemento& lchild(left.childObjects[lchildIndex]);
-        lchildMap.insert(lchild.uuid(), lchildIndex);
-    }
-
-    QHash<QString,int> rchildMap;
-    for (int rchildIndex = 0; rchildIndex < right.childObjects.size(); rchildIndex++)
-    {
-        const GtObjectMemento& rchild(right.childObjects[rchildIndex]);
-        rchildMap.insert(rchild.uuid(), rchildIndex);
-    }
-
-    gt::for_each_key(rchildMap, [&](const QString& uuid)
-    {
-        if (!lchildMap.contains(uuid))
-        {
-            return;
-        }
-
-        int indexOld = lchildMap.value(uuid);
-        int indexNew = rchildMap.value(uuid);
-        int indexChange = 0;
-
-        if (indexChangeMap.contains(uuid))
-        {
-            indexChange = indexChangeMap.value(uuid);
-        }
-        int diff = indexNew - indexOld - indexChange;
-
-        if (diff != 0)
-        {
-            diffObjectEmpty = false;
-            const GtObjectMemento& rchild (right.childObjects[indexNew]);
-            GtObjectIO oio;
-            QDomElement childElem = oio.toDomElement(rchild, *this, false);
-            handleIndexChanged(childElem, indexOld, indexNew, diffObj);
-        }
-    });
-
-    if (!diffObjectEmpty)
-    {
-        if (diffRoot.isNull())
-        {
-            this->appendChild(diffObj);
-        }
-        else
-        {
-            diffRoot.appendChild(diffObj);
-        }
-    }
-/*    qDebug() << "Result of diff:";
-    qDebug() << toByteArray()*/;
-    return true;
 }
 
 void
@@ -518,164 +236,6 @@ GtObjectMementoDiff::handleAttributeChange(const QString& name,
     diffRoot.appendChild(attrDiff);
 }
 
-void
-GtObjectMementoDiff::detectPropertyChanges(const QVector<GtObjectMemento::PropertyData>& leftProperties,
-                                           const QVector<GtObjectMemento::PropertyData>& rightProperties,
-                                           QDomElement& diffRoot)
-
-{
-    QHash<QString,const GtObjectMemento::PropertyData*> leftPropMap;
-    foreach (const GtObjectMemento::PropertyData& lprop, leftProperties)
-    {
-        leftPropMap.insert(lprop.name, &lprop);
-    }
-    // look for modified / added properties
-    foreach (const GtObjectMemento::PropertyData& rprop, rightProperties)
-    {
-        auto lpropIter = leftPropMap.find(rprop.name);
-        if (lpropIter != leftPropMap.end())
-        {
-            // check for modifications
-            const GtObjectMemento::PropertyData& lprop (**lpropIter);
-            if (lprop.hash != rprop.hash)
-            {
-                handlePropertyChange(lprop, rprop, diffRoot);
-            }
-            // take item from list to track removed properties
-            leftPropMap.erase(lpropIter);
-        }
-        else
-        {
-
-            // added property, this is not intended to happen!
-            gtDebug() << QObject::tr("Property added in diff, name: ") << rprop.name;
-            // don't do anything for now
-
-        }
-    }
-    // look for removed properties
-    foreach (const GtObjectMemento::PropertyData* lpropPointer, leftPropMap)
-    {
-        const GtObjectMemento::PropertyData& lprop (*lpropPointer);
-        // removed property, this is not intended to happen!
-        gtDebug() << QObject::tr("Property removed in diff, name: ") << lprop.name;
-        // don't do anything for now
-    }
-}
-
-void
-GtObjectMementoDiff::detectDynamicPropertyChanges(
-    const QVector<GtObjectMemento::PropertyData>& leftContainers,
-    const QVector<GtObjectMemento::PropertyData>& rightContainers,
-    QDomElement& diffRoot)
-{
-    // we enforce, that the number of dyanmic properties may not change
-    assert (leftContainers.size() == rightContainers.size());
-
-    for (int i = 0; i < leftContainers.size(); ++i)
-    {
-        const auto& left = leftContainers[i];
-        const auto& right = rightContainers[i];
-
-        if (left.hash != right.hash)
-        {
-            detectDynamicPropertyChanges(left, right, diffRoot);
-        }
-    }
-}
-
-
-void
-GtObjectMementoDiff::detectDynamicPropertyChanges(
-    const GtObjectMemento::PropertyData& leftContainer,
-    const GtObjectMemento::PropertyData& rightContainer,
-    QDomElement& diffRoot)
-
-{
-    assert(leftContainer.name == rightContainer.name);
-
-    const auto& leftEntries = leftContainer.childProperties;
-    const auto& rightEntries = rightContainer.childProperties;
-
-    using index_t = int;
-
-    std::vector<std::pair<index_t, PD>> deleted, added;
-    std::vector<std::tuple<QString, PD, PD>> changed;
-
-    // search, which entries are  deletedf and changed
-    for (int leftIdx = 0; leftIdx < leftEntries.size(); ++leftIdx) {
-
-        const auto& leftEntry = leftEntries[leftIdx];
-
-        auto iter = std::find_if(rightEntries.constBegin(),
-                                 rightEntries.constEnd(),
-                                 [&leftEntry](const PD& rightData) {
-            return rightData.name == leftEntry.name;
-        });
-
-        if (iter == rightEntries.cend())
-        {
-            // this entry was removed
-            deleted.emplace_back(leftIdx, leftEntry);
-        }
-        else
-        {
-            // check, whether this entry has been changed
-            const auto& rightEntry = *iter;
-            assert(leftEntry.name == rightEntry.name);
-
-            if (leftEntry.hash != rightEntry.hash)
-            {
-                changed.emplace_back(leftEntry.name, leftEntry, rightEntry);
-            }
-        }
-    }
-
-    // search for added entries
-    for (int rightIdx = 0; rightIdx < rightEntries.size(); ++rightIdx) {
-
-        const auto& rightEntry = rightEntries[rightIdx];
-
-        auto iter = std::find_if(leftEntries.constBegin(),
-                                 leftEntries.constEnd(),
-                                 [&rightEntry](const PD& leftData) {
-            return leftData.name == rightEntry.name;
-        });
-
-        if (iter == leftEntries.cend())
-        {
-            // this entry was removed
-            added.emplace_back(rightIdx, rightEntry);
-        }
-    }
-
-    assert(!changed.empty() || !deleted.empty() || !added.empty());
-
-    for (const auto& addedElement : added)
-    {
-        const auto idx = addedElement.first;
-        const auto& elem = addedElement.second;
-        handleContainerElementAdded(leftContainer.name, idx, elem, diffRoot);
-    }
-
-    for (const auto& removedElement : deleted)
-    {
-        const auto idx = removedElement.first;
-        const auto& elem = removedElement.second;
-        handleContainerElementRemoved(leftContainer.name, idx, elem, diffRoot);
-    }
-
-    for (const auto& changedElem : changed)
-    {
-        const auto& nameUUID = std::get<0>(changedElem);
-        const auto& before = std::get<1>(changedElem);
-        const auto& after = std::get<2>(changedElem);
-
-        handleContainerElementChanged(leftContainer.name, nameUUID,
-                                      before, after, diffRoot);
-    }
-}
-
 void
 GtObjectMementoDiff::handleContainerElementAdded(
     QString containerName,
@@ -717,8 +277,7 @@ GtObjectMementoDiff::handleContainerElementRemoved(
 void
 GtObjectMementoDiff::handleContainerElementChanged(const QString& containerName,
                                                    const QString& elementName,
-                                                   const PD& before,
-                                                   const PD& after,
+                                                   const std::vector<Operation>& changes,
                                                    QDomElement& diffRoot)
 {
     auto changedElem = createElement(
@@ -727,34 +286,33 @@ GtObjectMementoDiff::handleContainerElementChanged(const QString& containerName,
     changedElem.setAttribute(gt::xml::S_NAME_TAG, containerName);
     changedElem.setAttribute(gt::xml::S_ENTRY_NAME_TAG, elementName);
 
-    detectPropertyChanges(before.childProperties, after.childProperties,
-                          changedElem);
+    for (const Operation& op : changes)
+    {
+        handlePropertyChange(op, changedElem);
+    }
 
     diffRoot.appendChild(changedElem);
 }
 
 void
-GtObjectMementoDiff::handlePropertyChange(const PD& leftProp,
-                                          const PD& rightProp,
+GtObjectMementoDiff::handlePropertyChange(const Operation& op,
                                           QDomElement& diffRoot)
 {
     // distinguish "types"
     QDomElement diffObj;
-    bool diffObjEmpty = true;
 
-    if (GtObjectIO::usePropertyList(leftProp.data()))
+    if (GtObjectIO::usePropertyList(op.oldValue))
     {
         diffObj = this->createElement(gt::xml::S_DIFF_PROPLIST_CHANGE_TAG);
-        diffObj.setAttribute(gt::xml::S_NAME_TAG, leftProp.name);
+        diffObj.setAttribute(gt::xml::S_NAME_TAG, op.id);
 
-        diffObjEmpty = false;
         QDomElement oldVal = this->createElement(gt::xml::S_DIFF_OLDVAL_TAG);
         QDomElement newVal = this->createElement(gt::xml::S_DIFF_NEWVAL_TAG);
 
         QString leftVal, leftType;
         QString rightVal, rightType;
-        GtObjectIO::propertyListStringType(leftProp.data(), leftVal, leftType);
-        GtObjectIO::propertyListStringType(rightProp.data(), rightVal, rightType);
+        GtObjectIO::propertyListStringType(op.oldValue, leftVal, leftType);
+        GtObjectIO::propertyListStringType(op.newValue, rightVal, rightType);
 
         diffObj.setAttribute(gt::xml::S_TYPE_TAG, leftType);
 
@@ -767,13 +325,12 @@ GtObjectMementoDiff::handlePropertyChange(const PD& leftProp,
     else
     {
         diffObj = this->createElement(gt::xml::S_DIFF_PROP_CHANGE_TAG);
-        diffObj.setAttribute(gt::xml::S_NAME_TAG, leftProp.name);
-        diffObj.setAttribute(gt::xml::S_TYPE_TAG, leftProp.dataType());
+        diffObj.setAttribute(gt::xml::S_NAME_TAG, op.id);
+        diffObj.setAttribute(gt::xml::S_TYPE_TAG, op.dataType);
 
         // handle value changes
-        if (leftProp.data() != rightProp.data())
+        if (op.oldValue != op.newValue)
         {
-            diffObjEmpty = false;
             QDomElement oldVal =
                     this->createElement(gt::xml::S_DIFF_OLDVAL_TAG);
             QDomElement newVal =
@@ -781,10 +338,10 @@ GtObjectMementoDiff::handlePropertyChange(const PD& leftProp,
 
             oldVal.appendChild(
                         this->createTextNode(
-                            GtObjectIO::variantToString(leftProp.data())));
+                            GtObjectIO::variantToString(op.oldValue)));
             newVal.appendChild(
                         this->createTextNode(
-                            GtObjectIO::variantToString(rightProp.data())));
+                            GtObjectIO::variantToString(op.newValue)));
 
             diffObj.appendChild(oldVal);
             diffObj.appendChild(newVal);
@@ -792,20 +349,16 @@ GtObjectMementoDiff::handlePropertyChange(const PD& leftProp,
     }
 
     // handle further attribute changes
-    if (leftProp.isActive != rightProp.isActive)
+    if (op.oldActive != op.newActive)
     {
-        diffObjEmpty = false;
         handleAttributeChange(gt::xml::S_ACTIVE_TAG,
-                              QVariant(leftProp.isActive).toString(),
-                              QVariant(rightProp.isActive).toString(), diffObj);
+                              QVariant(op.oldActive).toString(),
+                              QVariant(op.newActive).toString(), diffObj);
     }
 
     // TODO: handle child properties change
 
-    if (!diffObjEmpty)
-    {
-        diffRoot.appendChild(diffObj);
-    }
+    diffRoot.appendChild(diffObj);
 }
 
 void
@@ -841,7 +394,7 @@ GtObjectMementoDiff::handleObjectRemoved(const QDomElement& removedObject,
 }
 
 void
-GtObjectMementoDiff::handleIndexChanged(const QDomElement& changedObject,
+GtObjectMementoDiff::handleIndexChanged(const GtObjectMemento& changedObject,
                                         int oldIndex, int newIndex,
                                         QDomElement& diffRoot)
 {
@@ -852,9 +405,9 @@ GtObjectMementoDiff::handleIndexChanged(const QDomElement& changedObject,
     indChanged.setAttribute(gt::xml::S_DIFF_OLDVAL_TAG, oldIndex);
 
     QDomElement obj = this->createElement(gt::xml::S_OBJECT_TAG);
-    obj.setAttribute(gt::xml::S_NAME_TAG, changedObject.attribute("name"));
-    obj.setAttribute(gt::xml::S_UUID_TAG, changedObject.attribute("uuid"));
-    obj.setAttribute(gt::xml::S_CLASS_TAG, changedObject.attribute("class"));
+    obj.setAttribute(gt::xml::S_NAME_TAG, changedObject.ident());
+    obj.setAttribute(gt::xml::S_UUID_TAG, changedObject.uuid());
+    obj.setAttribute(gt::xml::S_CLASS_TAG, changedObject.className());
 
     indChanged.appendChild(obj);
 
@@ -13,6 +13,7 @@
 
 #include "gt_datamodel_exports.h"
 #include "gt_objectmemento.h"
+#include "gt_typedmementodiff.h"
 
 #include <QDomDocument>
 #include <QHash>
@@ -39,6 +40,13 @@ public:
     GtObjectMementoDiff(const GtObjectMemento& left,
                         const GtObjectMemento& right);
 
+    /**
+     * @brief Converts the typed diff into its XML representation, e.g. to
+     * persist it or to send it over the wire.
+     * @param diff Typed diff
+     */
+    explicit GtObjectMementoDiff(const GtTypedMementoDiff& diff);
+
     explicit GtObjectMementoDiff(const QByteArray& byteArray);
 
     /**
@@ -96,12 +104,14 @@ public:
     }
 
 private:
+    using Operation = GtTypedMementoDiff::Operation;
+
     /**
-     * @brief makeDiff
-     * @param left
-     * @param right
+     * @brief Appends the XML element of the operation
+     * @param op Operation
+     * @param diffObj Element of the changed object
      */
-    bool makeDiff(const GtObjectMemento& left, const GtObjectMemento& right, QDomElement& diffRoot);
+    void appendOperation(const Operation& op, QDomElement& diffObj);
 
     /**
      * @brief handleAttributeChange
@@ -111,30 +121,10 @@ private:
                                const QString& rightVal,
                                QDomElement& diffRoot);
 
-    /**
-     * @brief detectPropertyChanges
-     */
-    void detectPropertyChanges(const QVector<GtObjectMemento::PropertyData>& leftProperties,
-                               const QVector<GtObjectMemento::PropertyData>& rightProperties,
-                               QDomElement& diffRoot);
-    void
-    detectDynamicPropertyChanges(
-        const GtObjectMemento::PropertyData& leftContainer,
-        const GtObjectMemento::PropertyData& rightContainer,
-        QDomElement& diffRoot);
-
-    void
-    detectDynamicPropertyChanges(
-        const QVector<GtObjectMemento::PropertyData>& leftContainers,
-        const QVector<GtObjectMemento::PropertyData>& rightContainers,
-        QDomElement& diffRoot);
-
     /**
      * @brief handlePropertyChange
      */
-    void handlePropertyChange(const GtObjectMemento::PropertyData& leftProp,
-                              const GtObjectMemento::PropertyData& rightProp,
-                              QDomElement& diffRoot);
+    void handlePropertyChange(const Operation& op, QDomElement& diffRoot);
 
     /**
      * @brief Proceeds an added object to the needed diff entry
@@ -161,7 +151,7 @@ private:
      * @param newIndex
      * @param diffRoot
      */
-    void handleIndexChanged(const QDomElement& changedObject,
+    void handleIndexChanged(const GtObjectMemento& changedObject,
                             int oldIndex,
                             int newIndex,
                             QDomElement& diffRoot);
@@ -186,8 +176,7 @@ private:
 
     void handleContainerElementChanged(const QString& containerName,
         const QString& elementName,
-        const GtObjectMemento::PropertyData& before,
-        const GtObjectMemento::PropertyData& after,
+        const std::vector<Operation>& changes,
         QDomElement& diffRoot);
 
     /**
@@ -18,6 +18,47 @@ GtPackage::GtPackage()
     setObjectName("Package");
 }
 
+namespace
+{
+
+/// Restores the object of the memento or merges it into the default object
+void
+restoreObject(GtPackage& package, const GtObjectMemento& memento)
+{
+    if (memento.isNull())
+    {
+        return;
+    }
+
+    // default object
+    GtObject* dobj = package.findDirectChild<GtObject*>(memento.ident());
+
+    if (dobj)
+    {
+        // TODO: warning for unknown data element
+        //gtDebug() << tr("default object found!") << " ("
+        //          << dobj->objectName() << ") " << tr("restoring...");
+        dobj->setFactory(gtObjectFactory);
+        dobj->fromMemento(memento);
+    }
+    else
+    {
+        GtObject* cobj = memento.restore(gtObjectFactory);
+
+        if (cobj)
+        {
+            package.appendChild(cobj);
+        }
+        else
+        {
+            gtWarning() << GtPackage::tr("unknown data element skipped!")
+                        << "(" << memento.className() << ")";
+        }
+    }
+}
+
+} // namespace
+
 bool
 GtPackage::readData(const QDomElement& root)
 {
@@ -30,36 +71,8 @@ GtPackage::readData(const QDomElement& root)
             continue;
         }
 
-        GtObjectMemento memento(oe);
-
-        if (!memento.isNull())
-        {
-            // default object
-            GtObject* dobj = findDirectChild<GtObject*>(memento.ident());
-
-            if (dobj)
-            {
-                // TODO: warning for unknown data element
-                //gtDebug() << tr("default object found!") << " ("
-                //          << dobj->objectName() << ") " << tr("restoring...");
-                dobj->setFactory(gtObjectFactory);
-                dobj->fromMemento(memento);
-            }
-            else
-            {
-                GtObject* cobj = memento.restore(gtObjectFactory);
-
-                if (cobj)
-                {
-                    appendChild(cobj);
-                }
-                else
-                {
-                    gtWarning() << tr("unknown data element skipped!")
-                                << "(" << memento.className() << ")";
-                }
-            }
-        }
+        // the mementos are created one by one to keep the memory low
+        restoreObject(*this, GtObjectMemento(oe));
 
         oe = oe.nextSiblingElement();
     }
@@ -67,6 +80,23 @@ GtPackage::readData(const QDomElement& root)
     return true;
 }
 
+bool
+GtPackage::supportsMementoData() const
+{
+    return false;
+}
+
+bool
+GtPackage::readMementoData(const QVector<GtObjectMemento>& objects)
+{
+    for (const GtObjectMemento& memento : objects)
+    {
+        restoreObject(*this, memento);
+    }
+
+    return true;
+}
+
 bool GtPackage::readMiscData(const QDir &projectDir)
 {
     return true;
@@ -84,6 +114,20 @@ GtPackage::saveData(QDomElement& root, QDomDocument& /*doc*/)
     return true;
 }
 
+bool
+GtPackage::saveMementoData(QVector<GtObjectMemento>& objects)
+{
+    const auto children = findDirectChildren<GtObject*>();
+    objects.reserve(objects.size() + children.size());
+
+    for (const GtObject* obj : children)
+    {
+        objects.push_back(obj->toMemento());
+    }
+
+    return true;
+}
+
 bool GtPackage::saveMiscData(const QDir &projectDir)
 {
     return true;
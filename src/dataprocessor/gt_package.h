@@ -15,9 +15,12 @@
 
 #include "gt_object.h"
 
+#include <QVector>
+
 class QDomElement;
 class QDomDocument;
 class QDir;
+class GtObjectMemento;
 
 /**
  * @brief The GtPackage class
@@ -36,6 +39,33 @@ public:
      */
     virtual bool readData(const QDomElement& root);
 
+    /**
+     * @brief Returns true, if the package data can be read from object
+     * mementos, which GTlab reads directly from the module file without
+     * building a DOM document (see readMementoData). This saves a lot of
+     * memory for large module files.
+     *
+     * Module files saved as one file are then streamed from the mementos of
+     * saveMementoData as well. With linked object files, saveData is used.
+     *
+     * Packages overriding readData or saveData must not enable this.
+     * Default is false.
+     *
+     * @return Whether readMementoData and saveMementoData are used to read
+     * and save the module file
+     */
+    virtual bool supportsMementoData() const;
+
+    /**
+     * @brief Restores the package objects from the mementos of the objects
+     * stored in the module file like the default implementation of readData
+     * does.
+     * @param objects Mementos of the objects stored in the module file
+     *
+     * @return Returns true if data was successfully read.
+     */
+    virtual bool readMementoData(const QVector<GtObjectMemento>& objects);
+
     /**
      * @brief Reads additional package data that are stored in the project dir
      * @param projectDir Directory of the project
@@ -51,6 +81,16 @@ public:
      */
     virtual bool saveData(QDomElement& root, QDomDocument& doc);
 
+    /**
+     * @brief Returns the mementos of the objects to be stored in the module
+     * file like the default implementation of saveData does. Only used, if
+     * supportsMementoData is enabled.
+     * @param objects Output list of the object mementos
+     *
+     * @return Returns true if data was successfully saved.
+     */
+    virtual bool saveMementoData(QVector<GtObjectMemento>& objects);
+
     /**
      * @brief Saves additional package data that are stored in the project dir
      * @param projectDir Directory of the project
@@ -0,0 +1,603 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_typedmementodiff.h"
+#include "gt_externalizedobject.h"
+#include "gt_qtutilities.h"
+#include "gt_objectio.h"
+#include "gt_objectfactory.h"
+#include "gt_xmlexpr.h"
+#include "gt_logging.h"
+
+#include <QHash>
+#include <QSet>
+
+#include <algorithm>
+#include <optional>
+
+using PD = GtObjectMemento::PropertyData;
+using Operation = GtTypedMementoDiff::Operation;
+using OperationType = GtTypedMementoDiff::OperationType;
+
+namespace
+{
+
+/// helper struct for return value of setup function
+struct FetchMementoResult
+{
+    // indicates if setup was sucessful
+    bool success = true;
+    // optional replacement for left or right memento
+    std::optional<GtObjectMemento> left{}, right{};
+};
+
+FetchMementoResult
+fetchExternalizedMementos(const GtObjectMemento& leftOrig,
+                          const GtObjectMemento& rightOrig,
+                          GtAbstractObjectFactory& factory)
+{
+    auto const externalizationInfoLeft = leftOrig.externalizationInfo(factory);
+
+    // not an externalized object -> nothing to do
+    if (!externalizationInfoLeft.isValid()) return {};
+
+    auto const externalizationInfoRight = rightOrig.externalizationInfo(factory);
+    assert(externalizationInfoRight.isValid());
+
+    // check if we can diff the data
+    if (!externalizationInfoLeft.isFetched &&
+        !externalizationInfoRight.isFetched &&
+        externalizationInfoLeft.hash != externalizationInfoRight.hash)
+    {
+        gtError() << QObject::tr("Inconsitency in externalized data for '%1' "
+                                 "detected! Aborting diff operation!")
+                     .arg(leftOrig.ident());
+        return { false };
+    }
+
+    if (externalizationInfoLeft.isFetched && externalizationInfoRight.isFetched)
+    {
+        // nothing to do here ->  both object mementos are fetched!
+        return {};
+    }
+
+    auto tmpInstanceLeft  = std::unique_ptr<QObject>(externalizationInfoLeft.metaObject->newInstance());
+    auto tmpInstanceRight = std::unique_ptr<QObject>(externalizationInfoRight.metaObject->newInstance());
+
+    auto externalizedObjectLeft  = gt::unique_qobject_cast<GtExternalizedObject>(std::move(tmpInstanceLeft));
+    auto externalizedObjectRight = gt::unique_qobject_cast<GtExternalizedObject>(std::move(tmpInstanceRight));
+
+    // check if object was recreated successfully
+    if (!externalizedObjectLeft ||
+        !externalizedObjectRight ||
+        !leftOrig.mergeTo(*externalizedObjectLeft, factory) ||
+        !rightOrig.mergeTo(*externalizedObjectRight, factory))
+    {
+        gtError() << QObject::tr("Failed to restore externalized object data "
+                                 "of '%1' for diff creation!")
+                     .arg(leftOrig.ident());
+        return { false };
+    }
+
+    // check which memento to fetch
+    bool fetchLeft = !externalizationInfoLeft.isFetched;
+
+    auto const& externalizationInfo =
+            fetchLeft ? externalizationInfoLeft : externalizationInfoRight;
+    auto& objectToFetch =
+            fetchLeft ? externalizedObjectLeft  : externalizedObjectRight;
+    auto& fetchedObject =
+            fetchLeft ? externalizedObjectRight : externalizedObjectLeft;
+
+    // check if object must be fetched
+    if (externalizationInfo.hash == fetchedObject->calcExtHash())
+    {
+        // nothing to do here -> diffs are equal
+        return {};
+    }
+
+    if (!objectToFetch->internalize())
+    {
+        gtError() << QObject::tr("Failed to internalize %1 memento for '%2'!")
+                     .arg(fetchLeft ? "left" : "right", leftOrig.ident());
+        return { false };
+    }
+
+    FetchMementoResult result{};
+    (fetchLeft ? result.left : result.right) = objectToFetch->toMemento();
+    return result;
+}
+
+/**
+ * @brief Loads the linked object file of a placeholder memento, if only one
+ * of the mementos is a placeholder. Materializing a linked object is no
+ * modification, thus the placeholder is compared by the data of its file.
+ */
+FetchMementoResult
+fetchLinkedMementos(const GtObjectMemento& left, const GtObjectMemento& right)
+{
+    const bool leftIsPlaceholder =
+        left.isFlagEnabled(GtObjectMemento::IsPlaceholder);
+    const bool rightIsPlaceholder =
+        right.isFlagEnabled(GtObjectMemento::IsPlaceholder);
+
+    // nothing to do here -> both mementos are placeholders or loaded
+    if (leftIsPlaceholder == rightIsPlaceholder) return {};
+
+    const GtObjectMemento& placeholder = leftIsPlaceholder ? left : right;
+
+    GtObjectMemento loaded = placeholder.loadLinkedFile();
+    if (loaded.isNull())
+    {
+        gtError() << QObject::tr("Failed to load the linked object file '%1' "
+                                 "of '%2' for diff creation!")
+                     .arg(placeholder.linkedFilePath(), placeholder.ident());
+        return { false };
+    }
+
+    loaded.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+
+    FetchMementoResult result{};
+    (leftIsPlaceholder ? result.left : result.right) = std::move(loaded);
+    return result;
+}
+
+Operation
+attributeChange(const QString& id, const QString& oldVal, const QString& newVal)
+{
+    Operation op{};
+    op.type = OperationType::AttributeChange;
+    op.id = id;
+    op.oldValue = oldVal;
+    op.newValue = newVal;
+    return op;
+}
+
+/**
+ * @brief Appends the index changes needed to bring the children into the
+ * order of the right memento. The moves are applied after all added and
+ * removed objects were handled, thus the resulting child order is simulated
+ * first. Children are moved in ascending order of their new indices.
+ * @param right Memento after the change
+ * @param leftIndices Indices of the children of the left memento
+ * @param order Child uuids of the left memento
+ * @param operations Operations of the object. Contains the add and remove
+ * operations of the children.
+ */
+void
+appendIndexChanges(const GtObjectMemento& right,
+                   const QHash<QString, int>& leftIndices,
+                   QVector<QString> order,
+                   std::vector<Operation>& operations)
+{
+    QSet<QString> added;
+    QSet<QString> removed;
+
+    for (const Operation& op : operations)
+    {
+        if (op.type == OperationType::ObjectAdd)
+        {
+            if (op.newIndex >= order.size()) order.append(op.object.uuid());
+            else order.insert(op.newIndex, op.object.uuid());
+
+            added.insert(op.object.uuid());
+        }
+        else if (op.type == OperationType::ObjectRemove)
+        {
+            removed.insert(op.object.uuid());
+        }
+    }
+
+    order.erase(std::remove_if(order.begin(), order.end(),
+                               [&removed](const QString& uuid) {
+                                   return removed.contains(uuid);
+                               }),
+                order.end());
+
+    const int n = std::min(order.size(), right.childObjects.size());
+
+    auto const moveTo = [&](int from, int to, const GtObjectMemento& child) {
+        QString uuid = order.takeAt(from);
+        order.insert(to, uuid);
+
+        Operation op{};
+        op.type = OperationType::IndexChange;
+        op.oldIndex = leftIndices.value(uuid);
+        op.newIndex = to;
+        op.object = child;
+        operations.push_back(std::move(op));
+    };
+
+    for (int j = 0; j < n; ++j)
+    {
+        const GtObjectMemento& rchild = right.childObjects[j];
+
+        if (order[j] == rchild.uuid()) continue;
+
+        auto pos = std::find(order.begin() + j + 1, order.end(),
+                             rchild.uuid());
+        if (pos == order.end()) continue;
+
+        const int from = static_cast<int>(std::distance(order.begin(), pos));
+
+        if (!added.contains(rchild.uuid()))
+        {
+            moveTo(from, j, rchild);
+            continue;
+        }
+
+        // added objects cannot be moved. Instead, the kept objects in
+        // front of it are moved to the back.
+        for (int count = from - j; count > 0; --count)
+        {
+            const QString uuid = order[j];
+            auto rchildIter = std::find_if(right.childObjects.begin(),
+                                           right.childObjects.end(),
+                                           [&uuid](const GtObjectMemento& m) {
+                                               return m.uuid() == uuid;
+                                           });
+            assert(rchildIter != right.childObjects.end());
+            moveTo(j, order.size() - 1, *rchildIter);
+        }
+    }
+}
+
+} // namespace
+
+GtTypedMementoDiff::GtTypedMementoDiff(const GtObjectMemento& left,
+                                       const GtObjectMemento& right)
+{
+    if (!left.isNull() && !right.isNull())
+    {
+        if (!makeDiff(left, right))
+        {
+            gtError() << QObject::tr("DIFF FAILED!!!");
+            m_valid = false;
+        }
+    }
+}
+
+GtTypedMementoDiff::GtTypedMementoDiff() = default;
+
+bool
+GtTypedMementoDiff::isNull() const
+{
+    return m_changes.isEmpty();
+}
+
+bool
+GtTypedMementoDiff::isValid() const
+{
+    return m_valid;
+}
+
+bool
+GtTypedMementoDiff::hasRootMismatch() const
+{
+    return m_rootMismatch;
+}
+
+bool
+GtTypedMementoDiff::hasObjectTreeChanges() const
+{
+    return std::any_of(m_changes.begin(), m_changes.end(),
+                       [](const ObjectChange& change) {
+        return std::any_of(change.operations.begin(), change.operations.end(),
+                           [](const Operation& op) {
+            return op.type == OperationType::ObjectAdd ||
+                   op.type == OperationType::ObjectRemove;
+        });
+    });
+}
+
+const QVector<GtTypedMementoDiff::ObjectChange>&
+GtTypedMementoDiff::objectChanges() const
+{
+    return m_changes;
+}
+
+bool
+GtTypedMementoDiff::appendDiff(const GtTypedMementoDiff& diff)
+{
+    if (diff.isNull())
+    {
+        return false;
+    }
+
+    m_changes.append(diff.m_changes);
+
+    return true;
+}
+
+bool
+GtTypedMementoDiff::makeDiff(const GtObjectMemento& leftOrig,
+                             const GtObjectMemento& rightOrig)
+{
+    // snapshots of unchanged object trees share their data
+    if (leftOrig.isSharedWith(rightOrig))
+    {
+        return true;
+    }
+
+    // update hashes if needed. The hashes are only used for in-memory
+    // comparison, thus the fast hash algorithm is sufficient
+    leftOrig.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+    rightOrig.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+    if (leftOrig.fullHash() == rightOrig.fullHash())
+    {
+        return true;
+    }
+
+    if (leftOrig.uuid() != rightOrig.uuid())
+    {
+        gtWarning() << QObject::tr("root objects not equal!");
+        m_rootMismatch = true;
+        return false;
+    }
+
+    // left or right memento may needs to be fetched in case it belongs to an
+    // externalized object
+    auto setup = fetchExternalizedMementos(leftOrig, rightOrig, *gtObjectFactory);
+
+    if (!setup.success) return false;
+
+    // or because it is a linked object that was loaded in the meantime
+    auto linkedSetup = fetchLinkedMementos(setup.left.value_or(leftOrig),
+                                           setup.right.value_or(rightOrig));
+
+    if (!linkedSetup.success) return false;
+
+    if (linkedSetup.left) setup.left = std::move(linkedSetup.left);
+    if (linkedSetup.right) setup.right = std::move(linkedSetup.right);
+
+    const GtObjectMemento& left =  setup.left.value_or(leftOrig);
+    const GtObjectMemento& right = setup.right.value_or(rightOrig);
+
+    ObjectChange change{left.uuid(), left.className(), left.ident(), {}};
+    std::vector<Operation>& operations = change.operations;
+
+    // check properties & attributes
+    if (left.propertyHash() != right.propertyHash())
+    {
+        if (left.className() != right.className())
+        {
+            operations.push_back(attributeChange(gt::xml::S_CLASS_TAG,
+                                                 left.className(),
+                                                 right.className()));
+        }
+
+        if (left.ident() != right.ident())
+        {
+            operations.push_back(attributeChange(gt::xml::S_NAME_TAG,
+                                                 left.ident(),
+                                                 right.ident()));
+        }
+
+        detectPropertyChanges(left.properties, right.properties, operations);
+
+        // we enforce, that the number of dyanmic properties may not change
+        assert(left.propertyContainers.size() ==
+               right.propertyContainers.size());
+
+        for (int i = 0; i < left.propertyContainers.size(); ++i)
+        {
+            const PD& lcontainer = left.propertyContainers[i];
+            const PD& rcontainer = right.propertyContainers[i];
+
+            if (lcontainer.hash != rcontainer.hash)
+            {
+                detectContainerChanges(lcontainer, rcontainer, operations);
+            }
+        }
+    }
+
+    // match children by their uuids
+    QHash<QString, int> leftIndices;
+    leftIndices.reserve(left.childObjects.size());
+
+    QVector<QString> leftOrder;
+    leftOrder.reserve(left.childObjects.size());
+
+    for (int i = 0; i < left.childObjects.size(); ++i)
+    {
+        leftIndices.insert(left.childObjects[i].uuid(), i);
+        leftOrder.append(left.childObjects[i].uuid());
+    }
+
+    std::vector<bool> kept(left.childObjects.size(), false);
+    bool hasKeptChildren = false;
+
+    // look for modified/added children
+    for (int rchildIndex = 0; rchildIndex < right.childObjects.size();
+         ++rchildIndex)
+    {
+        const GtObjectMemento& rchild = right.childObjects[rchildIndex];
+
+        auto lchildIter = leftIndices.constFind(rchild.uuid());
+        if (lchildIter != leftIndices.constEnd())
+        {
+            kept[*lchildIter] = true;
+            hasKeptChildren = true;
+
+            // check for modifications
+            const GtObjectMemento& lchild = left.childObjects[*lchildIter];
+            if (!lchild.isSharedWith(rchild) &&
+                lchild.fullHash() != rchild.fullHash())
+            {
+                if (!makeDiff(lchild, rchild))
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            Operation op{};
+            op.type = OperationType::ObjectAdd;
+            op.newIndex = rchildIndex;
+            op.object = rchild;
+            operations.push_back(std::move(op));
+        }
+    }
+
+    // look for removed children
+    for (int lchildIndex = 0; lchildIndex < left.childObjects.size();
+         ++lchildIndex)
+    {
+        if (kept[lchildIndex]) continue;
+
+        Operation op{};
+        op.type = OperationType::ObjectRemove;
+        op.oldIndex = lchildIndex;
+        op.object = left.childObjects[lchildIndex];
+        operations.push_back(std::move(op));
+    }
+
+    // look for index changes
+    if (hasKeptChildren)
+    {
+        appendIndexChanges(right, leftIndices, std::move(leftOrder),
+                           operations);
+    }
+
+    if (!operations.empty())
+    {
+        m_changes.append(std::move(change));
+    }
+
+    return true;
+}
+
+void
+GtTypedMementoDiff::detectPropertyChanges(const QVector<PD>& leftProperties,
+                                          const QVector<PD>& rightProperties,
+                                          std::vector<Operation>& operations)
+{
+    QHash<QString, const PD*> leftPropMap;
+    leftPropMap.reserve(leftProperties.size());
+
+    for (const PD& lprop : leftProperties)
+    {
+        leftPropMap.insert(lprop.name, &lprop);
+    }
+
+    // look for modified / added properties
+    for (const PD& rprop : rightProperties)
+    {
+        auto lpropIter = leftPropMap.find(rprop.name);
+        if (lpropIter == leftPropMap.end())
+        {
+            // added property, this is not intended to happen!
+            gtDebug() << QObject::tr("Property added in diff, name: ")
+                      << rprop.name;
+            continue;
+        }
+
+        const PD& lprop = **lpropIter;
+
+        // take item from list to track removed properties
+        leftPropMap.erase(lpropIter);
+
+        if (lprop.hash == rprop.hash) continue;
+
+        const bool isList = GtObjectIO::usePropertyList(lprop.data());
+
+        if (!isList && lprop.data() == rprop.data() &&
+            lprop.isActive == rprop.isActive)
+        {
+            continue;
+        }
+
+        Operation op{};
+        op.type = OperationType::PropertyChange;
+        op.id = lprop.name;
+        op.dataType = lprop.dataType();
+        op.oldValue = lprop.data();
+        op.newValue = rprop.data();
+        op.oldActive = lprop.isActive;
+        op.newActive = rprop.isActive;
+        operations.push_back(std::move(op));
+    }
+
+    // look for removed properties
+    for (const PD* lprop : qAsConst(leftPropMap))
+    {
+        // removed property, this is not intended to happen!
+        gtDebug() << QObject::tr("Property removed in diff, name: ")
+                  << lprop->name;
+    }
+}
+
+void
+GtTypedMementoDiff::detectContainerChanges(const PD& leftContainer,
+                                           const PD& rightContainer,
+                                           std::vector<Operation>& operations)
+{
+    assert(leftContainer.name == rightContainer.name);
+
+    const auto& leftEntries = leftContainer.childProperties;
+    const auto& rightEntries = rightContainer.childProperties;
+
+    QHash<QString, int> rightIndices;
+    rightIndices.reserve(rightEntries.size());
+
+    for (int i = 0; i < rightEntries.size(); ++i)
+    {
+        rightIndices.insert(rightEntries[i].name, i);
+    }
+
+    std::vector<Operation> removed, changed;
+    std::vector<bool> kept(rightEntries.size(), false);
+
+    // search, which entries are deleted and changed
+    for (int leftIdx = 0; leftIdx < leftEntries.size(); ++leftIdx)
+    {
+        const PD& leftEntry = leftEntries[leftIdx];
+
+        auto iter = rightIndices.constFind(leftEntry.name);
+        if (iter == rightIndices.constEnd())
+        {
+            Operation op{};
+            op.type = OperationType::ContainerEntryRemove;
+            op.id = leftContainer.name;
+            op.oldIndex = leftIdx;
+            op.entry = leftEntry;
+            removed.push_back(std::move(op));
+            continue;
+        }
+
+        kept[*iter] = true;
+
+        const PD& rightEntry = rightEntries[*iter];
+
+        if (leftEntry.hash != rightEntry.hash)
+        {
+            Operation op{};
+            op.type = OperationType::ContainerEntryChange;
+            op.id = leftContainer.name;
+            op.entryId = leftEntry.name;
+            detectPropertyChanges(leftEntry.childProperties,
+                                  rightEntry.childProperties, op.changes);
+            changed.push_back(std::move(op));
+        }
+    }
+
+    // search for added entries
+    for (int rightIdx = 0; rightIdx < rightEntries.size(); ++rightIdx)
+    {
+        if (kept[rightIdx]) continue;
+
+        Operation op{};
+        op.type = OperationType::ContainerEntryAdd;
+        op.id = leftContainer.name;
+        op.newIndex = rightIdx;
+        op.entry = rightEntries[rightIdx];
+        operations.push_back(std::move(op));
+    }
+
+    std::move(removed.begin(), removed.end(), std::back_inserter(operations));
+    std::move(changed.begin(), changed.end(), std::back_inserter(operations));
+}
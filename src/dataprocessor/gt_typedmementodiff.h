@@ -0,0 +1,174 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GTTYPEDMEMENTODIFF_H
+#define GTTYPEDMEMENTODIFF_H
+
+#include "gt_datamodel_exports.h"
+#include "gt_objectmemento.h"
+
+#include <QVariant>
+#include <QVector>
+
+#include <vector>
+
+/**
+ * @brief In-memory representation of the differences between two object
+ * mementos.
+ *
+ * In contrast to GtObjectMementoDiff, which stores the differences as a DOM
+ * document, the operations reference uuids, property ids and the typed
+ * values of the mementos. Thus, no values have to be stringified when
+ * creating the diff nor re-parsed when applying it. Child objects are matched
+ * by their uuids using hash lookups.
+ *
+ * The diff can be converted into a GtObjectMementoDiff if it has to be
+ * persisted or sent over the wire. The operations are ordered exactly like
+ * the elements of the XML diff, thus applying either representation yields
+ * the same result.
+ */
+class GT_DATAMODEL_EXPORT GtTypedMementoDiff
+{
+public:
+    /// Type of a single diff operation
+    enum class OperationType
+    {
+        /// object attribute (name or class) changed
+        AttributeChange,
+        /// value or active state of a property changed
+        PropertyChange,
+        /// child object added
+        ObjectAdd,
+        /// child object removed
+        ObjectRemove,
+        /// child object moved
+        IndexChange,
+        /// entry added to a property container
+        ContainerEntryAdd,
+        /// entry removed from a property container
+        ContainerEntryRemove,
+        /// properties of a property container entry changed
+        ContainerEntryChange
+    };
+
+    /**
+     * @brief A single diff operation. Only the members relevant for the
+     * operation type are set.
+     */
+    struct Operation
+    {
+        OperationType type;
+        /// attribute id, property name or property container name
+        QString id;
+        /// name of the property container entry
+        QString entryId;
+        /// data type of the property
+        QString dataType;
+        /// attribute or property values
+        QVariant oldValue, newValue;
+        /// active states of an optional property
+        bool oldActive{true}, newActive{true};
+        /// indices of child objects and property container entries
+        int oldIndex{-1}, newIndex{-1};
+        /// added, removed or moved child object
+        GtObjectMemento object;
+        /// added or removed property container entry
+        GtObjectMemento::PropertyData entry;
+        /// property changes of a property container entry
+        std::vector<Operation> changes;
+    };
+
+    /**
+     * @brief Operations to apply on a single object
+     */
+    struct ObjectChange
+    {
+        QString uuid;
+        QString className;
+        QString ident;
+        std::vector<Operation> operations;
+    };
+
+    /**
+     * @brief Creates the diff between the two mementos.
+     * @param left Memento before the change
+     * @param right Memento after the change
+     */
+    GtTypedMementoDiff(const GtObjectMemento& left,
+                       const GtObjectMemento& right);
+
+    /**
+     * @brief Creates an empty diff.
+     */
+    GtTypedMementoDiff();
+
+    /**
+     * @brief Returns true if the diff contains no changes.
+     * @return Whether the diff is empty
+     */
+    bool isNull() const;
+
+    /**
+     * @brief Returns false if the diff could not be created, e.g. because
+     * the root objects of the mementos were not equal.
+     * @return Whether the diff is valid
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Returns true if the root objects of the diffed mementos have
+     * different uuids.
+     * @return Whether the root objects differ
+     */
+    bool hasRootMismatch() const;
+
+    /**
+     * @brief Returns true if something on the object tree
+     * structure (add/delete) has changed.
+     * @return Whether objects were added or removed
+     */
+    bool hasObjectTreeChanges() const;
+
+    /**
+     * @brief Returns the changes per object in the order they are applied.
+     * @return Object changes
+     */
+    const QVector<ObjectChange>& objectChanges() const;
+
+    /**
+     * @brief Appends the changes of the given diff.
+     * @param diff Diff to append
+     * @return False if the given diff is empty
+     */
+    bool appendDiff(const GtTypedMementoDiff& diff);
+
+    inline GtTypedMementoDiff& operator<< (const GtTypedMementoDiff& t)
+    {
+        appendDiff(t);
+        return *this;
+    }
+
+private:
+    QVector<ObjectChange> m_changes;
+
+    bool m_valid{true};
+
+    bool m_rootMismatch{false};
+
+    bool makeDiff(const GtObjectMemento& left, const GtObjectMemento& right);
+
+    static void detectPropertyChanges(
+        const QVector<GtObjectMemento::PropertyData>& leftProperties,
+        const QVector<GtObjectMemento::PropertyData>& rightProperties,
+        std::vector<Operation>& operations);
+
+    static void detectContainerChanges(
+        const GtObjectMemento::PropertyData& leftContainer,
+        const GtObjectMemento::PropertyData& rightContainer,
+        std::vector<Operation>& operations);
+};
+
+#endif // GTTYPEDMEMENTODIFF_H
@@ -20,6 +20,9 @@ constexpr const char * S_OBJECTREF_TAG = "objectref";
 constexpr const char * S_ASLINK_TAG = "aslink";
 constexpr const char * S_REFONLY_TAG = "refonly";
 constexpr const char * S_HREF_TAG = "href";
+constexpr const char * S_LOAD_TAG = "load";
+constexpr const char * S_LOAD_ONDEMAND = "on-demand";
+constexpr const char * S_LINKBASE_TAG = "linkbase";
 constexpr const char * S_UUID_TAG = "uuid";
 constexpr const char * S_CLASS_TAG = "class";
 constexpr const char * S_NAME_TAG = "name";
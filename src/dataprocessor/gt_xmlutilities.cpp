@@ -10,19 +10,26 @@
  */
 
 #include <QDomElement>
+#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 #include <QTextStream>
 #include <QFile>
-#include <QRegularExpression>
 #include <QUuid>
+#include <QThreadPool>
 
 #include "gt_xmlutilities.h"
 #include "gt_xmlexpr.h"
 #include "gt_objectio.h"
+#include "gt_objectmemento.h"
 #include "gt_batchsaver.h"
 
 #include "gt_logging.h"
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
 
 namespace
 {
@@ -107,51 +114,55 @@ bool
 gt::xml::writeDomElementOrderedAttribute(const QDomElement& element,
                                          QXmlStreamWriter& writer)
 {
-    static QRegularExpression carriageReturns("[\\r]");
-
     writer.writeStartElement(element.tagName());
 
     // attributes
-    QStringList attr_ids;
     QDomNamedNodeMap attr_nodes = element.attributes();
 
+    std::vector<std::pair<QString, QString>> attrs;
+    attrs.reserve(attr_nodes.size());
+
     for (int i = 0; i < attr_nodes.size(); ++i)
     {
-        QDomNode attr_node = attr_nodes.item(i);
-        QDomAttr attr = attr_node.toAttr();
-        attr_ids << attr.name();
+        QDomAttr attr = attr_nodes.item(i).toAttr();
+        attrs.emplace_back(attr.name(), attr.value());
     }
 
-    attr_ids.sort();
+    std::sort(attrs.begin(), attrs.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
 
-    foreach (const QString& attr_id, attr_ids)
+    for (const auto& attr : attrs)
     {
-        writer.writeAttribute(attr_id, element.attribute(attr_id));
+        writer.writeAttribute(attr.first, attr.second);
     }
 
-    if (element.hasChildNodes())
-    {
-        QDomNode c_node = element.firstChild();
+    QDomNode c_node = element.firstChild();
 
-        while (!c_node.isNull())
+    while (!c_node.isNull())
+    {
+        if (c_node.nodeType() == QDomNode::TextNode)
         {
-            if (c_node.nodeType() == QDomNode::TextNode)
+            QString text = c_node.toText().data();
+
+            // remove carriage returns to avoid double definitions
+            if (text.contains(QLatin1Char('\r')))
             {
-                // remove carriage returns to avoid double definitions
-                writer.writeCharacters(
-                            c_node.toText().data().remove(carriageReturns));
+                text.remove(QLatin1Char('\r'));
             }
-            else if (c_node.nodeType() == QDomNode::ElementNode)
+
+            writer.writeCharacters(text);
+        }
+        else if (c_node.nodeType() == QDomNode::ElementNode)
+        {
+            if (!gt::xml::writeDomElementOrderedAttribute(
+                        c_node.toElement(), writer))
             {
-                if (!gt::xml::writeDomElementOrderedAttribute(
-                            c_node.toElement(), writer))
-                {
-                    return false;
-                }
+                return false;
             }
-
-            c_node = c_node.nextSibling();
         }
+
+        c_node = c_node.nextSibling();
     }
 
     writer.writeEndElement();
@@ -220,6 +231,47 @@ gt::xml::writeDomDocumentToDevice(QIODevice& device,
     return true;
 }
 
+bool
+gt::xml::writeMementoToFile(const QString& filePath,
+                            const GtObjectMemento& memento)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    bool success = writeMementoToDevice(file, memento);
+
+    file.close();
+    return success;
+}
+
+bool
+gt::xml::writeMementoToDevice(QIODevice& device,
+                              const GtObjectMemento& memento)
+{
+    QXmlStreamWriter str_w(&device);
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    str_w.setCodec("UTF-8");
+#endif
+
+    str_w.setAutoFormatting(true);
+
+    str_w.writeStartDocument(QStringLiteral("1.0"));
+
+    if (!memento.isNull())
+    {
+        GtObjectIO().writeXml(memento, str_w);
+    }
+
+    str_w.writeEndDocument();
+
+    return !str_w.hasError();
+}
+
 QDomElement
 gt::xml::createPropertyElement(QDomDocument &doc, const QString &propertyId,
                             const QString &propertyType, const QString &value)
@@ -321,6 +373,91 @@ struct LinkedObject
     QDomDocument doc; // GTLABOBJECTFILE wrapper
 };
 
+struct LinkedFileJob
+{
+    QDomElement refElem;  // objectref to replace
+    QString targetPath;   // path of the linked file
+    QDomDocument doc;     // expanded linked document
+    QStringList warnings; // warnings of this job
+};
+
+/// Job executing a function in a worker thread
+class FunctionJob : public QRunnable
+{
+public:
+    explicit FunctionJob(std::function<void()> func) :
+        m_func(std::move(func))
+    { }
+
+    void run() override
+    {
+        m_func();
+    }
+
+private:
+    std::function<void()> m_func;
+};
+
+/**
+ * @brief Loads the linked file of a placeholder <objectref> (see
+ * gt::xml::LinkedObjectLoading::OnDemand) including all nested links and
+ * replaces the placeholder by the linked object.
+ *
+ * Implementation below
+ *
+ * @param doc      Document containing the placeholder
+ * @param refElem  Placeholder element
+ * @param warnings Optional output list for warning messages
+ * @return The imported <object> element or a null element on failure. In
+ *         this case, the placeholder is kept.
+ */
+QDomElement expandPlaceholderRef(QDomDocument& doc, QDomElement& refElem,
+                                 QStringList* warnings);
+
+/**
+ * @brief Computes the path of the linked file of an object
+ * @param objectPath   Sanitized object names of the hierarchy including the
+ *                     object itself
+ * @param linksRootDir Root directory of the linked files
+ * @param uuid         Uuid of the object
+ * @return Absolute path of the linked file
+ */
+QString
+linkedObjectFilePath(const QStringList& objectPath, const QDir& linksRootDir,
+                     const QString& uuid)
+{
+    using namespace gt::xml;
+
+    const QString sanitizedObjName = objectPath.last();
+    const QString cleanUuid = sanitizeUuid(uuid);
+
+    QString relDir;
+    if (objectPath.size() > 1)
+    {
+        QStringList dirParts = objectPath;
+        dirParts.removeLast();
+        relDir = dirParts.join(QLatin1Char('/'));
+    }
+
+    const QString absDir = relDir.isEmpty()
+                               ? linksRootDir.absolutePath()
+                               : linksRootDir.filePath(relDir);
+
+    QString fileName;
+    if (!cleanUuid.isEmpty())
+    {
+        fileName = QStringLiteral("%1_%2.gtobj.xml")
+                       .arg(sanitizedObjName, cleanUuid);
+    }
+    else
+    {
+        fileName =
+            QStringLiteral("%1.gtobj.xml").arg(sanitizedObjName);
+    }
+
+    return QDir(absDir).filePath(fileName);
+}
+
 /**
  * @brief Collect objects marked for separate file storage and rewrite them as links.
  *
@@ -337,7 +474,14 @@ struct LinkedObject
  *    @c <objectref> element that keeps the original @c class, @c name and
  *    @c uuid attributes and adds:
  *      - @c href : relative path of the separate object file (from @p baseDir),
- *      - @c load : currently set to @c "on-demand" as a hint.
+ *      - @c load : set to @c "on-demand" as a hint, that the object may be
+ *                  loaded lazily (see gt::xml::LinkedObjectLoading).
+ *
+ * Placeholder <objectref> elements of objects that were not loaded yet are
+ * kept, if their linked file is already located at the computed path.
+ * Otherwise, the linked file is loaded and processed like an <object> with
+ * @c aslink="true". If the file cannot be loaded, an error is appended to
+ * @p errors.
  *
  * Objects without an @c aslink attribute, or with any value other than "true"
  * (case-insensitive) or "1", are left embedded in the master document and are
@@ -371,11 +515,14 @@ struct LinkedObject
  *                    each <object> node marked with @c aslink="true" or @c "1".
  *                    The caller can later use these entries to write the
  *                    separate object files to disk.
+ * @param errors      Output list of placeholders that could not be rewritten
  */
 void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
                           const QDir& rootDir, const QDir& linksRootDir,
                           QStringList& objectPath,
-                          QVector<LinkedObject>& outExternal)
+                          QVector<LinkedObject>& outExternal,
+                          QStringList& errors,
+                          QHash<QString, QString>& linkedFiles)
 {
     using namespace gt::xml;
 
@@ -391,6 +538,55 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
 
         QDomElement elem = child.toElement();
 
+        if (elem.tagName() == S_OBJECTREF_TAG &&
+            elem.hasAttribute(S_LINKBASE_TAG))
+        {
+            // placeholder of an object that was not loaded yet
+            const QString objName =
+                elem.attribute(S_NAME_TAG, elem.attribute(S_CLASS_TAG));
+
+            objectPath.push_back(sanitizeName(objName));
+            const QString filePath = linkedObjectFilePath(
+                objectPath, linksRootDir, elem.attribute(S_UUID_TAG));
+            objectPath.pop_back();
+
+            const QString sourcePath =
+                QFileInfo(elem.attribute(S_HREF_TAG)).absoluteFilePath();
+
+            if (QFileInfo(filePath).absoluteFilePath() == sourcePath)
+            {
+                // linked file is up to date, only restore the relative link
+                elem.setAttribute(S_HREF_TAG, rootDir.relativeFilePath(filePath));
+                elem.setAttribute(S_LOAD_TAG, S_LOAD_ONDEMAND);
+                elem.removeAttribute(S_LINKBASE_TAG);
+                linkedFiles.insert(elem.attribute(S_UUID_TAG), sourcePath);
+                child = next;
+                continue;
+            }
+
+            // the linked file has to be written to its new location
+            QStringList warnings;
+            QDomElement expanded =
+                expandPlaceholderRef(masterDoc, elem, &warnings);
+            for (const QString& warning : qAsConst(warnings))
+            {
+                gtWarning() << warning;
+            }
+
+            if (expanded.isNull())
+            {
+                errors.push_back(
+                    QStringLiteral("Could not relocate linked object '%1' "
+                                   "from '%2'.").arg(objName, sourcePath));
+                child = next;
+                continue;
+            }
+
+            // process the loaded object like any other linked object
+            child = expanded;
+            continue;
+        }
+
         if (elem.tagName() == S_OBJECT_TAG)
         {
             const QString objName =
@@ -399,7 +595,6 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
             const QString uuid = elem.attribute(S_UUID_TAG);
 
             const QString sanitizedObjName = sanitizeName(objName);
-            const QString cleanUuid = sanitizeUuid(uuid);
 
             // track current object in hierarchy
             objectPath.push_back(sanitizedObjName);
@@ -433,34 +628,12 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
                 // Note: we call collectLinkedObjects on `imported`, not on `root`,
                 // so objectPath is not pushed twice for the same object.
                 collectLinkedObjects(extDoc, imported, rootDir, linksRootDir,
-                                     objectPath, outExternal);
+                                     objectPath, outExternal, errors,
+                                     linkedFiles);
 
                 // ---- compute directory + filename ----
-                QString relDir;
-                if (objectPath.size() > 1)
-                {
-                    QStringList dirParts = objectPath;
-                    dirParts.removeLast();
-                    relDir = dirParts.join(QLatin1Char('/'));
-                }
-
-                const QString absDir = relDir.isEmpty()
-                                           ? linksRootDir.absolutePath()
-                                           : linksRootDir.filePath(relDir);
-
-                QString fileName;
-                if (!cleanUuid.isEmpty())
-                {
-                    fileName = QStringLiteral("%1_%2.gtobj.xml")
-                                   .arg(sanitizedObjName, cleanUuid);
-                }
-                else
-                {
-                    fileName =
-                        QStringLiteral("%1.gtobj.xml").arg(sanitizedObjName);
-                }
-
-                const QString filePath = QDir(absDir).filePath(fileName);
+                const QString filePath =
+                    linkedObjectFilePath(objectPath, linksRootDir, uuid);
 
                 // href stored in master is relative to rootDir
                 const QString href = rootDir.relativeFilePath(filePath);
@@ -474,6 +647,12 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
                     ext.href = href;
                     ext.doc = extDoc;
                     outExternal.push_back(std::move(ext));
+
+                    if (!uuid.isEmpty())
+                    {
+                        linkedFiles.insert(
+                            uuid, QFileInfo(filePath).absoluteFilePath());
+                    }
                 }
 
                 // ---- replace <object> with <objectref> in master ----
@@ -483,6 +662,7 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
                 if (!uuid.isEmpty())
                     refElem.setAttribute(S_UUID_TAG, uuid);
                 refElem.setAttribute(S_HREF_TAG, href);
+                refElem.setAttribute(S_LOAD_TAG, S_LOAD_ONDEMAND);
 
                 node.replaceChild(refElem, child);
 
@@ -495,7 +675,8 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
             {
                 // normal object: recurse into its children
                 collectLinkedObjects(masterDoc, child, rootDir, linksRootDir,
-                                     objectPath, outExternal);
+                                     objectPath, outExternal, errors,
+                                     linkedFiles);
                 objectPath.pop_back();
                 child = next;
                 continue;
@@ -505,7 +686,8 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
         {
             // anything else: recurse into children
             collectLinkedObjects(masterDoc, child, rootDir, linksRootDir,
-                                 objectPath, outExternal);
+                                 objectPath, outExternal, errors,
+                                 linkedFiles);
             child = next;
         }
     }
@@ -518,13 +700,15 @@ void collectLinkedObjects(QDomDocument& masterDoc, QDomNode& node,
  */
 void expandObjectRefsInDocument(QDomDocument& doc, const QDir& baseDir,
                                 QStringList* warnings,
-                                QSet<QString>& recursionStack);
+                                QSet<QString>& recursionStack,
+                                gt::xml::LinkedObjectLoading loading);
 
 QDomDocument
 loadAndExpandImpl(const QString& path,
                   const QDir& baseDir,
                   QStringList* warnings,
-                  QSet<QString>& recursionStack)
+                  QSet<QString>& recursionStack,
+                  gt::xml::LinkedObjectLoading loading)
 {
 
 
@@ -582,17 +766,154 @@ loadAndExpandImpl(const QString& path,
         return warning(msg);
     }
 
-    expandObjectRefsInDocument(doc, baseDir, warnings, recursionStack);
+    expandObjectRefsInDocument(doc, baseDir, warnings, recursionStack, loading);
 
     recursionStack.remove(absPath);
     return doc;
 }
 
+/**
+ * @brief Returns the <object> element of a linked document
+ */
+QDomElement
+linkedObjectElement(const QDomDocument& linkedDoc)
+{
+    QDomElement linkedRoot = linkedDoc.documentElement();
+
+    // Typical pattern: <Root> <object ...>...</object> </Root>
+    QDomElement objectElem = linkedRoot.firstChildElement(gt::xml::S_OBJECT_TAG);
+    if (objectElem.isNull())
+        objectElem = linkedRoot;
+
+    return objectElem;
+}
+
+/**
+ * @brief Replaces the objectref element by the object of the linked document
+ * @return The imported object element or a null element on failure
+ */
+QDomElement
+replaceObjectRef(QDomDocument& doc, QDomElement& refElem,
+                 const QDomDocument& linkedDoc)
+{
+    QDomElement objectElem = linkedObjectElement(linkedDoc);
+
+    // Mark imported note as aslink=true to make a potential 'writeXml'
+    // after a 'readXml' still write linked files. Otherwise, the link 
+    // information is lost
+    objectElem.setAttribute(gt::xml::S_ASLINK_TAG, "true");
+
+    QDomNode imported = doc.importNode(objectElem, /*deep=*/true);
+    QDomNode parent   = refElem.parentNode();
+
+    if (parent.isNull() || imported.isNull())
+    {
+        return {};
+    }
+
+    parent.replaceChild(imported, refElem);
+    return imported.toElement();
+}
+
+QDomElement
+expandPlaceholderRef(QDomDocument& doc, QDomElement& refElem,
+                     QStringList* warnings)
+{
+    const QDir baseDir(refElem.attribute(gt::xml::S_LINKBASE_TAG));
+
+    QSet<QString> recursionStack;
+    QDomDocument linkedDoc =
+        loadAndExpandImpl(refElem.attribute(gt::xml::S_HREF_TAG), baseDir,
+                          warnings, recursionStack,
+                          gt::xml::LinkedObjectLoading::Eager);
+
+    if (linkedDoc.documentElement().isNull()) return {};
+
+    return replaceObjectRef(doc, refElem, linkedDoc);
+}
+
+/**
+ * @brief Loads all placeholders of the document, e.g. to save the document as
+ * one file.
+ * @param doc Document
+ * @param errors Output list of errors
+ */
+void
+expandPlaceholderRefs(QDomDocument& doc, QStringList& errors)
+{
+    QDomNodeList nodeList = doc.elementsByTagName(gt::xml::S_OBJECTREF_TAG);
+
+    QList<QDomElement> refs;
+    for (int i = 0; i < nodeList.count(); ++i)
+    {
+        QDomElement e = nodeList.at(i).toElement();
+        if (e.hasAttribute(gt::xml::S_LINKBASE_TAG))
+            refs.push_back(e);
+    }
+
+    for (QDomElement& refElem : refs)
+    {
+        QStringList warnings;
+        QDomElement expanded = expandPlaceholderRef(doc, refElem, &warnings);
+        for (const QString& warning : qAsConst(warnings))
+        {
+            gtWarning() << warning;
+        }
+
+        if (expanded.isNull())
+        {
+            errors.push_back(
+                QStringLiteral("Could not load linked object '%1' from '%2'.")
+                    .arg(refElem.attribute(gt::xml::S_NAME_TAG),
+                         refElem.attribute(gt::xml::S_HREF_TAG)));
+        }
+    }
+}
+
+/**
+ * @brief Loads all placeholders of the memento and its children, e.g. to save
+ * the memento as one file.
+ * @param memento Memento
+ * @param errors Output list of errors
+ */
+void
+expandPlaceholders(GtObjectMemento& memento, QStringList& errors)
+{
+    if (memento.isFlagEnabled(GtObjectMemento::IsPlaceholder))
+    {
+        QStringList warnings;
+        GtObjectMemento expanded = memento.loadLinkedFile(&warnings, true);
+        for (const QString& warning : qAsConst(warnings))
+        {
+            gtWarning() << warning;
+        }
+
+        if (expanded.isNull())
+        {
+            errors.push_back(
+                QStringLiteral("Could not load linked object '%1' from '%2'.")
+                    .arg(memento.ident(), memento.linkedFilePath()));
+            return;
+        }
+
+        // written as link like the objects expanded by replaceObjectRef
+        expanded.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+        memento = std::move(expanded);
+        return;
+    }
+
+    for (GtObjectMemento& child : memento.childObjects)
+    {
+        expandPlaceholders(child, errors);
+    }
+}
+
 void
 expandObjectRefsInDocument(QDomDocument& doc,
                             const QDir& baseDir,
                             QStringList* warnings,
-                            QSet<QString>& recursionStack)
+                            QSet<QString>& recursionStack,
+                            gt::xml::LinkedObjectLoading loading)
 {
     QDomNodeList nodeList = doc.elementsByTagName(gt::xml::S_OBJECTREF_TAG);
 
@@ -606,7 +927,10 @@ expandObjectRefsInDocument(QDomDocument& doc,
             refs.push_back(e);
     }
 
-    for (const QDomElement& refElem : refs)
+    // linked files that have to be loaded
+    std::vector<LinkedFileJob> jobs;
+
+    for (QDomElement& refElem : refs)
     {
         const QString uuid    = refElem.attribute(gt::xml::S_UUID_TAG);
         const QString relPath = refElem.attribute(gt::xml::S_HREF_TAG);
@@ -620,42 +944,82 @@ expandObjectRefsInDocument(QDomDocument& doc,
         }
 
         const QString targetPath = baseDir.filePath(relPath);
-        QDomDocument linkedDoc = loadAndExpandImpl(targetPath, baseDir, warnings, recursionStack);
 
-        if (linkedDoc.documentElement().isNull())
+        if (loading == gt::xml::LinkedObjectLoading::OnDemand &&
+            refElem.attribute(gt::xml::S_LOAD_TAG) == gt::xml::S_LOAD_ONDEMAND)
         {
-            const QString msg =
-                QStringLiteral("Could not expand link '%1' for objectref uuid='%2'; keeping objectref.")
-                    .arg(targetPath, uuid);
-            if (warnings) warnings->push_back(msg);
-            continue; // keep objectref
+            if (!QFileInfo::exists(targetPath))
+            {
+                const QString msg =
+                    QStringLiteral("Linked file '%1' does not exist; keeping objectref.").arg(targetPath);
+                if (warnings) warnings->push_back(msg);
+                continue; // keep objectref
+            }
+
+            // keep the reference, it is restored as placeholder that loads
+            // the linked file on first access
+            refElem.setAttribute(gt::xml::S_HREF_TAG,
+                                 QFileInfo(targetPath).absoluteFilePath());
+            refElem.setAttribute(gt::xml::S_LINKBASE_TAG,
+                                 baseDir.absolutePath());
+            continue;
         }
 
-        QDomElement linkedRoot = linkedDoc.documentElement();
+        LinkedFileJob job;
+        job.refElem = refElem;
+        job.targetPath = targetPath;
+        jobs.push_back(std::move(job));
+    }
+
+    // each job works on its own copy of the recursion stack, thus the
+    // linked files can be parsed concurrently
+    auto load = [&](LinkedFileJob& job)
+    {
+        QSet<QString> stack = recursionStack;
+        job.doc = loadAndExpandImpl(job.targetPath, baseDir, &job.warnings,
+                                    stack, loading);
+    };
+
+    // only the links of the top-level document are parsed in parallel, the
+    // nested links are expanded by the worker threads sequentially
+    if (jobs.size() > 1 && recursionStack.size() <= 1)
+    {
+        QThreadPool pool;
+        for (LinkedFileJob& job : jobs)
+        {
+            pool.start(new FunctionJob([&load, &job]() { load(job); }));
+        }
+        pool.waitForDone();
+    }
+    else
+    {
+        for (LinkedFileJob& job : jobs) load(job);
+    }
 
-        // Typical pattern: <Root> <object ...>...</object> </Root>
-        QDomElement objectElem = linkedRoot.firstChildElement("object");
-        if (objectElem.isNull())
-            objectElem = linkedRoot;
+    // the DOM is modified by the calling thread only
+    for (LinkedFileJob& job : jobs)
+    {
+        const QString uuid = job.refElem.attribute(gt::xml::S_UUID_TAG);
 
-        // Mark imported note as aslink=true to make a potential 'writeXml'
-        // after a 'readXml' still write linked files. Otherwise, the link 
-        // information is lost
-        objectElem.setAttribute(gt::xml::S_ASLINK_TAG, "true");
+        if (warnings) warnings->append(job.warnings);
 
-        QDomNode imported = doc.importNode(objectElem, /*deep=*/true);
-        QDomNode parent   = refElem.parentNode();
+        if (job.doc.documentElement().isNull())
+        {
+            const QString msg =
+                QStringLiteral("Could not expand link '%1' for objectref uuid='%2'; keeping objectref.")
+                    .arg(job.targetPath, uuid);
+            if (warnings) warnings->push_back(msg);
+            continue; // keep objectref
+        }
 
-        if (parent.isNull() || imported.isNull())
+        if (replaceObjectRef(doc, job.refElem, job.doc).isNull())
         {
             const QString msg =
                 QStringLiteral("Failed to replace objectref from '%1' (uuid='%2'); keeping objectref.")
-                    .arg(targetPath, uuid);
+                    .arg(job.targetPath, uuid);
             if (warnings) warnings->push_back(msg);
             continue;
         }
-
-        parent.replaceChild(imported, refElem);
     }
 }
 
@@ -664,7 +1028,9 @@ expandObjectRefsInDocument(QDomDocument& doc,
 
 
 QDomDocument
-gt::xml::loadProjectXmlWithLinkedObjects(const QString &masterPath, QStringList *warnings)
+gt::xml::loadProjectXmlWithLinkedObjects(const QString &masterPath,
+                                         QStringList *warnings,
+                                         LinkedObjectLoading loading)
 {
 
     QFileInfo fileInfo(masterPath);
@@ -673,7 +1039,294 @@ gt::xml::loadProjectXmlWithLinkedObjects(const QString &masterPath, QStringList
 
 
     QSet<QString> recursionStack;
-    return loadAndExpandImpl(masterPath, baseDir, warnings, recursionStack);
+    return loadAndExpandImpl(masterPath, baseDir, warnings, recursionStack,
+                             loading);
+}
+
+QDomElement
+gt::xml::loadLinkedObjectXml(const QString& filePath, const QDir& baseDir,
+                             QStringList* warnings,
+                             LinkedObjectLoading loading)
+{
+    QSet<QString> recursionStack;
+    QDomDocument doc = loadAndExpandImpl(filePath, baseDir, warnings,
+                                         recursionStack, loading);
+
+    if (doc.documentElement().isNull()) return {};
+
+    return linkedObjectElement(doc);
+}
+
+namespace
+{
+
+GtObjectMemento
+readLinkedMementoImpl(const QString& path, const QDir& baseDir,
+                      QStringList* warnings, QSet<QString>& recursionStack,
+                      gt::xml::LinkedObjectLoading loading);
+
+/**
+ * @brief Reads the <objectref> element the reader is positioned at and
+ * resolves its linked file (streaming counterpart of
+ * expandObjectRefsInDocument). The element is consumed.
+ */
+GtObjectMemento
+readObjectRefMemento(QXmlStreamReader& reader, const QDir& baseDir,
+                     QStringList* warnings, QSet<QString>& recursionStack,
+                     gt::xml::LinkedObjectLoading loading)
+{
+    const QXmlStreamAttributes attrs = reader.attributes();
+    const QString uuid =
+        attrs.value(QLatin1String(gt::xml::S_UUID_TAG)).toString();
+    const QString relPath =
+        attrs.value(QLatin1String(gt::xml::S_HREF_TAG)).toString();
+
+    // the objectref is kept and restored as unresolved dummy
+    auto keepObjectRef = [&reader]() {
+        return GtObjectIO().readXml(reader);
+    };
+
+    if (relPath.isEmpty())
+    {
+        const QString msg =
+            QStringLiteral("objectref (uuid='%1') has no href; keeping objectref.").arg(uuid);
+        if (warnings) warnings->push_back(msg);
+        return keepObjectRef();
+    }
+
+    const QString targetPath = baseDir.filePath(relPath);
+
+    if (loading == gt::xml::LinkedObjectLoading::OnDemand &&
+        attrs.value(QLatin1String(gt::xml::S_LOAD_TAG)) ==
+            QLatin1String(gt::xml::S_LOAD_ONDEMAND))
+    {
+        if (!QFileInfo::exists(targetPath))
+        {
+            const QString msg =
+                QStringLiteral("Linked file '%1' does not exist; keeping objectref.").arg(targetPath);
+            if (warnings) warnings->push_back(msg);
+            return keepObjectRef();
+        }
+
+        reader.skipCurrentElement();
+
+        // placeholder, that loads the linked file on first access
+        auto placeholder = GtObjectMemento{}
+            .setClassName(
+                attrs.value(QLatin1String(gt::xml::S_CLASS_TAG)).toString())
+            .setUuid(uuid)
+            .setIdent(
+                attrs.value(QLatin1String(gt::xml::S_NAME_TAG)).toString());
+        placeholder.setLinkedFile(QFileInfo(targetPath).absoluteFilePath(),
+                                  baseDir.absolutePath());
+        placeholder.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+
+        return placeholder;
+    }
+
+    GtObjectMemento linked = readLinkedMementoImpl(targetPath, baseDir,
+                                                   warnings, recursionStack,
+                                                   loading);
+
+    if (linked.isNull())
+    {
+        const QString msg =
+            QStringLiteral("Could not expand link '%1' for objectref uuid='%2'; keeping objectref.")
+                .arg(targetPath, uuid);
+        if (warnings) warnings->push_back(msg);
+        return keepObjectRef();
+    }
+
+    reader.skipCurrentElement();
+    return linked;
+}
+
+/**
+ * @brief Reads the <object> element of a linked file (streaming counterpart
+ * of loadAndExpandImpl)
+ * @return The memento of the object or a null memento on failure
+ */
+GtObjectMemento
+readLinkedMementoImpl(const QString& path, const QDir& baseDir,
+                      QStringList* warnings, QSet<QString>& recursionStack,
+                      gt::xml::LinkedObjectLoading loading)
+{
+    const QString absPath = QFileInfo(path).absoluteFilePath();
+
+    auto warning = [&](const QString& msg)
+    {
+        if (warnings) warnings->push_back(msg);
+        return GtObjectMemento{};
+    };
+
+    // Simple cycle protection: A.xml -> B.xml -> A.xml
+    if (recursionStack.contains(absPath))
+    {
+        return warning(
+            QStringLiteral("Detected recursive include of '%1'; keeping objectref nodes.").arg(absPath));
+    }
+
+    QFile linkedFile(absPath);
+
+    if (!linkedFile.exists())
+    {
+        return warning(
+            QStringLiteral("Linked file '%1' does not exist; keeping objectref nodes.").arg(absPath));
+    }
+
+    const QString parseError =
+        QStringLiteral("Could not read or parse '%1'; keeping objectref nodes that reference it.")
+            .arg(absPath);
+
+    if (!linkedFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return warning(parseError);
+    }
+
+    recursionStack.insert(absPath);
+
+    auto readObjectRef = [&](QXmlStreamReader& r) {
+        return readObjectRefMemento(r, baseDir, warnings, recursionStack,
+                                    loading);
+    };
+
+    QXmlStreamReader reader(&linkedFile);
+    GtObjectMemento memento;
+
+    // Typical pattern: <Root> <object ...>...</object> </Root>
+    if (reader.readNextStartElement())
+    {
+        if (reader.name() == QLatin1String(gt::xml::S_OBJECT_TAG))
+        {
+            memento = GtObjectIO().readXml(reader, readObjectRef);
+        }
+
+        while (memento.isNull() && reader.readNextStartElement())
+        {
+            if (reader.name() == QLatin1String(gt::xml::S_OBJECT_TAG))
+            {
+                memento = GtObjectIO().readXml(reader, readObjectRef);
+            }
+            else
+            {
+                reader.skipCurrentElement();
+            }
+        }
+    }
+
+    recursionStack.remove(absPath);
+
+    if (reader.hasError())
+    {
+        const QString msg2 = QObject::tr("XML ERROR! line: %1 column: %2 -> %3")
+                                 .arg(reader.lineNumber())
+                                 .arg(reader.columnNumber())
+                                 .arg(reader.errorString());
+        return warning(parseError + "\n" + msg2);
+    }
+
+    if (memento.isNull()) return warning(parseError);
+
+    return memento;
+}
+
+} // namespace
+
+bool
+gt::xml::readMementosWithLinkedObjects(const QString& masterPath,
+                                       QVector<GtObjectMemento>& objects,
+                                       QString* rootTag,
+                                       QHash<QString, QString>* rootAttributes,
+                                       QStringList* warnings,
+                                       LinkedObjectLoading loading)
+{
+    const QString absPath = QFileInfo(masterPath).absoluteFilePath();
+    const QDir baseDir = QFileInfo(absPath).dir();
+
+    QFile file(absPath);
+
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        if (warnings)
+        {
+            warnings->push_back(
+                QStringLiteral("could not open file! (%1)").arg(absPath));
+        }
+        return false;
+    }
+
+    QSet<QString> recursionStack;
+    recursionStack.insert(absPath);
+
+    auto readObjectRef = [&](QXmlStreamReader& r) {
+        return readObjectRefMemento(r, baseDir, warnings, recursionStack,
+                                    loading);
+    };
+
+    QXmlStreamReader reader(&file);
+
+    if (reader.readNextStartElement())
+    {
+        if (rootTag) *rootTag = reader.name().toString();
+
+        if (rootAttributes)
+        {
+            const QXmlStreamAttributes attrs = reader.attributes();
+            for (const QXmlStreamAttribute& attr : attrs)
+            {
+                rootAttributes->insert(attr.name().toString(),
+                                       attr.value().toString());
+            }
+        }
+
+        while (reader.readNextStartElement())
+        {
+            if (reader.name() == QLatin1String(S_OBJECT_TAG))
+            {
+                objects.push_back(GtObjectIO().readXml(reader, readObjectRef));
+            }
+            else if (reader.name() == QLatin1String(S_OBJECTREF_TAG))
+            {
+                objects.push_back(readObjectRef(reader));
+            }
+            else
+            {
+                reader.skipCurrentElement();
+            }
+        }
+    }
+
+    // the rest of the document must be well-formed as well
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+    }
+
+    if (reader.hasError())
+    {
+        if (warnings)
+        {
+            warnings->push_back(
+                QObject::tr("XML ERROR! line: %1 column: %2 -> %3")
+                    .arg(reader.lineNumber())
+                    .arg(reader.columnNumber())
+                    .arg(reader.errorString()));
+        }
+        objects.clear();
+        return false;
+    }
+
+    return true;
+}
+
+GtObjectMemento
+gt::xml::loadLinkedObjectMemento(const QString& filePath, const QDir& baseDir,
+                                 QStringList* warnings,
+                                 LinkedObjectLoading loading)
+{
+    QSet<QString> recursionStack;
+    return readLinkedMementoImpl(filePath, baseDir, warnings, recursionStack,
+                                 loading);
 }
 
 bool
@@ -682,9 +1335,14 @@ gt::xml::saveProjectXmlWithLinkedObjects(const QString& projectName,
                                          const QDir& baseDir,
                                          const QString& masterFilePath,
                                          LinkFileSaveType saveType,
-                                         QString* errorOut)
+                                         QString* errorOut,
+                                         QHash<QString, QString>* linkedFiles)
 {
     if (errorOut) errorOut->clear();
+    if (linkedFiles) linkedFiles->clear();
+
+    // uuid -> linked file of all objectrefs
+    QHash<QString, QString> savedLinkedFiles;
 
     // work on a copy, since doc is const
     QDomDocument masterDoc = doc;
@@ -697,8 +1355,15 @@ gt::xml::saveProjectXmlWithLinkedObjects(const QString& projectName,
     // 2) batch save: externals + master
     GtBatchSaver batchsaver;
 
+    QStringList errors;
+
     QDomElement rootElem = masterDoc.documentElement();
-    if (!rootElem.isNull() && saveType == LinkFileSaveType::WithLinkedFiles)
+    if (!rootElem.isNull() && saveType == LinkFileSaveType::OneFile)
+    {
+        // objects, that were not loaded yet, must be embedded
+        expandPlaceholderRefs(masterDoc, errors);
+    }
+    else if (!rootElem.isNull())
     {
         QDomNode rootNode = rootElem;
 
@@ -710,7 +1375,8 @@ gt::xml::saveProjectXmlWithLinkedObjects(const QString& projectName,
         const QDir linksRootDir(baseDir.filePath(packageName));
 
         collectLinkedObjects(masterDoc, rootNode, baseDir,
-                                      linksRootDir, objectPath, externals);
+                                      linksRootDir, objectPath, externals,
+                                      errors, savedLinkedFiles);
 
         // external object files first
         for (const LinkedObject& ext : qAsConst(externals))
@@ -720,6 +1386,15 @@ gt::xml::saveProjectXmlWithLinkedObjects(const QString& projectName,
         }
     }
 
+    if (!errors.isEmpty())
+    {
+        // do not write anything, the linked data would be lost otherwise
+        if (errorOut) *errorOut = errors.join(QLatin1Char('\n'));
+        gtError() << projectName << QStringLiteral(": ")
+                  << errors.join(QLatin1Char('\n'));
+        return false;
+    }
+
     // master file last
     batchsaver.addXml(masterFilePath, masterDoc, true);
 
@@ -731,8 +1406,58 @@ gt::xml::saveProjectXmlWithLinkedObjects(const QString& projectName,
         return false;
     }
 
+    if (linkedFiles) *linkedFiles = std::move(savedLinkedFiles);
+
+    return true;
+}
+
+bool
+gt::xml::saveModuleXmlFromMementos(const QString& filePath,
+                                   const QString& packageUuid,
+                                   QVector<GtObjectMemento> objects,
+                                   QString* errorOut)
+{
+    if (errorOut) errorOut->clear();
+
+    // objects, that were not loaded yet, must be embedded
+    QStringList errors;
+    for (GtObjectMemento& memento : objects)
+    {
+        expandPlaceholders(memento, errors);
+    }
+
+    if (!errors.isEmpty())
+    {
+        // do not write anything, the linked data would be lost otherwise
+        if (errorOut) *errorOut = errors.join(QLatin1Char('\n'));
+        return false;
+    }
+
+    GtBatchSaver batchsaver;
+    batchsaver.addXml(filePath,
+                      [&packageUuid, &objects](QXmlStreamWriter& writer) {
+        writer.writeStartElement(QStringLiteral("GTLABMODULE"));
+        writer.writeAttribute(gt::xml::S_UUID_TAG, packageUuid);
+
+        GtObjectIO io;
+        for (const GtObjectMemento& memento : qAsConst(objects))
+        {
+            io.writeXml(memento, writer);
+        }
+
+        writer.writeEndElement();
+        return true;
+    });
+
+    if (!batchsaver.commit())
+    {
+        if (errorOut) *errorOut = batchsaver.errorString();
+        return false;
+    }
+
     return true;
 }
+
 QDomElement
 gt::xml::findParentByAttribute(const QDomElement& start,
                                const QString& attribute,
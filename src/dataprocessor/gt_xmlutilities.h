@@ -15,6 +15,8 @@
 #include "gt_datamodel_exports.h"
 
 #include <QList>
+#include <QVector>
+#include <QHash>
 #include <QDomElement>
 #include <QDir>
 #include <QStringList>
@@ -25,6 +27,7 @@ class QDomDocument;
 class QXmlStreamWriter;
 class QString;
 class QFile;
+class GtObjectMemento;
 
 namespace gt
 {
@@ -71,6 +74,30 @@ bool GT_DATAMODEL_EXPORT writeDomDocumentToDevice(QIODevice& device,
                                                   const QDomDocument& doc,
                                                   bool attrOrdered = true);
 
+/**
+ * @brief Writes the memento as XML document to the given file path. The
+ * output is identical to writing the DOM document of the memento with
+ * ordered attributes, but no intermediate DOM tree is built.
+ * @param filePath Target file path (e.g. /home/files/my_file.xml)
+ * @param memento Memento to write
+ * @return Returns true if the memento was written successfully.
+ * Otherwise, false is returned.
+ */
+bool GT_DATAMODEL_EXPORT writeMementoToFile(const QString& filePath,
+                                            const GtObjectMemento& memento);
+
+/**
+ * @brief Writes the memento as XML document to the output device. The
+ * output is identical to writing the DOM document of the memento with
+ * ordered attributes, but no intermediate DOM tree is built.
+ * @param device The device to write to
+ * @param memento Memento to write
+ * @return Returns true if the memento was written successfully.
+ * Otherwise, false is returned.
+ */
+bool GT_DATAMODEL_EXPORT writeMementoToDevice(QIODevice& device,
+                                              const GtObjectMemento& memento);
+
 
 /**
  * @brief This function parses the XML document from given file.
@@ -225,6 +252,19 @@ enum class LinkFileSaveType
     WithLinkedFiles
 };
 
+/**
+ * @brief Determines how linked object files are loaded
+ */
+enum class LinkedObjectLoading
+{
+    /// all linked files are loaded and expanded immediately
+    Eager,
+    /// object references marked with load="on-demand" are kept. They are
+    /// restored as placeholder objects, that load the linked file on first
+    /// access (see GtObject::materialize)
+    OnDemand
+};
+
 /**
  * @brief Save a project XML document as a master file plus linked object files.
  *
@@ -252,6 +292,13 @@ enum class LinkFileSaveType
  * The input document @p doc is not modified by the caller; the function works
  * on an internal copy when transforming <object> into <objectref> nodes.
  *
+ * Placeholder <objectref> elements of objects that were not loaded yet (see
+ * LinkedObjectLoading::OnDemand) or that did not change since they were
+ * loaded or saved keep their linked file, if its location did not change.
+ * The linked file is neither serialized nor written again in this case.
+ * Otherwise, e.g. if the project is saved to another directory or as one
+ * file, the linked file is loaded and written to the new location.
+ *
  * This mechanism is purely about how objects are stored on disk. It is
  * unrelated to “externalized objects” in the runtime sense (objects that are
  * not kept in memory and are loaded on demand).
@@ -271,6 +318,9 @@ enum class LinkFileSaveType
  *                       human-readable error description if the function
  *                       returns @c false. If @c nullptr, the error text is
  *                       discarded.
+ * @param linkedFiles    Optional output map receiving the absolute path of the
+ *                       linked object file of each object uuid referenced by
+ *                       the saved files (written or kept).
  *
  * @return @c true if all files were written successfully and the on-disk state
  *         is consistent; @c false if an error occurred (in which case no files
@@ -282,7 +332,34 @@ bool saveProjectXmlWithLinkedObjects(const QString& projectName,
                                      const QDir& baseDir,
                                      const QString& masterFilePath,
                                      LinkFileSaveType saveType,
-                                     QString* errorOut);
+                                     QString* errorOut,
+                                     QHash<QString, QString>* linkedFiles =
+                                         nullptr);
+
+/**
+ * @brief Saves a module file as one file from the mementos of the package
+ * objects (see GtPackage::saveMementoData).
+ *
+ * The objects are streamed into the file without building a QDomDocument.
+ * The output equals saving the DOM document of the package with
+ * saveProjectXmlWithLinkedObjects and LinkFileSaveType::OneFile, i.e.
+ * placeholders of linked objects that were not loaded yet are embedded.
+ *
+ * @param filePath    Path of the module file to write.
+ * @param packageUuid Uuid of the package stored in the root element.
+ * @param objects     Mementos of the package objects.
+ * @param errorOut    Optional pointer to a string that will receive a
+ *                    human-readable error description if the function
+ *                    returns @c false.
+ *
+ * @return @c true if the file was written successfully; @c false otherwise
+ *         (in which case the file is not updated).
+ */
+GT_DATAMODEL_EXPORT
+bool saveModuleXmlFromMementos(const QString& filePath,
+                               const QString& packageUuid,
+                               QVector<GtObjectMemento> objects,
+                               QString* errorOut);
 
 
 /**
@@ -311,16 +388,94 @@ bool saveProjectXmlWithLinkedObjects(const QString& projectName,
  *
  * @param masterPath Absolute or relative path to the master XML file
  *                   (e.g. "package.xml").
+ * On-demand loading:
+ * - If @p loading is LinkedObjectLoading::OnDemand, <objectref> elements
+ *   carrying the hint load="on-demand" are not expanded. Instead, their href
+ *   is made absolute and the base directory of the links is stored in the
+ *   "linkbase" attribute. Such elements are restored as placeholder objects
+ *   (see GtObjectMemento::IsPlaceholder). Placeholders whose linked file is
+ *   missing are kept as before and restored as unresolved dummies.
+ *
+ * @param masterPath Absolute or relative path to the master XML file
+ *                   (e.g. "package.xml").
  * @param warnings   Optional output list that will receive human-readable
  *                   warning messages about failed or recursive includes. May
  *                   be nullptr if no messages are needed.
+ * @param loading    Whether linked files are loaded eagerly or on demand.
  *
  * @return A QDomDocument representing the expanded XML tree. If the master
  *         document cannot be read or parsed at all, an empty QDomDocument
  *         (with null root element) is returned.
  */
 GT_DATAMODEL_EXPORT QDomDocument loadProjectXmlWithLinkedObjects(
-    const QString& masterPath, QStringList* warnings = nullptr);
+    const QString& masterPath, QStringList* warnings = nullptr,
+    LinkedObjectLoading loading = LinkedObjectLoading::Eager);
+
+/**
+ * @brief Loads a single linked object file, e.g. to materialize a
+ * placeholder object.
+ *
+ * The links inside the file are relative to @p baseDir. They are expanded
+ * according to @p loading (see loadProjectXmlWithLinkedObjects).
+ *
+ * @param filePath Path of the linked object file
+ * @param baseDir  Base directory of the links
+ * @param warnings Optional output list for warning messages
+ * @param loading  Whether nested linked files are loaded eagerly or on demand.
+ * @return The <object> element of the linked file or a null element, if the
+ *         file could not be read.
+ */
+GT_DATAMODEL_EXPORT QDomElement loadLinkedObjectXml(
+    const QString& filePath, const QDir& baseDir,
+    QStringList* warnings = nullptr,
+    LinkedObjectLoading loading = LinkedObjectLoading::OnDemand);
+
+/**
+ * @brief Reads the objects of a project XML file (e.g. a module file)
+ * directly into object mementos using a pull parser.
+ *
+ * In contrast to loadProjectXmlWithLinkedObjects no DOM document is built,
+ * thus the memory needed for reading large files is mostly determined by the
+ * resulting mementos. The <objectref> elements are resolved the same way
+ * (see loadProjectXmlWithLinkedObjects). Linked files loaded eagerly are
+ * read sequentially.
+ *
+ * The resulting mementos are identical to the mementos of the
+ * <object> and <objectref> elements below the root element of the document
+ * returned by loadProjectXmlWithLinkedObjects.
+ *
+ * @param masterPath     Path of the XML file
+ * @param objects        Output of the mementos of the objects below the root
+ *                       element
+ * @param rootTag        Optional output of the tag name of the root element
+ * @param rootAttributes Optional output of the attributes of the root element
+ * @param warnings       Optional output list for warning messages
+ * @param loading        Whether linked files are loaded eagerly or on demand.
+ * @return False, if the file could not be read or parsed
+ */
+GT_DATAMODEL_EXPORT bool readMementosWithLinkedObjects(
+    const QString& masterPath,
+    QVector<GtObjectMemento>& objects,
+    QString* rootTag = nullptr,
+    QHash<QString, QString>* rootAttributes = nullptr,
+    QStringList* warnings = nullptr,
+    LinkedObjectLoading loading = LinkedObjectLoading::Eager);
+
+/**
+ * @brief Reads a single linked object file directly into an object memento
+ * using a pull parser. Streaming counterpart of loadLinkedObjectXml.
+ *
+ * @param filePath Path of the linked object file
+ * @param baseDir  Base directory of the links
+ * @param warnings Optional output list for warning messages
+ * @param loading  Whether nested linked files are loaded eagerly or on demand.
+ * @return The memento of the linked object or a null memento, if the file
+ *         could not be read.
+ */
+GT_DATAMODEL_EXPORT GtObjectMemento loadLinkedObjectMemento(
+    const QString& filePath, const QDir& baseDir,
+    QStringList* warnings = nullptr,
+    LinkedObjectLoading loading = LinkedObjectLoading::OnDemand);
 
 /**
  * @brief removeProperty
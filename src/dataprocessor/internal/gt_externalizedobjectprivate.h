@@ -14,6 +14,10 @@
 #include "gt_boolproperty.h"
 #include "gt_stringproperty.h"
 #include "gt_variantproperty.h"
+#include "gt_externalizeddataselection.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace gt
 {
@@ -30,7 +34,10 @@ enum ExternalizeState
     ExternalizeOnSave = 2,
     /// inidatces that data should not be externalized indirectly
     /// (ref count reaches 0)
-    KeepInternalized = 8
+    KeepInternalized = 8,
+    /// indicates that modified data was evicted into the scratch data of
+    /// the session and has to be fetched from there
+    Evicted = 16
 };
 Q_DECLARE_FLAGS(ExternalizeStates, ExternalizeState)
 
@@ -85,6 +92,35 @@ struct GtExternalizedObjectPrivate
     /// keeps track of number of accesses
     int refCount{0};
 
+    /// Accesses of a selection of the data
+    struct SelectionRef
+    {
+        GtExternalizedDataSelection selection;
+        /// number of accesses
+        int refCount{0};
+        /// whether the data was fetched successfully
+        bool fetched{false};
+        /// whether the selection uses the entirely fetched data
+        bool entire{false};
+    };
+
+    /// fetched selections
+    std::vector<SelectionRef> selections;
+
+    /**
+     * @brief Finds the accesses of the selection
+     * @param selection Selection
+     * @return iterator, end if the selection is not fetched
+     */
+    inline std::vector<SelectionRef>::iterator
+    findSelection(GtExternalizedDataSelection const& selection)
+    {
+        return std::find_if(selections.begin(), selections.end(),
+                            [&selection](SelectionRef const& ref){
+            return ref.selection == selection;
+        });
+    }
+
     /// object states
     ExternalizeStates states{ ExternalizeState::ExternalizeOnSave };
 
@@ -0,0 +1,152 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_fasthash.h"
+
+#include <QtEndian>
+
+#include <cstring>
+
+namespace
+{
+
+constexpr quint64 c1 = Q_UINT64_C(0x87c37b91114253d5);
+constexpr quint64 c2 = Q_UINT64_C(0x4cf5ad432745937f);
+
+inline quint64
+rotl(quint64 x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline quint64
+fmix(quint64 k)
+{
+    k ^= k >> 33;
+    k *= Q_UINT64_C(0xff51afd7ed558ccd);
+    k ^= k >> 33;
+    k *= Q_UINT64_C(0xc4ceb9fe1a85ec53);
+    k ^= k >> 33;
+    return k;
+}
+
+} // namespace
+
+namespace gt
+{
+    namespace detail
+    {
+
+        FastHash::FastHash(quint64 seed) : m_seed(seed)
+        {
+            reset();
+        }
+
+        void FastHash::reset()
+        {
+            m_h1 = m_seed;
+            m_h2 = m_seed;
+            m_length = 0;
+            m_tailSize = 0;
+        }
+
+        void FastHash::addData(const char* data, qint64 length)
+        {
+            if (!data || length <= 0) return;
+
+            auto const* bytes = reinterpret_cast<const uchar*>(data);
+            m_length += static_cast<quint64>(length);
+
+            // complete the pending block
+            if (m_tailSize > 0)
+            {
+                int const n = static_cast<int>(
+                    qMin<qint64>(16 - m_tailSize, length));
+                std::memcpy(m_tail + m_tailSize, bytes, n);
+                m_tailSize += n;
+                bytes += n;
+                length -= n;
+
+                if (m_tailSize < 16) return;
+
+                processBlock(m_tail);
+                m_tailSize = 0;
+            }
+
+            for (; length >= 16; bytes += 16, length -= 16)
+            {
+                processBlock(bytes);
+            }
+
+            std::memcpy(m_tail, bytes, static_cast<size_t>(length));
+            m_tailSize = static_cast<int>(length);
+        }
+
+        QByteArray FastHash::result() const
+        {
+            quint64 h1 = m_h1;
+            quint64 h2 = m_h2;
+
+            // process remaining bytes
+            quint64 k1 = 0;
+            quint64 k2 = 0;
+
+            for (int i = m_tailSize - 1; i >= 8; --i)
+            {
+                k2 ^= quint64(m_tail[i]) << ((i - 8) * 8);
+            }
+            if (m_tailSize > 8)
+            {
+                k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; h2 ^= k2;
+            }
+
+            for (int i = qMin(m_tailSize, 8) - 1; i >= 0; --i)
+            {
+                k1 ^= quint64(m_tail[i]) << (i * 8);
+            }
+            if (m_tailSize > 0)
+            {
+                k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; h1 ^= k1;
+            }
+
+            // finalization
+            h1 ^= m_length;
+            h2 ^= m_length;
+
+            h1 += h2;
+            h2 += h1;
+
+            h1 = fmix(h1);
+            h2 = fmix(h2);
+
+            h1 += h2;
+            h2 += h1;
+
+            QByteArray retval(16, Qt::Uninitialized);
+            qToLittleEndian(h1, retval.data());
+            qToLittleEndian(h2, retval.data() + 8);
+
+            return retval;
+        }
+
+        void FastHash::processBlock(const uchar* block)
+        {
+            quint64 k1 = qFromLittleEndian<quint64>(block);
+            quint64 k2 = qFromLittleEndian<quint64>(block + 8);
+
+            k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; m_h1 ^= k1;
+
+            m_h1 = rotl(m_h1, 27); m_h1 += m_h2;
+            m_h1 = m_h1 * 5 + 0x52dce729;
+
+            k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; m_h2 ^= k2;
+
+            m_h2 = rotl(m_h2, 31); m_h2 += m_h1;
+            m_h2 = m_h2 * 5 + 0x38495ab5;
+        }
+
+    } // namespace detail
+} // namespace gt
@@ -0,0 +1,76 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_FASTHASH_H
+#define GT_INTERNAL_FASTHASH_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QByteArray>
+#include <QtGlobal>
+
+namespace gt
+{
+    namespace detail
+    {
+
+        /**
+         * @brief Fast non-cryptographic 128 bit hash function (MurmurHash3,
+         * x64 variant) with an interface similar to QCryptographicHash.
+         *
+         * The hash is not suited for persisted hashes or security related
+         * purposes, it is meant for in-memory change detection only.
+         */
+        class FastHash
+        {
+        public:
+            GT_DATAMODEL_EXPORT explicit FastHash(quint64 seed = 0);
+
+            /**
+             * @brief Resets the object
+             */
+            GT_DATAMODEL_EXPORT void reset();
+
+            /**
+             * @brief Adds the first length bytes of data to the hash
+             * @param data Data
+             * @param length Number of bytes
+             */
+            GT_DATAMODEL_EXPORT void addData(const char* data,
+                                             qint64 length);
+
+            void addData(const QByteArray& data)
+            {
+                addData(data.constData(), data.size());
+            }
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+            void addData(QByteArrayView data)
+            {
+                addData(data.data(), data.size());
+            }
+#endif
+
+            /**
+             * @brief Returns the final hash value (16 bytes)
+             * @return Hash value
+             */
+            GT_DATAMODEL_EXPORT QByteArray result() const;
+
+        private:
+            quint64 m_seed;
+            quint64 m_h1, m_h2;
+            quint64 m_length;
+            uchar m_tail[16];
+            int m_tailSize;
+
+            void processBlock(const uchar* block);
+        };
+
+    } // namespace detail
+} // namespace gt
+
+#endif // GT_INTERNAL_FASTHASH_H
@@ -0,0 +1,602 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gt_mementobinaryformat.h"
+
+#include "gt_objectio.h"
+#include "gt_qtutilities.h"
+#include "gt_logging.h"
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QHash>
+#include <QPointF>
+#include <QtEndian>
+
+#include <cstring>
+#include <utility>
+
+using PD = GtObjectMemento::PropertyData;
+
+namespace
+{
+
+/// Magic bytes at the beginning of each binary memento
+constexpr char S_MAGIC[] = {'G', 'T', 'M', 'B'};
+
+/// Flags of the memento that are stored
+constexpr GtObjectMemento::Flag S_FLAGS[] = {
+    GtObjectMemento::SaveAsOwnFile,
+    GtObjectMemento::IsUnresolved,
+    GtObjectMemento::IsPlaceholder
+};
+
+/// Type tags of property values
+enum ValueTag : quint8
+{
+    InvalidValue = 0,
+    BoolValue,
+    IntValue,
+    LongLongValue,
+    DoubleValue,
+    StringValue,
+    StringListValue,
+    DoubleVectorValue,
+    IntListValue,
+    BoolListValue,
+    PointFValue,
+    PointFListValue,
+    /// Fallback: type name and string representation
+    GenericValue
+};
+
+void
+setupStream(QDataStream& stream)
+{
+    stream.setVersion(QDataStream::Qt_5_12);
+    stream.setByteOrder(QDataStream::LittleEndian);
+}
+
+class Writer
+{
+public:
+    explicit Writer(QByteArray& body) : m_buffer(&body), m_stream(&m_buffer)
+    {
+        m_buffer.open(QIODevice::WriteOnly);
+        setupStream(m_stream);
+    }
+
+    void writeMemento(const GtObjectMemento& memento)
+    {
+        qint32 flags = 0;
+        for (GtObjectMemento::Flag flag : S_FLAGS)
+        {
+            if (memento.isFlagEnabled(flag)) flags |= flag;
+        }
+
+        m_stream << intern(memento.className())
+                 << memento.uuid()
+                 << memento.ident()
+                 << flags;
+
+        if (memento.isFlagEnabled(GtObjectMemento::IsPlaceholder))
+        {
+            m_stream << memento.linkedFilePath()
+                     << memento.linkedFileBaseDir();
+        }
+
+        writeProperties(memento.properties);
+        writeProperties(memento.propertyContainers);
+
+        m_stream << static_cast<quint32>(memento.childObjects.size());
+        for (const GtObjectMemento& child : memento.childObjects)
+        {
+            writeMemento(child);
+        }
+    }
+
+    const QStringList& strings() const { return m_strings; }
+
+private:
+    QBuffer m_buffer;
+    QDataStream m_stream;
+
+    QHash<QString, quint32> m_stringIndices;
+    QStringList m_strings;
+
+    quint32 intern(const QString& str)
+    {
+        auto iter = m_stringIndices.find(str);
+        if (iter != m_stringIndices.end()) return *iter;
+
+        quint32 idx = static_cast<quint32>(m_strings.size());
+        m_stringIndices.insert(str, idx);
+        m_strings.append(str);
+        return idx;
+    }
+
+    void writeProperties(const QVector<PD>& properties)
+    {
+        m_stream << static_cast<quint32>(properties.size());
+        for (const PD& property : properties)
+        {
+            writeProperty(property);
+        }
+    }
+
+    void writeProperty(const PD& property)
+    {
+        m_stream << intern(property.name)
+                 << static_cast<quint8>(property.isActive)
+                 << static_cast<quint8>(property.type());
+
+        if (property.type() != PD::DATA_T)
+        {
+            m_stream << intern(property.dataType());
+        }
+
+        writeValue(property.data());
+        writeProperties(property.childProperties);
+    }
+
+    template <typename List>
+    void writeList(ValueTag tag, const List& list)
+    {
+        m_stream << static_cast<quint8>(tag)
+                 << static_cast<quint32>(list.size());
+        for (const auto& entry : list) m_stream << entry;
+    }
+
+    void writeValue(const QVariant& var)
+    {
+        static auto const type_QDoubleVector =
+            gt::metaTypeIdFromName("QVector<double>");
+        static auto const type_QDoubleList =
+            gt::metaTypeIdFromName("QList<double>");
+        static auto const type_QIntList =
+            gt::metaTypeIdFromName("QList<int>");
+        static auto const type_QBoolList =
+            gt::metaTypeIdFromName("QList<bool>");
+        static auto const type_QPointFList =
+            gt::metaTypeIdFromName("QList<QPointF>");
+
+        if (!var.isValid())
+        {
+            m_stream << static_cast<quint8>(InvalidValue);
+            return;
+        }
+
+        auto const type = gt::metaTypeId(var);
+
+        switch (type)
+        {
+        case QMetaType::Bool:
+            m_stream << static_cast<quint8>(BoolValue)
+                     << static_cast<quint8>(var.toBool());
+            return;
+        case QMetaType::Int:
+            m_stream << static_cast<quint8>(IntValue)
+                     << static_cast<qint32>(var.toInt());
+            return;
+        case QMetaType::LongLong:
+            m_stream << static_cast<quint8>(LongLongValue)
+                     << static_cast<qint64>(var.toLongLong());
+            return;
+        case QMetaType::Double:
+            m_stream << static_cast<quint8>(DoubleValue) << var.toDouble();
+            return;
+        case QMetaType::QString:
+            m_stream << static_cast<quint8>(StringValue) << var.toString();
+            return;
+        case QMetaType::QStringList:
+            m_stream << static_cast<quint8>(StringListValue)
+                     << var.toStringList();
+            return;
+        case QMetaType::QPointF:
+        {
+            QPointF const p = var.toPointF();
+            m_stream << static_cast<quint8>(PointFValue) << p.x() << p.y();
+            return;
+        }
+        default:
+            break;
+        }
+
+        if (type == type_QDoubleVector || type == type_QDoubleList)
+        {
+            // stored as QVector<double> like in the XML format
+            writeDoubleArray(var.value<QVector<double>>());
+        }
+        else if (type == type_QIntList)
+        {
+            writeList(IntListValue, var.value<QList<int>>());
+        }
+        else if (type == type_QBoolList)
+        {
+            writeList(BoolListValue, var.value<QList<bool>>());
+        }
+        else if (type == type_QPointFList)
+        {
+            auto const list = var.value<QList<QPointF>>();
+            m_stream << static_cast<quint8>(PointFListValue)
+                     << static_cast<quint32>(list.size());
+            for (const QPointF& p : list) m_stream << p.x() << p.y();
+        }
+        else
+        {
+            m_stream << static_cast<quint8>(GenericValue)
+                     << intern(QString::fromLatin1(var.typeName()))
+                     << GtObjectIO::variantToString(var);
+        }
+    }
+
+    void writeDoubleArray(const QVector<double>& values)
+    {
+        m_stream << static_cast<quint8>(DoubleVectorValue)
+                 << static_cast<quint32>(values.size());
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        m_stream.writeRawData(reinterpret_cast<const char*>(values.constData()),
+                              static_cast<int>(values.size() * sizeof(double)));
+#else
+        for (double v : values) m_stream << v;
+#endif
+    }
+};
+
+class Reader
+{
+public:
+    Reader(QDataStream& stream, QStringList strings) :
+        m_stream(stream), m_strings(std::move(strings))
+    { }
+
+    bool readMemento(GtObjectMemento& memento)
+    {
+        QString className, uuid, ident;
+        qint32 flags = 0;
+
+        if (!readString(className)) return false;
+        m_stream >> uuid >> ident >> flags;
+
+        memento.setClassName(className);
+        memento.setUuid(uuid);
+        memento.setIdent(ident);
+        for (GtObjectMemento::Flag flag : S_FLAGS)
+        {
+            memento.setFlagEnabled(flag, flags & flag);
+        }
+
+        if (memento.isFlagEnabled(GtObjectMemento::IsPlaceholder))
+        {
+            QString linkedFilePath, linkedFileBaseDir;
+            m_stream >> linkedFilePath >> linkedFileBaseDir;
+            memento.setLinkedFile(linkedFilePath, linkedFileBaseDir);
+        }
+
+        if (!readProperties(memento.properties) ||
+            !readProperties(memento.propertyContainers))
+        {
+            return false;
+        }
+
+        quint32 nChildren = 0;
+        m_stream >> nChildren;
+        if (!checkSize(nChildren)) return false;
+
+        memento.childObjects.resize(static_cast<int>(nChildren));
+        for (GtObjectMemento& child : memento.childObjects)
+        {
+            if (!readMemento(child)) return false;
+        }
+
+        return m_stream.status() == QDataStream::Ok;
+    }
+
+private:
+    QDataStream& m_stream;
+    QStringList m_strings;
+
+    /// Each entry requires at least one byte, thus the size must not exceed
+    /// the remaining bytes
+    bool checkSize(quint32 size) const
+    {
+        return m_stream.status() == QDataStream::Ok &&
+               size <= m_stream.device()->bytesAvailable();
+    }
+
+    bool readString(QString& str)
+    {
+        quint32 idx = 0;
+        m_stream >> idx;
+
+        if (m_stream.status() != QDataStream::Ok ||
+            idx >= static_cast<quint32>(m_strings.size()))
+        {
+            return false;
+        }
+
+        str = m_strings.at(static_cast<int>(idx));
+        return true;
+    }
+
+    bool readProperties(QVector<PD>& properties)
+    {
+        quint32 size = 0;
+        m_stream >> size;
+        if (!checkSize(size)) return false;
+
+        properties.resize(static_cast<int>(size));
+        for (PD& property : properties)
+        {
+            if (!readProperty(property)) return false;
+        }
+        return true;
+    }
+
+    bool readProperty(PD& property)
+    {
+        quint8 isActive = 1, type = PD::DATA_T;
+        QString dataType;
+
+        if (!readString(property.name)) return false;
+        m_stream >> isActive >> type;
+        property.isActive = isActive != 0;
+
+        if (type != PD::DATA_T && !readString(dataType)) return false;
+
+        QVariant value;
+        if (!readValue(value)) return false;
+
+        switch (type)
+        {
+        case PD::DATA_T:
+            property.setData(value);
+            break;
+        case PD::STRUCT_T:
+            property.toStruct(dataType);
+            break;
+        case PD::ENUM_T:
+            gt::detail::MementoBinaryFormat::setEnum(property, dataType, value);
+            break;
+        default:
+            return false;
+        }
+
+        return readProperties(property.childProperties);
+    }
+
+    template <typename T>
+    bool readList(QVariant& value)
+    {
+        quint32 size = 0;
+        m_stream >> size;
+        if (!checkSize(size)) return false;
+
+        T list;
+        list.reserve(static_cast<int>(size));
+        for (quint32 i = 0; i < size; ++i)
+        {
+            typename T::value_type entry{};
+            m_stream >> entry;
+            list.append(entry);
+        }
+        value.setValue(list);
+        return true;
+    }
+
+    bool readValue(QVariant& value)
+    {
+        quint8 tag = InvalidValue;
+        m_stream >> tag;
+
+        switch (tag)
+        {
+        case InvalidValue:
+            value = QVariant{};
+            break;
+        case BoolValue:
+        {
+            quint8 v = 0;
+            m_stream >> v;
+            value = QVariant(v != 0);
+            break;
+        }
+        case IntValue:
+        {
+            qint32 v = 0;
+            m_stream >> v;
+            value = QVariant(static_cast<int>(v));
+            break;
+        }
+        case LongLongValue:
+        {
+            qint64 v = 0;
+            m_stream >> v;
+            value = QVariant(static_cast<qlonglong>(v));
+            break;
+        }
+        case DoubleValue:
+        {
+            double v = 0.;
+            m_stream >> v;
+            value = QVariant(v);
+            break;
+        }
+        case StringValue:
+        {
+            QString v;
+            m_stream >> v;
+            value = QVariant(v);
+            break;
+        }
+        case StringListValue:
+        {
+            QStringList v;
+            m_stream >> v;
+            value = QVariant(v);
+            break;
+        }
+        case PointFValue:
+        {
+            double x = 0., y = 0.;
+            m_stream >> x >> y;
+            value = QVariant(QPointF(x, y));
+            break;
+        }
+        case DoubleVectorValue:
+            return readDoubleArray(value);
+        case IntListValue:
+            return readList<QList<int>>(value);
+        case BoolListValue:
+            return readList<QList<bool>>(value);
+        case PointFListValue:
+        {
+            quint32 size = 0;
+            m_stream >> size;
+            if (!checkSize(size)) return false;
+
+            QList<QPointF> list;
+            list.reserve(static_cast<int>(size));
+            for (quint32 i = 0; i < size; ++i)
+            {
+                double x = 0., y = 0.;
+                m_stream >> x >> y;
+                list.append(QPointF(x, y));
+            }
+            value.setValue(list);
+            break;
+        }
+        case GenericValue:
+        {
+            QString typeName, str;
+            if (!readString(typeName)) return false;
+            m_stream >> str;
+
+            // same conversion as used for the XML format
+            value = QVariant(str);
+            auto const type = gt::metaTypeIdFromName(
+                typeName.toLatin1().constData());
+            if (QMetaType::isRegistered(type)) value.convert(type);
+            break;
+        }
+        default:
+            return false;
+        }
+
+        return m_stream.status() == QDataStream::Ok;
+    }
+
+    bool readDoubleArray(QVariant& value)
+    {
+        quint32 size = 0;
+        m_stream >> size;
+        if (!checkSize(size)) return false;
+
+        QVector<double> values(static_cast<int>(size));
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        int const nBytes = static_cast<int>(size * sizeof(double));
+        if (m_stream.readRawData(reinterpret_cast<char*>(values.data()),
+                                 nBytes) != nBytes)
+        {
+            return false;
+        }
+#else
+        for (double& v : values) m_stream >> v;
+#endif
+
+        value.setValue(values);
+        return m_stream.status() == QDataStream::Ok;
+    }
+};
+
+} // namespace
+
+namespace gt
+{
+    namespace detail
+    {
+
+        bool MementoBinaryFormat::isBinary(const QByteArray& data)
+        {
+            return data.size() >= static_cast<int>(sizeof(S_MAGIC)) &&
+                   std::memcmp(data.constData(), S_MAGIC,
+                               sizeof(S_MAGIC)) == 0;
+        }
+
+        QByteArray MementoBinaryFormat::write(const GtObjectMemento& memento)
+        {
+            QByteArray body;
+            Writer writer(body);
+
+            if (!memento.isNull()) writer.writeMemento(memento);
+
+            QByteArray retval;
+            retval.reserve(body.size() + 64);
+
+            QBuffer buffer(&retval);
+            buffer.open(QIODevice::WriteOnly);
+
+            QDataStream stream(&buffer);
+            setupStream(stream);
+
+            stream.writeRawData(S_MAGIC, sizeof(S_MAGIC));
+            stream << version << writer.strings();
+            stream.writeRawData(body.constData(), body.size());
+
+            return retval;
+        }
+
+        GtObjectMemento MementoBinaryFormat::read(const QByteArray& data)
+        {
+            if (!isBinary(data)) return {};
+
+            QBuffer buffer;
+            buffer.setData(data);
+            buffer.open(QIODevice::ReadOnly);
+            buffer.seek(sizeof(S_MAGIC));
+
+            QDataStream stream(&buffer);
+            setupStream(stream);
+
+            quint16 dataVersion = 0;
+            stream >> dataVersion;
+
+            if (dataVersion > version)
+            {
+                gtError() << QObject::tr("Unsupported binary memento "
+                                         "version (%1)!").arg(dataVersion);
+                return {};
+            }
+
+            QStringList strings;
+            stream >> strings;
+
+            // empty memento
+            if (stream.status() == QDataStream::Ok && buffer.atEnd()) return {};
+
+            GtObjectMemento memento;
+            if (!Reader(stream, std::move(strings)).readMemento(memento))
+            {
+                gtError() << QObject::tr("Invalid binary memento data!");
+                return {};
+            }
+
+            return memento;
+        }
+
+        void MementoBinaryFormat::setEnum(PD& property,
+                                          const QString& typeName,
+                                          const QVariant& value)
+        {
+            property._type = PD::ENUM_T;
+            property._dataType = typeName;
+            property._data = value;
+        }
+
+    } // namespace detail
+} // namespace gt
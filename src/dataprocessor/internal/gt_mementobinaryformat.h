@@ -0,0 +1,76 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_MEMENTOBINARYFORMAT_H
+#define GT_INTERNAL_MEMENTOBINARYFORMAT_H
+
+#include "gt_objectmemento.h"
+
+#include <QByteArray>
+
+namespace gt
+{
+    namespace detail
+    {
+
+        /**
+         * @brief Compact binary encoding of object mementos.
+         *
+         * Layout (little endian):
+         *  - magic "GTMB" and format version (quint16)
+         *  - table of interned strings (class names, property names and
+         *    type names)
+         *  - memento tree: class name index, uuid, ident, flags, properties,
+         *    property containers and child objects
+         *
+         * Property values are stored typed. Numeric lists are stored as raw
+         * arrays. Values of other types are stored as type name and string
+         * representation, like in the XML format.
+         */
+        class MementoBinaryFormat
+        {
+        public:
+            /// Current version of the format
+            static constexpr quint16 version = 1;
+
+            /**
+             * @brief Returns whether the data contains a binary memento
+             * @param data Data
+             * @return Is binary memento
+             */
+            static bool isBinary(const QByteArray& data);
+
+            /**
+             * @brief Encodes the memento
+             * @param memento Memento
+             * @return Binary data
+             */
+            static QByteArray write(const GtObjectMemento& memento);
+
+            /**
+             * @brief Decodes a binary memento. Returns a null memento if the
+             * data is invalid or if the format version is not supported.
+             * @param data Binary data
+             * @return Memento
+             */
+            static GtObjectMemento read(const QByteArray& data);
+
+            /**
+             * @brief Turns the property into an enum property. Used when
+             * reading binary mementos.
+             * @param property Property
+             * @param typeName Type name of the enum
+             * @param value Enum key
+             */
+            static void setEnum(GtObjectMemento::PropertyData& property,
+                                const QString& typeName,
+                                const QVariant& value);
+        };
+
+    } // namespace detail
+} // namespace gt
+
+#endif // GT_INTERNAL_MEMENTOBINARYFORMAT_H
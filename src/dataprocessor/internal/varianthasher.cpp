@@ -23,6 +23,19 @@ namespace gt
 
         void VariantHasher::addToHash(QCryptographicHash& hash,
                                       const QVariant& variant)
+        {
+            addToHashImpl(hash, variant);
+        }
+
+        void VariantHasher::addToHash(FastHash& hash,
+                                      const QVariant& variant)
+        {
+            addToHashImpl(hash, variant);
+        }
+
+        template <typename Hash>
+        void VariantHasher::addToHashImpl(Hash& hash,
+                                          const QVariant& variant)
         {
             auto varType = gt::metaTypeId(variant);
 
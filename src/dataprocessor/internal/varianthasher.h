@@ -10,6 +10,7 @@
 #define GT_INTERNAL_VARIANTHASHER_H
 
 #include "gt_datamodel_exports.h"
+#include "gt_fasthash.h"
 
 #include <QCryptographicHash>
 #include <QBuffer>
@@ -30,8 +31,13 @@ namespace gt
             GT_DATAMODEL_EXPORT VariantHasher();
             GT_DATAMODEL_EXPORT void addToHash(QCryptographicHash& hash,
                                                const QVariant& variant);
+            GT_DATAMODEL_EXPORT void addToHash(FastHash& hash,
+                                               const QVariant& variant);
 
         private:
+            template <typename Hash>
+            void addToHashImpl(Hash& hash, const QVariant& variant);
+
             QByteArray bb;
             QBuffer buff;
             QDataStream ds;
@@ -89,6 +89,9 @@ GtExportMenu::onActionTrigger(QObject* obj)
         return;
     }
 
+    // exporters need the complete object data
+    m_obj->materializeAll();
+
     // clone object data
     GtObject* objCopy = m_obj->clone();
 
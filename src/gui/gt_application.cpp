@@ -505,7 +505,8 @@ GtApplication::startCommand(GtObject* root, const QString& commandId)
         return GtCommand();
     }
 
-    m_d->m_commandMemento = GtObjectMemento(root);
+    // snapshots share the data of unchanged subtrees with previous snapshots
+    m_d->m_commandMemento = root->snapshot();
     m_d->m_commandRoot = root;
     m_d->m_commandId = commandId;
     m_d->m_commandUuid = QUuid::createUuid().toString();
@@ -547,7 +548,7 @@ GtApplication::endCommand(const GtCommand& command)
         return;
     }
 
-    GtObjectMemento newMemento = m_d->m_commandRoot->toMemento();
+    GtObjectMemento newMemento = m_d->m_commandRoot->snapshot();
 
     GtObjectMementoDiff diff(m_d->m_commandMemento, newMemento);
 
@@ -224,6 +224,7 @@ GtProcessRunnerTransceiver::setTargetAddress(
     }
 
     m_connection->setTargetAddress(std::move(data));
+    m_connection->setMementoFormat(GtObjectMemento::Format::Xml);
     m_autostart = autostart;
 
     // clear localhost flag
@@ -580,7 +581,7 @@ GtProcessRunnerTransceiver::sendCommand(Session* session, Command& command)
         setConnectionState(Transmitting);
 
         // async call
-        m_connection->writeData(loop, command.toMemento().toByteArray());
+        m_connection->writeData(loop, m_connection->serialize(command));
 
         auto res = loop.exec();
 
@@ -800,6 +801,11 @@ GtProcessRunnerTransceiver::startProcessRunner(GtTask& task)
                 << tr("Error:") << process.errorString();
         return false;
     }
+
+    // the process runner was started from the same installation, thus the
+    // binary memento format is supported
+    m_connection->setMementoFormat(GtObjectMemento::Format::Binary);
+
     return true;
 }
 
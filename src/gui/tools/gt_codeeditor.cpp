@@ -16,6 +16,7 @@
 #include "gt_guiutilities.h"
 #include "gt_linenumberarea.h"
 #include "gt_colors.h"
+#include "gt_objectmemento.h"
 
 GtCodeEditor::GtCodeEditor(QWidget* parent) : QPlainTextEdit(parent)
 {
@@ -122,7 +123,16 @@ GtCodeEditor::dropEvent(QDropEvent* event)
     if (event->mimeData()->formats().contains("GtObject"))
     {
         clear();
-        setPlainText(event->mimeData()->data("GtObject"));
+
+        QByteArray data = event->mimeData()->data("GtObject");
+
+        // show the XML representation of binary mementos
+        if (GtObjectMemento::isBinary(data))
+        {
+            data = GtObjectMemento(data).toByteArray();
+        }
+
+        setPlainText(data);
     }
 
     QPlainTextEdit::dropEvent(event);
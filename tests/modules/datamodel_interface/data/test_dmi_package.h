@@ -30,6 +30,12 @@ public:
       */
     Q_INVOKABLE TestDmiPackage();
 
+    /**
+     * @brief The module file is read directly into object mementos
+     * @return true
+     */
+    bool supportsMementoData() const override;
+
 private:
     GtObjectLinkProperty m_link;
 
@@ -0,0 +1,209 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/test_gt_processtestclasses.h"
+
+#include "gt_abstractrunnable.h"
+#include "gt_boolproperty.h"
+#include "gt_intproperty.h"
+#include "gt_monitoringdataset.h"
+#include "gt_objectfactory.h"
+#include "gt_parameterloop.h"
+
+#include <QDir>
+
+namespace
+{
+
+class LoopTestRunnable : public GtAbstractRunnable
+{
+public:
+    void run() override { }
+
+    QDir tempDir() override { return {}; }
+
+    bool clearTempDir(const QString&) override { return true; }
+
+    QString projectPath() override { return {}; }
+
+    void addLinkedObject(GtObject* object)
+    {
+        m_linkedObjects.append(object);
+    }
+};
+
+template <typename T>
+void
+registerClass()
+{
+    if (!gtObjectFactory->knownClass(T::staticMetaObject.className()))
+    {
+        gtObjectFactory->registerClass(T::staticMetaObject);
+    }
+}
+
+} // namespace
+
+class TestGtParameterLoop : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        registerClass<GtParameterLoop>();
+        registerClass<TestGtSampleCalculator>();
+        registerClass<TestGtDataObject>();
+
+        target = new TestGtDataObject;
+        target->setObjectName("Target");
+        runnable.addLinkedObject(target);
+
+        loop.setFactory(gtObjectFactory);
+        loop.setParent(&runnable);
+        setProperty("start", 0.0);
+        setProperty("end", 4.0);
+        setProperty<GtIntProperty>("steps", 4);
+
+        calc = new TestGtSampleCalculator;
+        calc->target.setVal(target->uuid());
+        loop.appendChild(calc);
+
+        QObject::connect(&loop, &GtTask::monitoringDataTransfer,
+                         [this](int iteration, GtMonitoringDataSet set) {
+            iterations.append(iteration);
+            values.append(set.getData(loop.uuid()).getData("currentVal")
+                              .toDouble());
+        });
+    }
+
+    template <typename Property = GtDoubleProperty, typename T>
+    void setProperty(const QString& ident, T value)
+    {
+        auto* prop = qobject_cast<Property*>(loop.findProperty(ident));
+        ASSERT_TRUE(prop);
+        prop->setVal(value);
+    }
+
+    /// names of the objects recorded in the target
+    QStringList samples() const
+    {
+        QStringList names;
+        for (auto const* obj : target->findDirectChildren<TestGtDataObject*>())
+        {
+            names << obj->objectName();
+        }
+        names.sort();
+        return names;
+    }
+
+    LoopTestRunnable runnable;
+    TestGtDataObject* target{};
+
+    GtParameterLoop loop;
+    TestGtSampleCalculator* calc{};
+
+    QList<int> iterations;
+    QList<double> values;
+};
+
+TEST_F(TestGtParameterLoop, sequentialSamples)
+{
+    ASSERT_TRUE(loop.exec());
+
+    EXPECT_EQ(iterations, (QList<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(values, (QList<double>{1, 2, 3, 4, 4}));
+    EXPECT_EQ(loop.currentIterationStep(), 5);
+
+    EXPECT_EQ(samples(), (QStringList{"sample_0", "sample_1", "sample_2",
+                                      "sample_3", "sample_4"}));
+    EXPECT_DOUBLE_EQ(target->value.getVal(), 4.0);
+}
+
+TEST_F(TestGtParameterLoop, parallelSamples)
+{
+    setProperty<GtIntProperty>("parallelSamples", 2);
+
+    ASSERT_TRUE(loop.exec());
+
+    // monitoring data is transferred in sample order
+    EXPECT_EQ(iterations, (QList<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(values, (QList<double>{1, 2, 3, 4, 4}));
+    EXPECT_EQ(loop.currentIterationStep(), 5);
+    EXPECT_EQ(loop.currentState(), GtProcessComponent::FINISHED);
+
+    // the results of all samples are merged in sample order
+    EXPECT_EQ(samples(), (QStringList{"sample_0", "sample_1", "sample_2",
+                                      "sample_3", "sample_4"}));
+    EXPECT_DOUBLE_EQ(target->value.getVal(), 4.0);
+    EXPECT_EQ(calc->currentState(), GtProcessComponent::FINISHED);
+}
+
+TEST_F(TestGtParameterLoop, parallelSampleFails)
+{
+    setProperty<GtIntProperty>("parallelSamples", 3);
+
+    calc->warnAt.setVal(1.0);
+    auto* failOnWarn =
+        qobject_cast<GtBoolProperty*>(calc->findProperty("failOnWarn"));
+    ASSERT_TRUE(failOnWarn);
+    failOnWarn->setVal(true);
+
+    EXPECT_FALSE(loop.exec());
+    EXPECT_EQ(loop.currentState(), GtProcessComponent::FAILED);
+    EXPECT_EQ(calc->currentState(), GtProcessComponent::FAILED);
+
+    // only the samples before the failed one are monitored
+    EXPECT_EQ(iterations, QList<int>{1});
+    EXPECT_EQ(loop.currentIterationStep(), 2);
+
+    // the data of the failed sample is kept, later samples are dropped
+    EXPECT_EQ(samples(), (QStringList{"sample_0", "sample_1"}));
+    EXPECT_DOUBLE_EQ(target->value.getVal(), 1.0);
+}
+
+TEST_F(TestGtParameterLoop, parallelSamplesShareObjects)
+{
+    registerClass<TestGtCollectingCalculator>();
+
+    setProperty<GtIntProperty>("parallelSamples", 3);
+
+    auto* obsolete = new TestGtDataObject;
+    obsolete->setObjectName("Obsolete");
+    target->appendChild(obsolete);
+
+    auto* collector = new TestGtCollectingCalculator;
+    collector->target.setVal(target->uuid());
+    loop.appendChild(collector);
+
+    ASSERT_TRUE(loop.exec());
+    EXPECT_EQ(loop.currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(collector->currentState(), GtProcessComponent::FINISHED);
+
+    // each sample removed the object, it is removed once
+    EXPECT_EQ(target->findDirectChild<TestGtDataObject*>("Obsolete"), nullptr);
+
+    // the object created by the first sample of a batch is shared by the
+    // other samples
+    QList<TestGtDataObject*> results;
+    for (auto* obj : target->findDirectChildren<TestGtDataObject*>())
+    {
+        if (obj->objectName() == "Results") results.append(obj);
+    }
+    ASSERT_EQ(results.size(), 1);
+
+    QStringList names;
+    for (auto const* obj : results.first()->findDirectChildren<
+                               TestGtDataObject*>())
+    {
+        names << obj->objectName();
+    }
+    names.sort();
+
+    EXPECT_EQ(names, (QStringList{"sample_0", "sample_1", "sample_2",
+                                  "sample_3", "sample_4"}));
+    EXPECT_DOUBLE_EQ(results.first()->value.getVal(), 4.0);
+}
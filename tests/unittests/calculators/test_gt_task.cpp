@@ -160,6 +160,18 @@ protected:
             gtObjectFactory->registerClass(WarningCalculator::staticMetaObject);
         }
 
+        if (!gtObjectFactory->knownClass(GT_CLASSNAME(TestGtDataObject)))
+        {
+            gtObjectFactory->registerClass(TestGtDataObject::staticMetaObject);
+        }
+
+        if (!gtObjectFactory->knownClass(
+                GT_CLASSNAME(TestGtWritingCalculator)))
+        {
+            gtObjectFactory->registerClass(
+                TestGtWritingCalculator::staticMetaObject);
+        }
+
         if (!gtObjectFactory->knownClass(GT_CLASSNAME(GtPropertyConnection)))
         {
             gtObjectFactory->registerClass(
@@ -399,3 +411,101 @@ TEST_F(TestGtTask, monitoringDataCanBeStoredAndCleared)
 
     EXPECT_EQ(task.monitoringDataSize(), 0);
 }
+
+TEST_F(TestGtTask, parallelExecutionIsDisabledByDefault)
+{
+    TestableGtTask task;
+
+    EXPECT_FALSE(task.parallelExecution());
+
+    task.setParallelExecution(true);
+
+    EXPECT_TRUE(task.parallelExecution());
+}
+
+TEST_F(TestGtTask, runChildElementsInParallelFailsWithoutRunnable)
+{
+    TestableGtTask task;
+    TestTaskProcessComponent child1;
+    TestTaskProcessComponent child2;
+
+    ASSERT_TRUE(task.appendChild(&child1));
+    ASSERT_TRUE(task.appendChild(&child2));
+    task.setParallelExecution(true);
+
+    EXPECT_FALSE(task.runChildElements());
+    EXPECT_EQ(child1.execCalls, 0);
+    EXPECT_EQ(child2.execCalls, 0);
+    EXPECT_EQ(task.currentState(), GtProcessComponent::FAILED);
+}
+
+TEST_F(TestGtTask, runChildElementsInParallelMergesIndependentResults)
+{
+    TestTaskRunnable runnable;
+
+    auto* objA = new TestGtDataObject;
+    objA->setObjectName("A");
+    auto* objB = new TestGtDataObject;
+    objB->setObjectName("B");
+    runnable.addLinkedObject(objA);
+    runnable.addLinkedObject(objB);
+
+    TestableGtTask task;
+    task.setParallelExecution(true);
+    task.setRunnable(&runnable);
+
+    TestGtWritingCalculator calc1;
+    calc1.setFactory(gtObjectFactory);
+    calc1.target.setVal(objA->uuid());
+    calc1.digit.setVal(1);
+
+    TestGtWritingCalculator calc2;
+    calc2.setFactory(gtObjectFactory);
+    calc2.target.setVal(objB->uuid());
+    calc2.digit.setVal(2);
+
+    ASSERT_TRUE(task.appendChild(&calc1));
+    ASSERT_TRUE(task.appendChild(&calc2));
+
+    ASSERT_TRUE(task.runChildElements());
+
+    // the results of both copies are merged back
+    EXPECT_DOUBLE_EQ(objA->value.getVal(), 1.0);
+    EXPECT_DOUBLE_EQ(objB->value.getVal(), 2.0);
+    EXPECT_EQ(calc1.currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(calc2.currentState(), GtProcessComponent::FINISHED);
+}
+
+TEST_F(TestGtTask, runChildElementsInParallelSerializesConflicts)
+{
+    TestTaskRunnable runnable;
+
+    auto* obj = new TestGtDataObject;
+    obj->setObjectName("A");
+    runnable.addLinkedObject(obj);
+
+    TestableGtTask task;
+    task.setParallelExecution(true);
+    task.setRunnable(&runnable);
+
+    QList<TestGtWritingCalculator*> calcs;
+    for (int i = 1; i <= 3; ++i)
+    {
+        auto* calc = new TestGtWritingCalculator;
+        calc->setFactory(gtObjectFactory);
+        calc->target.setVal(obj->uuid());
+        calc->digit.setVal(i);
+        ASSERT_TRUE(task.appendChild(calc));
+        calcs.append(calc);
+    }
+
+    ASSERT_TRUE(task.runChildElements());
+
+    // each calculator sees the result of its predecessor
+    EXPECT_DOUBLE_EQ(obj->value.getVal(), 123.0);
+
+    for (auto const* calc : qAsConst(calcs))
+    {
+        EXPECT_EQ(calc->currentState(), GtProcessComponent::FINISHED);
+    }
+}
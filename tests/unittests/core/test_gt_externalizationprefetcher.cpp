@@ -0,0 +1,157 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "datamodel/test_externalizedobject.h"
+#include "gt_externalizationmanager.h"
+#include "internal/gt_externalizationprefetcher.h"
+
+#include <memory>
+#include <vector>
+
+class TestGtExternalizationPrefetcher : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        gtExternalizationManager->enableExternalization(true);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            objects.push_back(std::make_unique<TestExternalizedObject>());
+            list.append(objects.back().get());
+
+            auto data = objects.back()->fetchData();
+            data.setValues({double(i)});
+        }
+
+        ASSERT_TRUE(gtExternalizationManager->externalize(list));
+    }
+
+    /// steps accessing the objects 0, 1, 0 and 2, 3
+    QList<QList<GtExternalizedObject*>> steps() const
+    {
+        return {{list[0]}, {list[1]}, {list[0], list[2]}, {list[3]}};
+    }
+
+    std::vector<std::unique_ptr<TestExternalizedObject>> objects;
+    QList<GtExternalizedObject*> list;
+};
+
+TEST_F(TestGtExternalizationPrefetcher, prefetchWindow)
+{
+    GtExternalizationPrefetcher prefetcher(steps(), 2);
+
+    prefetcher.beginStep(0);
+    prefetcher.wait();
+
+    // objects of the current step are not prefetched
+    EXPECT_FALSE(objects[0]->isFetched());
+    EXPECT_TRUE(objects[1]->isFetched());
+    EXPECT_TRUE(objects[2]->isFetched());
+    // outside of the window
+    EXPECT_FALSE(objects[3]->isFetched());
+
+    EXPECT_EQ(objects[1]->internalValues(), QVector<double>{1.0});
+    EXPECT_EQ(objects[2]->internalValues(), QVector<double>{2.0});
+
+    // the data was read in the background and fetched in this thread
+    EXPECT_EQ(objects[1]->bufferFetchCount(), 1);
+    EXPECT_EQ(objects[2]->bufferFetchCount(), 1);
+
+    { // the step fetches its data by itself
+        auto data = objects[0]->fetchData();
+        EXPECT_EQ(data.values(), QVector<double>{0.0});
+        EXPECT_EQ(objects[0]->bufferFetchCount(), 0);
+    }
+    prefetcher.endStep(0);
+
+    prefetcher.beginStep(1);
+    prefetcher.wait();
+    EXPECT_TRUE(objects[3]->isFetched());
+
+    { // prefetched data is retained
+        auto data = objects[1]->fetchData();
+        EXPECT_EQ(data.values(), QVector<double>{1.0});
+        EXPECT_EQ(objects[1]->refCount(), 2);
+    }
+    prefetcher.endStep(1);
+
+    // data is released after the step
+    EXPECT_FALSE(objects[1]->isFetched());
+    EXPECT_EQ(objects[1]->refCount(), 0);
+
+    prefetcher.beginStep(2);
+    prefetcher.endStep(2);
+    EXPECT_FALSE(objects[2]->isFetched());
+    EXPECT_TRUE(objects[3]->isFetched());
+
+    prefetcher.beginStep(3);
+    prefetcher.endStep(3);
+
+    for (auto const& o : objects)
+    {
+        EXPECT_FALSE(o->isFetched());
+        EXPECT_EQ(o->refCount(), 0);
+    }
+}
+
+TEST_F(TestGtExternalizationPrefetcher, releaseOnDestruction)
+{
+    {
+        GtExternalizationPrefetcher prefetcher(steps(), 3);
+        prefetcher.beginStep(0);
+        // aborted before the next step
+    }
+
+    for (auto const& o : objects)
+    {
+        EXPECT_FALSE(o->isFetched());
+        EXPECT_EQ(o->refCount(), 0);
+    }
+
+    {
+        GtExternalizationPrefetcher prefetcher(steps(), 0);
+        prefetcher.beginStep(0);
+        prefetcher.wait();
+
+        // prefetching is disabled
+        for (auto const& o : objects)
+        {
+            EXPECT_FALSE(o->isFetched());
+        }
+    }
+}
+
+TEST_F(TestGtExternalizationPrefetcher, deletedObjects)
+{
+    GtExternalizationPrefetcher prefetcher(steps(), 2);
+
+    prefetcher.beginStep(0);
+    prefetcher.endStep(0);
+
+    // objects may be deleted by the previous steps
+    objects[3].reset();
+
+    prefetcher.beginStep(1);
+    prefetcher.wait();
+    EXPECT_TRUE(objects[2]->isFetched());
+    prefetcher.endStep(1);
+
+    prefetcher.beginStep(2);
+    prefetcher.endStep(2);
+
+    prefetcher.beginStep(3);
+    prefetcher.endStep(3);
+
+    for (auto const& o : objects)
+    {
+        if (!o) continue;
+        EXPECT_FALSE(o->isFetched());
+        EXPECT_EQ(o->refCount(), 0);
+    }
+}
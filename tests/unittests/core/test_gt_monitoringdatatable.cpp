@@ -0,0 +1,317 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include <gtest/gtest.h>
+
+#include "gt_monitoringdatatable.h"
+
+#include <QTemporaryDir>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+GtMonitoringDataSet
+makeDataSet(const QString& uuid, const QMap<QString, QVariant>& values)
+{
+    GtMonitoringData data;
+    for (auto iter = values.begin(); iter != values.end(); ++iter)
+    {
+        data.addData(iter.key(), iter.value());
+    }
+
+    GtMonitoringDataSet set;
+    set.insert(uuid, data);
+    return set;
+}
+
+} // namespace
+
+TEST(TestGtMonitoringDataTable, appendAndGetData)
+{
+    GtMonitoringDataTable table;
+
+    EXPECT_FALSE(table.append(0, {}));
+
+    ASSERT_TRUE(table.append(1, makeDataSet("comp", {{"res", 1.5},
+                                                     {"name", "a"}})));
+    // iteration 2 is missing
+    ASSERT_TRUE(table.append(3, makeDataSet("comp", {{"res", 0.5},
+                                                     {"iter", 3}})));
+    EXPECT_FALSE(table.append(3, {}));
+
+    EXPECT_EQ(table.size(), 3);
+
+    EXPECT_EQ(table.getData("comp", "res"),
+              (QVector<QVariant>{1.5, QVariant(), 0.5}));
+    EXPECT_EQ(table.getData("comp", "name"),
+              (QVector<QVariant>{"a", QVariant(), QVariant()}));
+    EXPECT_EQ(table.getData("comp", "iter"),
+              (QVector<QVariant>{QVariant(), QVariant(), 3}));
+    EXPECT_EQ(table.getData("other", "res"),
+              (QVector<QVariant>{QVariant(), QVariant(), QVariant()}));
+
+    EXPECT_EQ(table.valueType("comp", "res"),
+              GtMonitoringDataTable::ValueType::Double);
+    EXPECT_EQ(table.valueType("comp", "name"),
+              GtMonitoringDataTable::ValueType::String);
+    EXPECT_EQ(table.valueType("comp", "iter"),
+              GtMonitoringDataTable::ValueType::Int);
+    // the values of other components are read separately
+    QVector<int> other = table.intData("other", "val");
+    ASSERT_EQ(other.size(), 40);
+    EXPECT_EQ(other.first(), -1);
+    EXPECT_EQ(other.last(), -40);
+
+    EXPECT_EQ(table.valueType("comp", "unknown"),
+              GtMonitoringDataTable::ValueType::Invalid);
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0);
+    EXPECT_TRUE(table.getData("comp", "res").isEmpty());
+}
+
+TEST(TestGtMonitoringDataTable, typedData)
+{
+    GtMonitoringDataTable table;
+    table.append(1, makeDataSet("comp", {{"res", 1.0}, {"iter", 1}}));
+    table.append(2, makeDataSet("comp", {{"iter", 2}}));
+
+    QVector<double> res = table.doubleData("comp", "res");
+    ASSERT_EQ(res.size(), 2);
+    EXPECT_DOUBLE_EQ(res[0], 1.0);
+    EXPECT_TRUE(std::isnan(res[1]));
+
+    EXPECT_EQ(table.intData("comp", "iter"), (QVector<int>{1, 2}));
+    EXPECT_EQ(table.doubleData("comp", "iter"), (QVector<double>{1.0, 2.0}));
+    EXPECT_EQ(table.stringData("comp", "iter"),
+              (QVector<QString>{"1", "2"}));
+
+    EXPECT_TRUE(table.doubleData("comp", "unknown").isEmpty());
+}
+
+TEST(TestGtMonitoringDataTable, mixedTypes)
+{
+    GtMonitoringDataTable table;
+    table.append(1, makeDataSet("comp", {{"val", 1}}));
+    table.append(2, makeDataSet("comp", {{"val", 2.5}}));
+    table.append(3, makeDataSet("comp", {{"val", "x"}}));
+
+    EXPECT_EQ(table.valueType("comp", "val"),
+              GtMonitoringDataTable::ValueType::Variant);
+
+    // the original values are kept
+    EXPECT_EQ(table.getData("comp", "val"),
+              (QVector<QVariant>{1, 2.5, "x"}));
+
+    QVector<double> values = table.doubleData("comp", "val");
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_DOUBLE_EQ(values[0], 1.0);
+    EXPECT_DOUBLE_EQ(values[1], 2.5);
+    EXPECT_TRUE(std::isnan(values[2]));
+}
+
+TEST(TestGtMonitoringDataTable, downsampledData)
+{
+    GtMonitoringDataTable table;
+
+    constexpr int n = 100000;
+    for (int i = 1; i <= n; ++i)
+    {
+        double val = i == 5000 ? 100.0 : 1.0 / i;
+        table.append(i, makeDataSet("comp", {{"res", val}}));
+    }
+
+    EXPECT_EQ(table.doubleData("comp", "res").size(), n);
+
+    QVector<QPointF> points = table.downsampledData("comp", "res", 1000);
+    ASSERT_LE(points.size(), 1000);
+    ASSERT_GE(points.size(), 500);
+
+    // the peak is kept
+    auto peak = std::find_if(points.begin(), points.end(),
+                             [](const QPointF& p) { return p.y() == 100.0; });
+    ASSERT_NE(peak, points.end());
+    EXPECT_EQ(peak->x(), 5000.0);
+
+    EXPECT_TRUE(std::is_sorted(points.begin(), points.end(),
+                               [](const QPointF& a, const QPointF& b) {
+        return a.x() < b.x();
+    }));
+
+    // all points are returned for short series
+    EXPECT_EQ(table.downsampledData("comp", "res", n).size(), n);
+}
+
+TEST(TestGtMonitoringDataTable, historyFile)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    QString const filePath = dir.filePath("history.gtmon");
+
+    GtMonitoringDataTable table;
+    ASSERT_TRUE(table.setHistoryFile(filePath, 10));
+    EXPECT_EQ(table.historyFile(), filePath);
+
+    constexpr int n = 95;
+    for (int i = 1; i <= n; ++i)
+    {
+        // iteration 50 is missing
+        if (i == 50) continue;
+
+        QMap<QString, QVariant> values{{"res", 1.0 / i}, {"iter", i}};
+        if (i % 2 == 0) values.insert("even", QString::number(i));
+
+        ASSERT_TRUE(table.append(i, makeDataSet("comp", values)));
+    }
+
+    EXPECT_EQ(table.size(), n);
+
+    auto check = [](GtMonitoringDataTable& table) {
+        QVector<double> res = table.doubleData("comp", "res");
+        ASSERT_EQ(res.size(), n);
+        for (int i = 1; i <= n; ++i)
+        {
+            if (i == 50) EXPECT_TRUE(std::isnan(res[i - 1]));
+            else EXPECT_DOUBLE_EQ(res[i - 1], 1.0 / i);
+        }
+
+        QVector<int> iter = table.intData("comp", "iter");
+        ASSERT_EQ(iter.size(), n);
+        EXPECT_EQ(iter[0], 1);
+        EXPECT_EQ(iter[n - 1], n);
+
+        QVector<QVariant> even = table.getData("comp", "even");
+        ASSERT_EQ(even.size(), n);
+        EXPECT_EQ(even[0], QVariant());
+        EXPECT_EQ(even[1], QVariant("2"));
+        EXPECT_EQ(even[93], QVariant("94"));
+
+        EXPECT_EQ(table.valueType("comp", "iter"),
+                  GtMonitoringDataTable::ValueType::Int);
+        EXPECT_TRUE(table.doubleData("comp", "unknown").isEmpty());
+    };
+
+    check(table);
+
+    // read back lazily
+    GtMonitoringDataTable history;
+    ASSERT_TRUE(history.openHistoryFile(filePath));
+    EXPECT_EQ(history.size(), n);
+    check(history);
+    EXPECT_FALSE(history.append(n + 1, makeDataSet("comp", {{"res", 0.}})));
+
+    // clearing truncates the file
+    table.clear();
+    EXPECT_EQ(table.size(), 0);
+    ASSERT_TRUE(table.append(1, makeDataSet("comp", {{"res", 2.0}})));
+
+    ASSERT_TRUE(history.openHistoryFile(filePath));
+    EXPECT_EQ(history.size(), 1);
+    EXPECT_EQ(history.doubleData("comp", "res"), QVector<double>{2.0});
+
+    EXPECT_FALSE(history.openHistoryFile(dir.filePath("missing.gtmon")));
+}
+
+TEST(TestGtMonitoringDataTable, historyFileCache)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    GtMonitoringDataTable table;
+    ASSERT_TRUE(table.setHistoryFile(dir.filePath("history.gtmon"), 5));
+
+    // the type of the series changes after the values were written to the
+    // file
+    auto append = [&table](int first, int last) {
+        for (int i = first; i <= last; ++i)
+        {
+            QVariant value = i <= 20 ? QVariant(i) : QVariant(i + 0.5);
+            GtMonitoringDataSet set = makeDataSet("comp", {{"val", value}});
+
+            GtMonitoringData other;
+            other.addData("val", -i);
+            set.insert("other", other);
+
+            ASSERT_TRUE(table.append(i, set));
+        }
+    };
+
+    append(1, 20);
+    EXPECT_EQ(table.valueType("comp", "val"),
+              GtMonitoringDataTable::ValueType::Int);
+    EXPECT_EQ(table.intData("comp", "val").size(), 20);
+
+    // the cached values are extended by the iterations trimmed meanwhile
+    append(21, 40);
+    EXPECT_EQ(table.valueType("comp", "val"),
+              GtMonitoringDataTable::ValueType::Variant);
+
+    QVector<double> values = table.doubleData("comp", "val");
+    ASSERT_EQ(values.size(), 40);
+    for (int i = 1; i <= 40; ++i)
+    {
+        EXPECT_DOUBLE_EQ(values[i - 1], i <= 20 ? i : i + 0.5);
+    }
+
+    // the values of other components are read separately
+    QVector<int> other = table.intData("other", "val");
+    ASSERT_EQ(other.size(), 40);
+    EXPECT_EQ(other.first(), -1);
+    EXPECT_EQ(other.last(), -40);
+
+    EXPECT_EQ(table.valueType("comp", "unknown"),
+              GtMonitoringDataTable::ValueType::Invalid);
+}
+
+TEST(TestGtMonitoringDataTable, historyFileCopies)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    QString const filePath = dir.filePath("history.gtmon");
+
+    GtMonitoringDataTable table;
+    ASSERT_TRUE(table.setHistoryFile(filePath, 5));
+
+    for (int i = 1; i <= 30; ++i)
+    {
+        ASSERT_TRUE(table.append(i, makeDataSet("comp", {{"res", 1.0 * i}})));
+    }
+
+    GtMonitoringDataTable copy = table;
+    EXPECT_EQ(copy.historyFile(), filePath);
+    ASSERT_EQ(copy.doubleData("comp", "res"), table.doubleData("comp", "res"));
+
+    // copies cannot write to the file
+    EXPECT_FALSE(copy.append(31, makeDataSet("comp", {{"res", 31.0}})));
+
+    // clearing a copy does not truncate the file
+    copy.clear();
+    EXPECT_EQ(copy.size(), 0);
+    EXPECT_TRUE(copy.historyFile().isEmpty());
+
+    ASSERT_TRUE(table.append(31, makeDataSet("comp", {{"res", 31.0}})));
+    QVector<double> res = table.doubleData("comp", "res");
+    ASSERT_EQ(res.size(), 31);
+    for (int i = 1; i <= 31; ++i)
+    {
+        EXPECT_DOUBLE_EQ(res[i - 1], i);
+    }
+
+    // the values only stored in the file are lost in copies, once the
+    // original table is cleared
+    copy = table;
+    table.clear();
+    ASSERT_TRUE(table.append(1, makeDataSet("comp", {{"res", -1.0}})));
+    ASSERT_TRUE(table.append(2, makeDataSet("comp", {{"res", -2.0}})));
+
+    res = copy.doubleData("comp", "res");
+    ASSERT_EQ(res.size(), 31);
+    EXPECT_TRUE(std::isnan(res.first()));
+    EXPECT_DOUBLE_EQ(res.last(), 31.0);
+}
@@ -13,7 +13,9 @@
 
 #include "gt_calculator.h"
 #include "gt_loop.h"
+#include "gt_task.h"
 #include "gt_doubleproperty.h"
+#include "gt_objectlinkproperty.h"
 #include "gt_relativeobjectlinkproperty.h"
 #include "gt_propertystructcontainer.h"
 #include "gt_structproperty.h"
@@ -166,4 +168,134 @@ private:
     GtPropertyStructContainer monitoringVars{"monitoringVars"};
 };
 
+class TestGtDataObject : public GtObject
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE TestGtDataObject()
+    {
+        registerProperty(value);
+    }
+
+    GtDoubleProperty value{"value", "Value"};
+};
+
+/// Calculator appending a digit to the value of its target object
+class TestGtWritingCalculator : public GtCalculator
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE TestGtWritingCalculator()
+    {
+        registerProperty(target);
+        registerProperty(digit);
+    }
+
+    bool run() override
+    {
+        auto* obj = data<TestGtDataObject*>(target);
+
+        if (!obj) return false;
+
+        obj->value.setVal(obj->value.getVal() * 10 + digit.getVal());
+        return true;
+    }
+
+    GtObjectLinkProperty target{"target", "Target", "Target", this,
+                                {GT_CLASSNAME(TestGtDataObject)}};
+
+    GtDoubleProperty digit{"digit", "Digit"};
+};
+
+/// Calculator recording the current value of its parent loop in its target
+/// object. Finishes with a warning for the value `warnAt`.
+class TestGtSampleCalculator : public GtCalculator
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE TestGtSampleCalculator()
+    {
+        registerProperty(target);
+        registerProperty(warnAt);
+
+        warnAt.setVal(-1.0);
+    }
+
+    bool run() override
+    {
+        auto* obj = data<TestGtDataObject*>(target);
+        auto* loop = findParent<GtTask*>();
+        auto* current = loop ? loop->findProperty("currentVal") : nullptr;
+
+        if (!obj || !current) return false;
+
+        double const val = current->valueToVariant().toDouble();
+
+        auto* sample = new TestGtDataObject;
+        sample->setObjectName(QStringLiteral("sample_%1").arg(val));
+        sample->value.setVal(val);
+        obj->appendChild(sample);
+        obj->value.setVal(val);
+
+        if (val == warnAt.getVal()) setState(WARN_FINISHED);
+
+        return true;
+    }
+
+    GtObjectLinkProperty target{"target", "Target", "Target", this,
+                                {GT_CLASSNAME(TestGtDataObject)}};
+
+    GtDoubleProperty warnAt{"warnAt", "Warn At"};
+};
+
+/// Calculator collecting the current value of its parent loop in the child
+/// "Results" of its target object, which is created if it does not exist.
+/// Removes the child "Obsolete" of the target object.
+class TestGtCollectingCalculator : public GtCalculator
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE TestGtCollectingCalculator()
+    {
+        registerProperty(target);
+    }
+
+    bool run() override
+    {
+        auto* obj = data<TestGtDataObject*>(target);
+        auto* loop = findParent<GtTask*>();
+        auto* current = loop ? loop->findProperty("currentVal") : nullptr;
+
+        if (!obj || !current) return false;
+
+        double const val = current->valueToVariant().toDouble();
+
+        auto* results = obj->findDirectChild<TestGtDataObject*>("Results");
+
+        if (!results)
+        {
+            results = new TestGtDataObject;
+            results->setObjectName(QStringLiteral("Results"));
+            obj->appendChild(results);
+        }
+
+        auto* sample = new TestGtDataObject;
+        sample->setObjectName(QStringLiteral("sample_%1").arg(val));
+        sample->value.setVal(val);
+        results->appendChild(sample);
+        results->value.setVal(val);
+
+        delete obj->findDirectChild<TestGtDataObject*>("Obsolete");
+
+        return true;
+    }
+
+    GtObjectLinkProperty target{"target", "Target", "Target", this,
+                                {GT_CLASSNAME(TestGtDataObject)}};
+};
+
 #endif // TEST_GT_PROCESSDOCK_H
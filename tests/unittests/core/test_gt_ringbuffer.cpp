@@ -0,0 +1,140 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "internal/gt_mpscqueue.h"
+#include "internal/gt_ringbuffer.h"
+
+#include <thread>
+#include <vector>
+
+using gt::detail::MpscQueue;
+using gt::detail::RingBuffer;
+
+namespace
+{
+
+std::vector<int>
+toVector(const RingBuffer<int>& buffer)
+{
+    std::vector<int> values;
+    for (int i = 0; i < buffer.size(); ++i)
+    {
+        values.push_back(buffer.at(i));
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(TestGtRingBuffer, pushDropsOldest)
+{
+    RingBuffer<int> buffer(3);
+    EXPECT_TRUE(buffer.empty());
+
+    EXPECT_FALSE(buffer.push_back(1));
+    EXPECT_FALSE(buffer.push_back(2));
+    EXPECT_FALSE(buffer.push_back(3));
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{1, 2, 3}));
+
+    EXPECT_TRUE(buffer.push_back(4));
+    EXPECT_TRUE(buffer.push_back(5));
+    EXPECT_EQ(buffer.size(), 3);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{3, 4, 5}));
+}
+
+TEST(TestGtRingBuffer, popAndRemove)
+{
+    RingBuffer<int> buffer(4);
+    for (int i = 1; i <= 6; ++i) buffer.push_back(i);
+
+    buffer.pop_front(1);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{4, 5, 6}));
+
+    buffer.removeAt(1);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{4, 6}));
+
+    buffer.push_back(7);
+    buffer.push_back(8);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{4, 6, 7, 8}));
+
+    buffer.pop_front(10);
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.push_back(9);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{9}));
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(TestGtRingBuffer, setCapacity)
+{
+    RingBuffer<int> buffer(4);
+    for (int i = 1; i <= 6; ++i) buffer.push_back(i);
+
+    buffer.setCapacity(2);
+    EXPECT_EQ(buffer.capacity(), 2);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{5, 6}));
+
+    buffer.setCapacity(5);
+    buffer.push_back(7);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{5, 6, 7}));
+}
+
+TEST(TestGtMpscQueue, consumeInOrder)
+{
+    MpscQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_FALSE(queue.push(2));
+    EXPECT_FALSE(queue.push(3));
+
+    std::vector<int> values;
+    EXPECT_EQ(queue.consumeAll([&](int v) { values.push_back(v); }), 3);
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+    EXPECT_TRUE(queue.empty());
+
+    // queue was drained
+    EXPECT_TRUE(queue.push(4));
+}
+
+TEST(TestGtMpscQueue, multipleProducers)
+{
+    constexpr int nThreads = 4;
+    constexpr int nValues = 10000;
+
+    MpscQueue<std::pair<int, int>> queue;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < nThreads; ++t)
+    {
+        producers.emplace_back([&queue, t]() {
+            for (int i = 0; i < nValues; ++i) queue.push({t, i});
+        });
+    }
+
+    std::vector<int> next(nThreads, 0);
+    int count = 0;
+    bool ordered = true;
+
+    auto consume = [&](std::pair<int, int>&& value) {
+        ordered &= (value.second == next[value.first]);
+        next[value.first] = value.second + 1;
+        ++count;
+    };
+
+    // consume concurrently to the producers
+    while (count < nThreads * nValues / 2) queue.consumeAll(consume);
+
+    for (auto& producer : producers) producer.join();
+    queue.consumeAll(consume);
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(count, nThreads * nValues);
+}
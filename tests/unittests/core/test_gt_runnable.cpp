@@ -0,0 +1,91 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ * Source File: test_gt_runnable.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_runnable.h"
+#include "gt_objectgroup.h"
+#include "gt_objectmemento.h"
+#include "gt_processcomponent.h"
+
+/// Process component appending a new child to the object with the given uuid
+class ModifyingComponent : public GtProcessComponent
+{
+public:
+    QString targetUuid;
+
+    bool exec() override
+    {
+        auto* runnable = findParent<GtAbstractRunnable*>();
+
+        if (!runnable) return false;
+
+        if (!targetUuid.isEmpty())
+        {
+            auto* target = runnable->data<GtObject*>(targetUuid);
+
+            if (!target) return false;
+
+            auto* child = new GtObjectGroup;
+            child->setObjectName("new");
+            target->appendChild(child);
+        }
+
+        setState(FINISHED);
+        return true;
+    }
+};
+
+class TestGtRunnable : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        package.setObjectName("package");
+        objA.setObjectName("A");
+        objB.setObjectName("B");
+
+        package.appendChild(&objA);
+        package.appendChild(&objB);
+    }
+
+    GtObjectGroup package;
+    GtObjectGroup objA;
+    GtObjectGroup objB;
+};
+
+TEST_F(TestGtRunnable, writesBackChangedSubtreesOnly)
+{
+    GtRunnable runnable;
+    runnable.setAutoDelete(false);
+    runnable.appendSourceData(package.toMemento());
+
+    auto* comp = new ModifyingComponent;
+    comp->targetUuid = objA.uuid();
+    ASSERT_TRUE(runnable.appendProcessComponent(comp));
+
+    runnable.run();
+
+    ASSERT_TRUE(runnable.successful());
+    ASSERT_EQ(runnable.outputData().size(), 1);
+    EXPECT_EQ(runnable.outputData().front().uuid(), objA.uuid());
+    EXPECT_EQ(runnable.outputData().front().childObjects.size(), 1);
+}
+
+TEST_F(TestGtRunnable, writesBackNothingWithoutChanges)
+{
+    GtRunnable runnable;
+    runnable.setAutoDelete(false);
+    runnable.appendSourceData(package.toMemento());
+
+    ASSERT_TRUE(runnable.appendProcessComponent(new ModifyingComponent));
+
+    runnable.run();
+
+    ASSERT_TRUE(runnable.successful());
+    EXPECT_TRUE(runnable.outputData().isEmpty());
+}
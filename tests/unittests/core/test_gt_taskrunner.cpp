@@ -14,6 +14,7 @@
 #include "gt_abstractrunnable.h"
 #include "gt_labeldata.h"
 #include "gt_objectfactory.h"
+#include "gt_objectlinkproperty.h"
 #include "gt_processdata.h"
 #include "gt_task.h"
 #include "gt_taskrunner.h"
@@ -31,6 +32,16 @@ public:
         return m_queue.size();
     }
 
+    GtObjectMemento sourceData(int idx = 0) const
+    {
+        return m_inputData.value(idx);
+    }
+
+    QStringList partialSubtrees(const QString& uuid) const
+    {
+        return m_partialInputData.value(uuid);
+    }
+
     GtProcessComponent* queuedComponent(int idx = 0) const
     {
         return m_queue.value(idx, nullptr);
@@ -66,6 +77,27 @@ public:
     }
 };
 
+class FullSourceTask : public GtTask
+{
+public:
+    FullSourceTask()
+    {
+        setRequiresFullSourceData(true);
+    }
+};
+
+class LinkingTask : public GtTask
+{
+public:
+    LinkingTask() :
+        linkProp("link", "Link", "Link", this, {GT_CLASSNAME(GtObject)})
+    {
+        registerProperty(linkProp);
+    }
+
+    GtObjectLinkProperty linkProp;
+};
+
 class TestGtTaskRunner : public ::testing::Test
 {
 protected:
@@ -110,7 +142,8 @@ TEST_F(TestGtTaskRunner, setUpCopiesSourceAndQueuesClonedTask)
 
     ASSERT_TRUE(runner.setUp(runnable.get(), &source));
 
-    EXPECT_EQ(runnable->sourceDataCount(), 1);
+    // the task does not reference any source objects
+    EXPECT_EQ(runnable->sourceDataCount(), 0);
     EXPECT_EQ(runnable->queueSize(), 1);
 
     auto* queuedTask = qobject_cast<GtTask*>(runnable->queuedComponent());
@@ -126,7 +159,9 @@ TEST_F(TestGtTaskRunner, setUpCopiesSourceAndQueuesClonedTask)
 TEST_F(TestGtTaskRunner, setUpSkipsProcessAndLabelDataFromSourceCopy)
 {
     auto runnable = std::make_unique<TestTaskRunnerRunnable>();
-    GtTaskRunner runner(&task);
+    FullSourceTask fullTask;
+    fullTask.setFactory(gtObjectFactory);
+    GtTaskRunner runner(&fullTask);
     auto processData = std::make_unique<GtProcessData>();
     auto labelData = std::make_unique<GtLabelData>();
 
@@ -140,6 +175,58 @@ TEST_F(TestGtTaskRunner, setUpSkipsProcessAndLabelDataFromSourceCopy)
     EXPECT_EQ(runnable->sourceDataCount(), 1);
 }
 
+TEST_F(TestGtTaskRunner, setUpCopiesOnlyReferencedSubtrees)
+{
+    auto runnable = std::make_unique<TestTaskRunnerRunnable>();
+    LinkingTask linkingTask;
+    linkingTask.setFactory(gtObjectFactory);
+    GtTaskRunner runner(&linkingTask);
+    GtObject linked;
+    GtObject unrelated;
+    GtObject otherPackage;
+
+    sourceChild.setObjectName("package");
+    linked.setObjectName("linked");
+    unrelated.setObjectName("unrelated");
+
+    ASSERT_TRUE(sourceChild.appendChild(&linked));
+    ASSERT_TRUE(sourceChild.appendChild(&unrelated));
+    ASSERT_TRUE(source.appendChild(&otherPackage));
+
+    linkingTask.linkProp.setVal(linked.uuid());
+
+    ASSERT_TRUE(runner.setUp(runnable.get(), &source));
+
+    // only the package containing the linked object is transferred
+    ASSERT_EQ(runnable->sourceDataCount(), 1);
+
+    GtObjectMemento const data = runnable->sourceData();
+    EXPECT_EQ(data.uuid(), sourceChild.uuid());
+    EXPECT_EQ(data.ident(), sourceChild.objectName());
+    EXPECT_TRUE(data.properties.isEmpty());
+    ASSERT_EQ(data.childObjects.size(), 1);
+    EXPECT_EQ(data.childObjects.front().uuid(), linked.uuid());
+
+    EXPECT_EQ(runnable->partialSubtrees(sourceChild.uuid()),
+              QStringList{linked.uuid()});
+}
+
+TEST_F(TestGtTaskRunner, setUpCopiesReferencedPackagesCompletely)
+{
+    auto runnable = std::make_unique<TestTaskRunnerRunnable>();
+    LinkingTask linkingTask;
+    linkingTask.setFactory(gtObjectFactory);
+    GtTaskRunner runner(&linkingTask);
+
+    linkingTask.linkProp.setVal(sourceChild.uuid());
+
+    ASSERT_TRUE(runner.setUp(runnable.get(), &source));
+
+    ASSERT_EQ(runnable->sourceDataCount(), 1);
+    EXPECT_EQ(runnable->sourceData().uuid(), sourceChild.uuid());
+    EXPECT_TRUE(runnable->partialSubtrees(sourceChild.uuid()).isEmpty());
+}
+
 TEST_F(TestGtTaskRunner, runReturnsWhenRunnableIsMissing)
 {
     GtTaskRunner runner(&task);
@@ -0,0 +1,201 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include <gtest/gtest.h>
+
+#include "gt_treefiltermodel.h"
+#include "gt_objectgroup.h"
+#include "gt_objectmodel.h"
+
+namespace
+{
+
+/// Object model notifying about changes of the object tree
+class TestObjectModel : public GtObjectModel
+{
+public:
+    using GtObjectModel::GtObjectModel;
+
+    GtObject* append(GtObject* parent, const QString& name)
+    {
+        auto* child = new GtObjectGroup;
+        child->setObjectName(name);
+
+        int const row = parent->directChildCount();
+        beginInsertRows(indexFromObject(parent), row, row);
+        parent->appendChild(child);
+        endInsertRows();
+
+        return child;
+    }
+
+    void remove(GtObject* obj)
+    {
+        int const row = obj->childNumber();
+        beginRemoveRows(indexFromObject(obj->parentObject()), row, row);
+        delete obj;
+        endRemoveRows();
+    }
+
+    void rename(GtObject* obj, const QString& name)
+    {
+        obj->setObjectName(name);
+        QModelIndex index = indexFromObject(obj);
+        emit dataChanged(index, index);
+    }
+};
+
+GtObject*
+appendChild(GtObject* parent, const QString& name)
+{
+    auto* child = new GtObjectGroup;
+    child->setObjectName(name);
+    parent->appendChild(child);
+    return child;
+}
+
+/// Returns the names of all visible rows in depth-first order
+QStringList
+visibleRows(const QAbstractItemModel& model, const QModelIndex& parent = {})
+{
+    QStringList names;
+    for (int row = 0; row < model.rowCount(parent); ++row)
+    {
+        QModelIndex index = model.index(row, 0, parent);
+        names << index.data().toString();
+        names << visibleRows(model, index);
+    }
+    return names;
+}
+
+} // namespace
+
+class TestGtTreeFilterModel : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        root.setObjectName("root");
+
+        GtObject* alpha = appendChild(&root, "alpha");
+        appendChild(alpha, "alphaChild");
+        appendChild(alpha, "beta");
+
+        GtObject* gamma = appendChild(&root, "gamma");
+        appendChild(gamma, "delta");
+
+        model.setRootObject(&root);
+        filterModel.setSourceModel(&model);
+    }
+
+    GtObjectGroup root;
+
+    TestObjectModel model;
+
+    GtTreeFilterModel filterModel;
+};
+
+TEST_F(TestGtTreeFilterModel, acceptsMatchesAndAncestors)
+{
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "alphaChild", "beta",
+                           "gamma", "delta"}));
+
+    filterModel.filterData("BET");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "beta"}));
+
+    filterModel.filterData("a$");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "beta", "gamma", "delta"}));
+
+    filterModel.filterData("nothing");
+    EXPECT_TRUE(visibleRows(filterModel).isEmpty());
+
+    filterModel.filterData("");
+    EXPECT_EQ(visibleRows(filterModel).size(), 6);
+}
+
+TEST_F(TestGtTreeFilterModel, extendAndShortenPattern)
+{
+    filterModel.filterData("a");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "alphaChild", "beta",
+                           "gamma", "delta"}));
+
+    // only previous matches are tested
+    filterModel.filterData("al");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "alphaChild"}));
+
+    filterModel.filterData("alphac");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "alphaChild"}));
+
+    // all rows are tested again
+    filterModel.filterData("l");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "alphaChild", "gamma", "delta"}));
+}
+
+TEST_F(TestGtTreeFilterModel, updatesIndexOnChanges)
+{
+    filterModel.filterData("eps");
+    EXPECT_TRUE(visibleRows(filterModel).isEmpty());
+
+    GtObject* gamma = root.findDirectChild<GtObject*>("gamma");
+    ASSERT_TRUE(gamma);
+
+    // new rows are indexed
+    GtObject* epsilon = model.append(gamma, "epsilon");
+    filterModel.filterData("eps");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "gamma", "epsilon"}));
+
+    // renamed rows are matched again
+    model.rename(epsilon, "zeta");
+    filterModel.filterData("eps");
+    EXPECT_TRUE(visibleRows(filterModel).isEmpty());
+
+    model.rename(gamma, "epsgamma");
+    filterModel.filterData("eps");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "epsgamma"}));
+
+    // removed rows do not count anymore
+    model.rename(epsilon, "epsilon");
+    model.remove(gamma);
+    filterModel.filterData("eps");
+    EXPECT_TRUE(visibleRows(filterModel).isEmpty());
+
+    filterModel.filterData("beta");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "alpha", "beta"}));
+}
+
+TEST_F(TestGtTreeFilterModel, manyRows)
+{
+    GtObject* group = appendChild(&root, "group");
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        appendChild(group, QStringLiteral("obj_%1").arg(i));
+    }
+
+    model.setRootObject(&root);
+
+    filterModel.filterData("obj_1999");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "group", "obj_1999",
+                           "obj_19990", "obj_19991", "obj_19992",
+                           "obj_19993", "obj_19994", "obj_19995",
+                           "obj_19996", "obj_19997", "obj_19998",
+                           "obj_19999"}));
+
+    filterModel.filterData("obj_19999");
+    EXPECT_EQ(visibleRows(filterModel),
+              (QStringList{"root", "group", "obj_19999"}));
+}
@@ -9,10 +9,15 @@
 #include <gtest/gtest.h>
 
 #include "gt_xmlutilities.h"
+#include "gt_objectmemento.h"
 
 #include <gt_logging.h>
 
 #include <QTemporaryDir>
+#include <QElapsedTimer>
+
+#include <functional>
+#include <iostream>
 
 // --------------------------------------------------------
 // Helper for writing files in tests
@@ -377,3 +382,319 @@ TEST_F(LoadXmlWithLinkedObjectsTest, RecursiveHierarchicalObjectPathExpansion)
     EXPECT_EQ(mProp.attribute("name"), QStringLiteral("x"));
     EXPECT_EQ(mProp.text(), QStringLiteral("1.0"));
 }
+
+// --------------------------------------------------------
+// 6) Several linked objects:
+//    The linked files are parsed concurrently, yet the objects must be
+//    inlined at the position of their objectref and the warnings of
+//    missing files must be reported in document order.
+// --------------------------------------------------------
+TEST_F(LoadXmlWithLinkedObjectsTest, MultipleLinkedObjects_KeepOrder)
+{
+    const int n = 8;
+
+    QByteArray masterXml = "<Root>\n";
+    for (int i = 0; i < n; ++i)
+    {
+        masterXml += QStringLiteral(
+            "  <objectref class=\"Foo\" name=\"A%1\" uuid=\"{%1}\" "
+            "href=\"master/A%1.gtobj.xml\"/>\n").arg(i).toUtf8();
+    }
+    masterXml += "</Root>\n";
+
+    const QString masterPath = makePath("master.xml");
+    ASSERT_TRUE(writeTextFile(masterPath, masterXml));
+    QDir().mkpath(baseDir().filePath("master"));
+
+    // every third linked file is missing
+    for (int i = 0; i < n; ++i)
+    {
+        if (i % 3 == 1) continue;
+
+        const QByteArray extXml = QStringLiteral(
+            "<GTLABOBJECTFILE>\n"
+            "  <object class=\"Foo\" name=\"A%1\" uuid=\"{%1}\">\n"
+            "    <property name=\"x\">%1</property>\n"
+            "  </object>\n"
+            "</GTLABOBJECTFILE>\n").arg(i).toUtf8();
+
+        ASSERT_TRUE(writeTextFile(
+            baseDir().filePath(QStringLiteral("master/A%1.gtobj.xml").arg(i)),
+            extXml));
+    }
+
+    QStringList warnings;
+    QDomDocument doc =
+        gt::xml::loadProjectXmlWithLinkedObjects(masterPath, &warnings);
+
+    ASSERT_FALSE(doc.isNull());
+
+    QDomElement root = doc.documentElement();
+    ASSERT_FALSE(root.isNull());
+
+    QDomElement elem = root.firstChildElement();
+    for (int i = 0; i < n; ++i)
+    {
+        ASSERT_FALSE(elem.isNull());
+        EXPECT_EQ(elem.attribute("name"), QStringLiteral("A%1").arg(i));
+        EXPECT_EQ(elem.tagName(), i % 3 == 1 ? QStringLiteral("objectref")
+                                             : QStringLiteral("object"));
+        elem = elem.nextSiblingElement();
+    }
+    EXPECT_TRUE(elem.isNull());
+
+    // missing files A1, A4, A7 in document order
+    QStringList missing;
+    for (const QString& warning : qAsConst(warnings))
+    {
+        if (!warning.contains("does not exist")) continue;
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (warning.contains(QStringLiteral("A%1.gtobj.xml").arg(i)))
+            {
+                missing << QStringLiteral("A%1").arg(i);
+            }
+        }
+    }
+    EXPECT_EQ(missing, (QStringList{"A1", "A4", "A7"}));
+}
+
+namespace
+{
+    /// Returns the serialized mementos of the objects below the root element
+    QStringList domMementos(const QDomDocument& doc)
+    {
+        QStringList result;
+        for (QDomElement e = doc.documentElement().firstChildElement();
+             !e.isNull(); e = e.nextSiblingElement())
+        {
+            if (e.tagName() != "object" && e.tagName() != "objectref")
+                continue;
+            result << GtObjectMemento(e).toByteArray();
+        }
+        return result;
+    }
+
+    QStringList serialized(const QVector<GtObjectMemento>& objects)
+    {
+        QStringList result;
+        for (const GtObjectMemento& memento : objects)
+        {
+            result << memento.toByteArray();
+        }
+        return result;
+    }
+} // namespace
+
+// --------------------------------------------------------
+// 7) Streaming reader:
+//    The mementos read directly from the files must equal the mementos
+//    of the elements of the expanded DOM document.
+// --------------------------------------------------------
+TEST_F(LoadXmlWithLinkedObjectsTest, StreamingReader_EqualsDomPath)
+{
+    const QByteArray masterXml = R"(
+<GTLABMODULE uuid="{module}">
+  <object class="Foo" name="A" uuid="{111}">
+    <property name="x" type="int">42</property>
+    <property name="empty" type="QString">   </property>
+    <property name="opt" type="double" active="false">1.5</property>
+    <propertylist name="values" type="double">1;2;3</propertylist>
+    <property-container name="vars">
+      <property name="entry" type="EnvironmentVarsStruct">
+        <property name="name" type="QString">PATH</property>
+        <property name="value" type="QString"><![CDATA[ ]]></property>
+      </property>
+    </property-container>
+    <objectlist>
+      <objectref class="Foo" name="B" uuid="{222}"
+                 href="master/B.gtobj.xml"/>
+      <objectref class="Foo" name="C" uuid="{333}"
+                 href="master/C.gtobj.xml" load="on-demand"/>
+      <objectref class="Foo" name="D" uuid="{444}"
+                 href="master/missing.gtobj.xml"/>
+      <unknown/>
+      <object class="Foo" name="E" uuid="{555}"/>
+    </objectlist>
+  </object>
+  <objectref class="Foo" name="F" uuid="{666}" href="master/F.gtobj.xml"
+             load="on-demand"/>
+</GTLABMODULE>
+)";
+
+    const QByteArray bXml = R"(
+<GTLABOBJECTFILE>
+  <object class="Foo" name="B" uuid="{222}">
+    <property name="text" type="QString">a &amp; b</property>
+    <objectlist>
+      <objectref class="Foo" name="G" uuid="{777}"
+                 href="master/G.gtobj.xml" load="on-demand"/>
+    </objectlist>
+  </object>
+</GTLABOBJECTFILE>
+)";
+
+    auto objectFile = [](const char* name, const char* uuid) {
+        return QStringLiteral(
+            "<GTLABOBJECTFILE>\n"
+            "  <object class=\"Foo\" name=\"%1\" uuid=\"%2\">\n"
+            "    <property name=\"x\" type=\"int\">1</property>\n"
+            "  </object>\n"
+            "</GTLABOBJECTFILE>\n").arg(name, uuid).toUtf8();
+    };
+
+    const QString masterPath = makePath("master.xml");
+    ASSERT_TRUE(writeTextFile(masterPath, masterXml));
+    QDir().mkpath(baseDir().filePath("master"));
+    ASSERT_TRUE(writeTextFile(baseDir().filePath("master/B.gtobj.xml"), bXml));
+    ASSERT_TRUE(writeTextFile(baseDir().filePath("master/C.gtobj.xml"),
+                              objectFile("C", "{333}")));
+    ASSERT_TRUE(writeTextFile(baseDir().filePath("master/F.gtobj.xml"),
+                              objectFile("F", "{666}")));
+    ASSERT_TRUE(writeTextFile(baseDir().filePath("master/G.gtobj.xml"),
+                              objectFile("G", "{777}")));
+
+    for (auto loading : {gt::xml::LinkedObjectLoading::Eager,
+                         gt::xml::LinkedObjectLoading::OnDemand})
+    {
+        QStringList domWarnings;
+        QDomDocument doc = gt::xml::loadProjectXmlWithLinkedObjects(
+            masterPath, &domWarnings, loading);
+        ASSERT_FALSE(doc.isNull());
+
+        QStringList warnings;
+        QVector<GtObjectMemento> objects;
+        QString rootTag;
+        QHash<QString, QString> rootAttributes;
+        ASSERT_TRUE(gt::xml::readMementosWithLinkedObjects(
+            masterPath, objects, &rootTag, &rootAttributes, &warnings,
+            loading));
+
+        EXPECT_EQ(rootTag, QStringLiteral("GTLABMODULE"));
+        EXPECT_EQ(rootAttributes.value("uuid"), QStringLiteral("{module}"));
+
+        ASSERT_EQ(objects.size(), 2);
+        EXPECT_EQ(serialized(objects), domMementos(doc));
+
+        // the missing file D is reported by both readers
+        domWarnings.sort();
+        warnings.sort();
+        EXPECT_EQ(warnings, domWarnings);
+        EXPECT_FALSE(warnings.isEmpty());
+    }
+}
+
+TEST_F(LoadXmlWithLinkedObjectsTest, StreamingReader_InvalidFile)
+{
+    const QString masterPath = makePath("master.xml");
+    ASSERT_TRUE(writeTextFile(masterPath, "<Root><object class=\"Foo\">"));
+
+    QStringList warnings;
+    QVector<GtObjectMemento> objects;
+    EXPECT_FALSE(gt::xml::readMementosWithLinkedObjects(masterPath, objects,
+                                                        nullptr, nullptr,
+                                                        &warnings));
+    EXPECT_TRUE(objects.isEmpty());
+    EXPECT_FALSE(warnings.isEmpty());
+}
+
+#ifdef Q_OS_LINUX
+namespace
+{
+    /// Resets the peak resident set size of the process
+    void resetPeakRss()
+    {
+        QFile f("/proc/self/clear_refs");
+        if (f.open(QIODevice::WriteOnly)) f.write("5");
+    }
+
+    /// Returns the peak resident set size of the process in kB
+    qint64 peakRssKb()
+    {
+        QFile f("/proc/self/status");
+        if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) return -1;
+
+        for (QByteArray line = f.readLine(); !line.isEmpty();
+             line = f.readLine())
+        {
+            if (line.startsWith("VmHWM:"))
+            {
+                return line.mid(6).trimmed().split(' ').first().toLongLong();
+            }
+        }
+        return -1;
+    }
+} // namespace
+#endif
+
+// --------------------------------------------------------
+// Benchmark of the streaming reader against the DOM reader. Run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+// --------------------------------------------------------
+TEST_F(LoadXmlWithLinkedObjectsTest, DISABLED_Benchmark_StreamingVsDom)
+{
+    const int nObjects = 20000;
+    const int nValues = 100;
+
+    const QString masterPath = makePath("module.xml");
+    {
+        QFile f(masterPath);
+        ASSERT_TRUE(f.open(QIODevice::WriteOnly | QIODevice::Text));
+
+        QStringList values;
+        for (int i = 0; i < nValues; ++i) values << QString::number(i * 0.5);
+        const QByteArray valueList = values.join(';').toUtf8();
+
+        f.write("<GTLABMODULE uuid=\"{module}\">\n");
+        for (int i = 0; i < nObjects; ++i)
+        {
+            f.write(QStringLiteral(
+                " <object class=\"Foo\" name=\"Obj%1\" uuid=\"{%1}\">\n"
+                "  <property name=\"x\" type=\"double\">%1.5</property>\n"
+                "  <property name=\"s\" type=\"QString\">text %1</property>\n")
+                    .arg(i).toUtf8());
+            f.write("  <propertylist name=\"v\" type=\"double\">" +
+                    valueList + "</propertylist>\n </object>\n");
+        }
+        f.write("</GTLABMODULE>\n");
+    }
+
+    QElapsedTimer timer;
+    auto measure = [&](const char* label, const std::function<int()>& read) {
+#ifdef Q_OS_LINUX
+        resetPeakRss();
+        const qint64 rssBefore = peakRssKb();
+#endif
+        timer.start();
+        const int n = read();
+        const qint64 ms = timer.elapsed();
+
+        EXPECT_EQ(n, nObjects);
+
+        QString msg = QStringLiteral("%1: %2 ms").arg(label).arg(ms);
+#ifdef Q_OS_LINUX
+        msg += QStringLiteral(", peak RSS +%1 kB")
+                   .arg(peakRssKb() - rssBefore);
+#endif
+        std::cout << msg.toStdString() << std::endl;
+    };
+
+    measure("Streaming", [&]() {
+        QVector<GtObjectMemento> objects;
+        gt::xml::readMementosWithLinkedObjects(masterPath, objects);
+        return objects.size();
+    });
+
+    measure("DOM", [&]() {
+        QDomDocument doc =
+            gt::xml::loadProjectXmlWithLinkedObjects(masterPath);
+        QVector<GtObjectMemento> objects;
+        for (QDomElement e = doc.documentElement().firstChildElement();
+             !e.isNull(); e = e.nextSiblingElement())
+        {
+            objects.push_back(GtObjectMemento(e));
+        }
+        return objects.size();
+    });
+}
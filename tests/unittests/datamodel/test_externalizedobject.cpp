@@ -17,12 +17,43 @@
 #include <QDir>
 #include <QDebug>
 
+namespace
+{
+
+/// Name of the file holding the data. Evicted data is written to scratch
+/// files, like the project files are not modified until saved
+QString
+dataFileName(const QString& uuid, const QString& suffix)
+{
+    QString const scratch = gtExternalizationManager->isScratchAccess() ?
+                                QStringLiteral("_scratch") : QString{};
+
+    return "test_ext" + uuid + scratch + "_" + suffix + ".txt";
+}
+
+} // namespace
+
 TestExternalizedObjectData::TestExternalizedObjectData(TestExternalizedObject* base) :
     GtExternalizedObjectData{base}
 {
 
 }
 
+TestExternalizedObjectData::TestExternalizedObjectData(
+        TestExternalizedObject* base,
+        GtExternalizedDataSelection selection) :
+    GtExternalizedObjectData{base, std::move(selection)}
+{
+
+}
+
+QVector<double>
+TestExternalizedObjectData::selectedValues() const
+{
+    assert(m_base);
+    return base()->selectedValues(m_selection);
+}
+
 const QVector<double>&
 TestExternalizedObjectData::values() const
 {
@@ -107,8 +138,7 @@ TestExternalizedObject::doFetchData(QVariant& /*metaData*/,
         }
 
         // read data
-        QFile file{projectDir.absoluteFilePath("test_ext" + uuid + "_" +
-                                               suffix + ".txt")};
+        QFile file{projectDir.absoluteFilePath(dataFileName(uuid, suffix))};
 
         if (!file.open(QFile::ReadOnly))
         {
@@ -149,6 +179,52 @@ TestExternalizedObject::doFetchData(QVariant& /*metaData*/,
     return success;
 }
 
+bool
+TestExternalizedObject::doReadData(const QVariant& /*metaData*/,
+                                   bool fetchInitialVersion,
+                                   QVariant& buffer) const
+{
+    // the initial version is not read from files
+    if (fetchInitialVersion) return false;
+
+    QDir projectDir{gtExternalizationManager->projectDir()};
+
+    QVariantList data;
+    for (QString suffix : {"values", "params"})
+    {
+        QFile file{projectDir.absoluteFilePath(dataFileName(uuid(), suffix))};
+        if (!file.open(QFile::ReadOnly)) return false;
+
+        data.append(file.readAll());
+    }
+
+    buffer = data;
+    return true;
+}
+
+bool
+TestExternalizedObject::doFetchBuffer(QVariant& /*metaData*/,
+                                      QVariant& buffer)
+{
+    QVariantList const data = buffer.toList();
+    if (data.size() != 2) return false;
+
+    m_values.clear();
+    for (auto sValue : data[0].toByteArray().split(';'))
+    {
+        m_values.append(sValue.toDouble());
+    }
+
+    m_params.clear();
+    for (auto p : data[1].toByteArray().split(';'))
+    {
+        m_params.append(p);
+    }
+
+    m_bufferFetchCount += 1;
+    return true;
+}
+
 bool
 TestExternalizedObject::doExternalizeData(QVariant& /*metaData*/)
 {
@@ -162,8 +238,7 @@ TestExternalizedObject::doExternalizeData(QVariant& /*metaData*/)
         }
 
         // read data
-        QFile file{projectDir.absoluteFilePath("test_ext" + uuid + "_" +
-                                               suffix + ".txt")};
+        QFile file{projectDir.absoluteFilePath(dataFileName(uuid, suffix))};
 
         if (!file.open(QFile::ReadWrite | QIODevice::Truncate))
         {
@@ -215,3 +290,99 @@ TestExternalizedObject::doClearExternalizedData()
     m_values.clear();
     m_params.clear();
 }
+
+namespace
+{
+
+/// selects the rows of the values
+QVector<double>
+selectRows(const QVector<double>& values,
+           const GtExternalizedDataSelection& selection)
+{
+    QVector<double> selected;
+    quint64 const end = selection.nRows() > 0 ?
+        selection.firstRow() + selection.nRows() * selection.stride() :
+        quint64(values.size());
+
+    for (quint64 row = selection.firstRow();
+         row < end && row < quint64(values.size());
+         row += selection.stride())
+    {
+        selected.append(values[int(row)]);
+    }
+    return selected;
+}
+
+} // namespace
+
+QVector<double>
+TestExternalizedObject::selectedValues(
+        const GtExternalizedDataSelection& selection) const
+{
+    for (auto const& entry : m_selections)
+    {
+        if (entry.first == selection) return entry.second;
+    }
+
+    return selectRows(m_values, selection);
+}
+
+qint64
+TestExternalizedObject::fetchedDataSize() const
+{
+    return m_values.size() * sizeof(double);
+}
+
+bool
+TestExternalizedObject::canFetchSelection() const
+{
+    return m_supportsSelection;
+}
+
+bool
+TestExternalizedObject::doFetchSelection(
+        QVariant& /*metaData*/,
+        const GtExternalizedDataSelection& selection,
+        bool fetchInitialVersion)
+{
+    m_selectionFetchCount += 1;
+
+    if (fetchInitialVersion)
+    {
+        m_selections.append({selection,
+                             selectRows(m_initialValues, selection)});
+        return true;
+    }
+
+    QDir projectDir{gtExternalizationManager->projectDir()};
+    QFile file{projectDir.absoluteFilePath(dataFileName(uuid(), "values"))};
+
+    if (!file.open(QFile::ReadOnly))
+    {
+        gtError() << "Failed to open file!";
+        return false;
+    }
+
+    QVector<double> values;
+    for (auto sValue : file.readAll().split(';'))
+    {
+        values.append(sValue.toDouble());
+    }
+
+    m_selections.append({selection, selectRows(values, selection)});
+    return true;
+}
+
+void
+TestExternalizedObject::doClearSelection(
+        const GtExternalizedDataSelection& selection)
+{
+    for (int i = 0; i < m_selections.size(); ++i)
+    {
+        if (m_selections[i].first == selection)
+        {
+            m_selections.remove(i);
+            return;
+        }
+    }
+}
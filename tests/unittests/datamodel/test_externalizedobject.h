@@ -15,6 +15,7 @@
 #include "gt_abstractproperty.h"
 #include "gt_externalizedobject.h"
 
+#include <QPair>
 #include <QVariant>
 #include <QVector>
 
@@ -27,6 +28,12 @@ public:
 
     explicit TestExternalizedObjectData(TestExternalizedObject* base);
 
+    TestExternalizedObjectData(TestExternalizedObject* base,
+                               GtExternalizedDataSelection selection);
+
+    /// values of the selected rows
+    QVector<double> selectedValues() const;
+
     const QVector<double>& values() const;
 
     void setValues(const QVector<double>& values) &;
@@ -64,6 +71,19 @@ public:
     /// check if the data was used with params
     bool hasParams() const;
 
+    /// enables fetching selections of the values
+    void setSupportsSelection(bool value) { m_supportsSelection = value; }
+
+    /// number of partial fetches
+    int selectionFetchCount() const { return m_selectionFetchCount; }
+
+    /// number of fetches from data read in advance
+    int bufferFetchCount() const { return m_bufferFetchCount; }
+
+    /// values of the selected rows
+    QVector<double> selectedValues(
+            const GtExternalizedDataSelection& selection) const;
+
     /// forwarding internal methods and member for easier testing
     bool fetchInitialVersion() const
     {
@@ -101,6 +121,24 @@ protected:
      */
     bool doFetchData(QVariant& metaData, bool fetchInitialVersion) override;
 
+    /**
+     * @brief reads the values and params into the buffer.
+     * @param metaData meta data
+     * @param fetchInitialVersion whether to read the initial version
+     * @param buffer buffer to read into
+     * @return success
+     */
+    bool doReadData(const QVariant& metaData, bool fetchInitialVersion,
+                    QVariant& buffer) const override;
+
+    /**
+     * @brief fetches the values and params from the buffer.
+     * @param metaData meta data
+     * @param buffer buffer holding the data
+     * @return success
+     */
+    bool doFetchBuffer(QVariant& metaData, QVariant& buffer) override;
+
     /**
      * @brief externalizes the intData.
      * @param metaData meta data for externalization
@@ -113,6 +151,22 @@ protected:
      */
     void doClearExternalizedData() override;
 
+    qint64 fetchedDataSize() const override;
+
+    bool canFetchSelection() const override;
+
+    /**
+     * @brief fetches the selected values only.
+     * @param metaData meta data
+     * @param selection selected rows
+     * @return success
+     */
+    bool doFetchSelection(QVariant& metaData,
+                          const GtExternalizedDataSelection& selection,
+                          bool fetchInitialVersion) override;
+
+    void doClearSelection(const GtExternalizedDataSelection& selection) override;
+
 private:
 
     /// simple double data to test externalization
@@ -124,6 +178,15 @@ private:
     QVector<double> m_initialValues;
     /// simulates initial params
     QStringList m_initialParams;
+
+    /// whether selections can be fetched
+    bool m_supportsSelection{false};
+    /// number of partial fetches
+    int m_selectionFetchCount{0};
+    /// number of fetches from data read in advance
+    int m_bufferFetchCount{0};
+    /// partially fetched values
+    QVector<QPair<GtExternalizedDataSelection, QVector<double>>> m_selections;
 };
 
 #endif // TEST_EXTERNALOBECT_H
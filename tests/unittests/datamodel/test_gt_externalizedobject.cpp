@@ -12,10 +12,17 @@
 #include "gtest/gtest.h"
 
 #include <QtMath>
+#include <QDir>
+#include <QFileInfo>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #include "test_externalizedobject.h"
 #include "gt_testhelper.h"
 #include "gt_externalizationmanager.h"
+#include "gt_externalizedobjectfetcher.h"
 #include "gt_objectfactory.h"
 #include "gt_objectmemento.h"
 #include "gt_objectmementodiff.h"
@@ -251,6 +258,270 @@ TEST_F(TestGtExternalizedObject, internalize)
     EXPECT_FALSE(obj->isFetched());
 }
 
+/// Multiple objects can be externalized and fetched in a single batch
+TEST_F(TestGtExternalizedObject, bulkExternalizeAndFetch)
+{
+    std::vector<std::unique_ptr<TestExternalizedObject>> objects;
+    QList<GtExternalizedObject*> list;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        objects.push_back(std::make_unique<TestExternalizedObject>());
+        list.append(objects.back().get());
+
+        auto data = objects.back()->fetchData();
+        data.setValues({double(i)});
+    }
+
+    // null objects are ignored
+    list.append(nullptr);
+
+    EXPECT_TRUE(gtExternalizationManager->externalize(list));
+
+    for (auto const& o : objects)
+    {
+        EXPECT_FALSE(o->isFetched());
+        EXPECT_TRUE(o->internalValues().isEmpty());
+    }
+
+    // fetched objects stay fetched until released
+    EXPECT_TRUE(gtExternalizationManager->fetch(list));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(objects[i]->isFetched());
+        EXPECT_EQ(objects[i]->refCount(), 1);
+        EXPECT_EQ(objects[i]->internalValues(), QVector<double>{double(i)});
+    }
+
+    EXPECT_TRUE(gtExternalizationManager->release(list));
+
+    for (auto const& o : objects)
+    {
+        EXPECT_FALSE(o->isFetched());
+        EXPECT_EQ(o->refCount(), 0);
+    }
+}
+
+/// Reading data in a background thread waits for the file access
+TEST_F(TestGtExternalizedObject, readDataLocksFileAccess)
+{
+    {
+        auto data = obj->fetchData();
+        data.setValues(m_values);
+    }
+    ASSERT_TRUE(doExternalize());
+
+    std::atomic<bool> done{false};
+    QVector<QVariant> buffers;
+
+    std::thread reader;
+    {
+        auto lock = gtExternalizationManager->lockFileAccess();
+
+        // the lock is recursive
+        auto nested = gtExternalizationManager->lockFileAccess();
+        EXPECT_TRUE(nested.owns_lock());
+
+        reader = std::thread([&]() {
+            buffers = gtExternalizationManager->readData({obj.get()});
+            done = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(done.load());
+    }
+
+    reader.join();
+    EXPECT_TRUE(done.load());
+
+    ASSERT_EQ(buffers.size(), 1);
+    EXPECT_TRUE(buffers.first().isValid());
+    EXPECT_FALSE(obj->isFetched());
+}
+
+/// Selections of the data are fetched and reference counted separately
+TEST_F(TestGtExternalizedObject, fetchSelection)
+{
+    obj->setSupportsSelection(true);
+
+    QVector<double> const values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    { // fetch and set data
+        auto data = obj->fetchData();
+        data.setValues(values);
+    }
+
+    ASSERT_TRUE(obj->externalize());
+    ASSERT_FALSE(obj->isFetched());
+
+    // rows 2, 4 and 6
+    GtExternalizedDataSelection const selection{2, 3, 2};
+
+    {
+        auto data = obj->fetchData(selection);
+        ASSERT_TRUE(data.isValid());
+        EXPECT_EQ(data.selectedValues(), (QVector<double>{2, 4, 6}));
+
+        // only the selection is fetched
+        EXPECT_FALSE(obj->isFetched());
+        EXPECT_TRUE(obj->isFetched(selection));
+        EXPECT_TRUE(isDataExternalized());
+        EXPECT_EQ(obj->refCount(selection), 1);
+        EXPECT_EQ(obj->refCount(), 0);
+
+        { // fetching the selection again does not read the data again
+            GtExternalizedObjectFetcher<TestExternalizedObject> fetcher{
+                obj.get(), selection
+            };
+            ASSERT_TRUE(fetcher.isValid());
+            EXPECT_EQ(obj->refCount(selection), 2);
+        }
+
+        EXPECT_EQ(obj->refCount(selection), 1);
+        EXPECT_EQ(obj->selectionFetchCount(), 1);
+    }
+
+    EXPECT_EQ(obj->refCount(selection), 0);
+    EXPECT_FALSE(obj->isFetched(selection));
+
+    { // entirely fetched data is used for selections
+        auto full = obj->fetchData();
+        auto data = obj->fetchData(selection);
+
+        EXPECT_EQ(obj->selectionFetchCount(), 1);
+        EXPECT_EQ(data.selectedValues(), (QVector<double>{2, 4, 6}));
+        EXPECT_EQ(obj->refCount(), 2);
+        EXPECT_EQ(obj->refCount(selection), 1);
+    }
+
+    EXPECT_EQ(obj->refCount(), 0);
+    EXPECT_EQ(obj->refCount(selection), 0);
+    EXPECT_FALSE(obj->isFetched());
+}
+
+/// The least recently used objects are evicted to meet the memory budget
+TEST_F(TestGtExternalizedObject, memoryBudget)
+{
+    auto* manager = gtExternalizationManager;
+    manager->resetMemoryStatistics();
+
+    auto const before = manager->memoryStatistics();
+    constexpr qint64 size = 100 * sizeof(double);
+
+    std::vector<std::unique_ptr<TestExternalizedObject>> objects;
+    for (int i = 0; i < 4; ++i)
+    {
+        objects.push_back(std::make_unique<TestExternalizedObject>());
+
+        // modified data is kept until saved
+        auto data = objects.back()->fetchData();
+        data.setValues(QVector<double>(100, i));
+    }
+
+    auto stats = manager->memoryStatistics();
+    EXPECT_EQ(stats.fetchedSize - before.fetchedSize, 4 * size);
+    EXPECT_EQ(stats.fetchedObjects - before.fetchedObjects, 4);
+
+    { // mark first object as recently used
+        auto data = objects[0]->fetchData();
+    }
+
+    manager->setMemoryBudget(before.fetchedSize + 2 * size + size / 2);
+
+    // objects 1 and 2 were least recently used
+    EXPECT_TRUE(objects[0]->isFetched());
+    EXPECT_FALSE(objects[1]->isFetched());
+    EXPECT_FALSE(objects[2]->isFetched());
+    EXPECT_TRUE(objects[3]->isFetched());
+
+    stats = manager->memoryStatistics();
+    EXPECT_EQ(stats.fetchedSize - before.fetchedSize, 2 * size);
+    EXPECT_EQ(stats.evictedObjects, 2);
+    EXPECT_EQ(stats.evictedSize, 2 * size);
+    EXPECT_EQ(stats.writtenBackObjects, 2);
+
+    // the unsaved data is written to the scratch data, not to the project
+    QDir projectDir{manager->projectDir()};
+    auto const dataFile = [&](TestExternalizedObject const& obj,
+                              QString const& scratch) {
+        return projectDir.absoluteFilePath("test_ext" + obj.uuid() + scratch +
+                                           "_values.txt");
+    };
+
+    EXPECT_TRUE(QFileInfo::exists(dataFile(*objects[1], "_scratch")));
+    EXPECT_FALSE(QFileInfo::exists(dataFile(*objects[1], "")));
+
+    { // evicted data is fetched from the scratch data
+        auto data = objects[1]->fetchData();
+        EXPECT_EQ(data.values(), QVector<double>(100, 1));
+
+        // accessed objects are not evicted
+        EXPECT_TRUE(objects[1]->isFetched());
+        EXPECT_FALSE(objects[3]->isFetched());
+        EXPECT_TRUE(objects[0]->isFetched());
+    }
+
+    manager->setMemoryBudget(0);
+
+    // saving moves the evicted data into the project
+    QList<GtExternalizedObject*> list;
+    for (auto const& obj : objects) list.append(obj.get());
+
+    EXPECT_TRUE(manager->externalize(list));
+    EXPECT_TRUE(QFileInfo::exists(dataFile(*objects[2], "")));
+
+    {
+        auto data = objects[2]->fetchData();
+        EXPECT_EQ(data.values(), QVector<double>(100, 2));
+    }
+
+    objects.clear();
+    EXPECT_EQ(manager->memoryStatistics().fetchedSize, before.fetchedSize);
+}
+
+/// Objects of unknown size are not evicted to meet the memory budget
+TEST_F(TestGtExternalizedObject, memoryBudgetIgnoresUnknownSize)
+{
+    struct UnsizedObject : public TestExternalizedObject
+    {
+        qint64 fetchedDataSize() const override { return 0; }
+    };
+
+    auto* manager = gtExternalizationManager;
+    manager->resetMemoryStatistics();
+
+    auto const before = manager->memoryStatistics();
+    constexpr qint64 size = 100 * sizeof(double);
+
+    // the least recently used objects report no size
+    std::vector<std::unique_ptr<TestExternalizedObject>> objects;
+    objects.push_back(std::make_unique<UnsizedObject>());
+    objects.push_back(std::make_unique<UnsizedObject>());
+    objects.push_back(std::make_unique<TestExternalizedObject>());
+
+    for (auto const& o : objects)
+    {
+        auto data = o->fetchData();
+        data.setValues(QVector<double>(100, 1.0));
+    }
+
+    manager->setMemoryBudget(before.fetchedSize + size / 2);
+
+    EXPECT_TRUE(objects[0]->isFetched());
+    EXPECT_TRUE(objects[1]->isFetched());
+    EXPECT_FALSE(objects[2]->isFetched());
+
+    auto const stats = manager->memoryStatistics();
+    EXPECT_EQ(stats.evictedObjects, 1);
+    EXPECT_EQ(stats.evictedSize, size);
+
+    manager->setMemoryBudget(0);
+
+    objects.clear();
+    EXPECT_EQ(manager->memoryStatistics().fetchedSize, before.fetchedSize);
+}
+
 /// An externalized object should not externalize, clear or fetch data
 /// if the externalization feature is disabled
 TEST_F(TestGtExternalizedObject, disableExternalization)
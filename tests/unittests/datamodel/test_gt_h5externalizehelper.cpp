@@ -14,9 +14,12 @@
 
 #include "gt_h5externalizehelper.h"
 #include "gt_externalizationmanager.h"
+#include "gt_h5externalizationinterface.h"
 
 #include "test_externalizedobject.h"
 
+#include <numeric>
+
 /// This is a test fixture that does a init for each test
 struct TestGtH5ExternalizeHelper : public ::testing::Test
 {
@@ -69,7 +72,7 @@ TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_issue_453)
             auto dset = helper.overwriteDataSet(dtype, dspace, ref);
 
             EXPECT_TRUE(dset.dataType() == dtype);
-            EXPECT_TRUE(dset.dataSpace() == dspace);
+            EXPECT_TRUE(dset.dataSpace().dimensions() == dspace.dimensions());
         }
 
         // dset must be overwritten due to changed datatype
@@ -78,7 +81,7 @@ TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_issue_453)
             auto dset = helper.overwriteDataSet(dtype, dspace, ref);
 
             EXPECT_TRUE(dset.dataType() == dtype);
-            EXPECT_TRUE(dset.dataSpace() == dspace);
+            EXPECT_TRUE(dset.dataSpace().dimensions() == dspace.dimensions());
         }
 
         // dset must be overwritten due to changed dataspace
@@ -87,7 +90,7 @@ TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_issue_453)
             auto dset = helper.overwriteDataSet(dtype, dspace, ref);
 
             EXPECT_TRUE(dset.dataType() == dtype);
-            EXPECT_TRUE(dset.dataSpace() == dspace);
+            EXPECT_TRUE(dset.dataSpace().dimensions() == dspace.dimensions());
         }
 
         // file should have a single dataset named like our object
@@ -106,4 +109,192 @@ TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_issue_453)
     }
 }
 
+/// Datasets can be written and read while the file is kept open
+TEST_F(TestGtH5ExternalizeHelper, fileSession)
+{
+    GtH5ExternalizeHelper helper{*obj};
+
+    EXPECT_FALSE(gtH5ExternalizationInterface->hasFileSession());
+
+    try
+    {
+        GenH5::Data<double> data{QVector<double>{1.0, 2.0, 3.0}};
+        QVariant ref;
+
+        {
+            GtExternalizationManager::Batch batch;
+            EXPECT_TRUE(gtH5ExternalizationInterface->hasFileSession());
+
+            {
+                GtExternalizationManager::Batch nested;
+            }
+            EXPECT_TRUE(gtH5ExternalizationInterface->hasFileSession());
+
+            ASSERT_TRUE(helper.write(data, ref));
+
+            GenH5::Data<double> read;
+            ASSERT_TRUE(helper.read(read, ref, false));
+            EXPECT_TRUE(read.values() == data.values());
+        }
+
+        EXPECT_FALSE(gtH5ExternalizationInterface->hasFileSession());
+
+        // file was closed and can be read again
+        GenH5::Data<double> read;
+        ASSERT_TRUE(helper.read(read, ref, false));
+        EXPECT_TRUE(read.values() == data.values());
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+}
+
+/// Chunked datasets are resized instead of recreated
+TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_resize)
+{
+    GtH5ExternalizeHelper helper{*obj};
+
+    try
+    {
+        GenH5::DataType dtype = GenH5::dataType<double>();
+        QVariant ref;
+
+        auto dset = helper.overwriteDataSet(dtype, GenH5::DataSpace::linear(10),
+                                            ref);
+        EXPECT_TRUE(dset.cProperties().isChunked());
+
+        QVariant const oldRef = ref;
+
+        auto dspace = GenH5::DataSpace::linear(1000);
+        dset = helper.overwriteDataSet(dtype, dspace, ref);
+
+        EXPECT_EQ(ref, oldRef);
+        EXPECT_TRUE(dset.dataSpace().dimensions() == dspace.dimensions());
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+}
+
+/// Datasets are stored contiguous for a chunk size of 0
+TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_contiguous)
+{
+    auto* h5Interface = gtH5ExternalizationInterface;
+    int const chunkSize = h5Interface->chunkSize();
+
+    h5Interface->setChunkSize(-1);
+    EXPECT_EQ(h5Interface->chunkSize(), 0);
+
+    GtH5ExternalizeHelper helper{*obj};
+
+    try
+    {
+        GenH5::DataType dtype = GenH5::dataType<double>();
+        QVariant ref;
+
+        auto dspace = GenH5::DataSpace::linear(10);
+        auto dset = helper.overwriteDataSet(dtype, dspace, ref);
+        EXPECT_FALSE(dset.cProperties().isChunked());
+        EXPECT_TRUE(dset.dataSpace().dimensions() == dspace.dimensions());
+
+        // contiguous datasets are recreated to change their size
+        dspace = GenH5::DataSpace::linear(100);
+        dset = helper.overwriteDataSet(dtype, dspace, ref);
+        EXPECT_FALSE(dset.cProperties().isChunked());
+        EXPECT_TRUE(dset.dataSpace().dimensions() == dspace.dimensions());
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        h5Interface->setChunkSize(chunkSize);
+        ASSERT_NO_THROW(throw e);
+    }
+
+    h5Interface->setChunkSize(chunkSize);
+}
+
+/// Repacking the file keeps the datasets
+TEST_F(TestGtH5ExternalizeHelper, repackFile)
+{
+    GtH5ExternalizeHelper helper{*obj};
+
+    QString const filePath =
+        gtH5ExternalizationInterface->projectHDF5FilePath(false);
+
+    try
+    {
+        GenH5::Data<double> data{QVector<double>(1000, 42.0)};
+        QVariant ref;
+
+        // recreating the dataset leaves dead space behind
+        GenH5::Data<int> intData{QVector<int>(1000, 42)};
+        ASSERT_TRUE(helper.write(intData, ref));
+        ASSERT_TRUE(helper.write(data, ref));
+
+        EXPECT_TRUE(GtH5ExternalizationInterface::repackFile(filePath));
+
+        // the reference may be outdated, the dataset is found by path
+        GenH5::Data<double> read;
+        ASSERT_TRUE(helper.read(read, ref, false));
+        EXPECT_TRUE(read.values() == data.values());
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+
+    EXPECT_FALSE(GtH5ExternalizationInterface::repackFile(
+                     filePath + QStringLiteral(".missing")));
+}
+
+/// Only the selected rows and columns are read
+TEST_F(TestGtH5ExternalizeHelper, readSelection)
+{
+    GtH5ExternalizeHelper helper{*obj};
+
+    try
+    {
+        QVector<double> values(20);
+        std::iota(values.begin(), values.end(), 0.0);
+
+        QVariant ref;
+
+        // 4 rows, 5 columns
+        {
+            auto dset = helper.overwriteDataSet(GenH5::dataType<double>(),
+                                                GenH5::DataSpace{4, 5}, ref);
+            ASSERT_TRUE(dset.write(GenH5::Data<double>{values}));
+        }
+
+        QVector<double> selected;
+
+        // rows 1 and 3
+        ASSERT_TRUE(helper.readSelection(
+            selected, ref, GtExternalizedDataSelection{1, 0, 2}, false));
+        EXPECT_EQ(selected, (QVector<double>{5, 6, 7, 8, 9,
+                                             15, 16, 17, 18, 19}));
+
+        // rows 1 and 2, columns 1, 3 and 4
+        auto selection = GtExternalizedDataSelection{1, 2};
+        selection.setColumns({4, 1, 3});
+        ASSERT_TRUE(helper.readSelection(selected, ref, selection, false));
+        EXPECT_EQ(selected, (QVector<double>{6, 8, 9, 11, 13, 14}));
+
+        // out of range
+        ASSERT_TRUE(helper.readSelection(
+            selected, ref, GtExternalizedDataSelection{10, 2}, false));
+        EXPECT_TRUE(selected.isEmpty());
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+}
+
 #endif
@@ -0,0 +1,150 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_objectmemento.h"
+#include "gt_objectfactory.h"
+#include "test_gt_object.h"
+#include "test_propertycontainerobject.h"
+
+#include <QPointF>
+
+TEST(TestGtMementoBinaryFormat, nullMemento)
+{
+    QByteArray data = GtObjectMemento().toByteArray(
+        GtObjectMemento::Format::Binary);
+
+    EXPECT_TRUE(GtObjectMemento::isBinary(data));
+    EXPECT_TRUE(GtObjectMemento(data).isNull());
+}
+
+TEST(TestGtMementoBinaryFormat, xmlIsNotBinary)
+{
+    TestSpecialGtObject obj;
+    EXPECT_FALSE(GtObjectMemento::isBinary(obj.toMemento().toByteArray()));
+}
+
+TEST(TestGtMementoBinaryFormat, typedProperties)
+{
+    using PD = GtObjectMemento::PropertyData;
+
+    GtObjectMemento memento;
+    memento.setClassName("GtObjectGroup")
+           .setUuid("{my-uuid}")
+           .setIdent("Group");
+    memento.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+
+    PD inactive;
+    inactive.name = "bool";
+    inactive.isActive = false;
+    inactive.setData(true);
+
+    PD doubles;
+    doubles.name = "doubles";
+    doubles.setData(QVariant::fromValue(QVector<double>{0.1, 1e-300, -2.5}));
+
+    PD points;
+    points.name = "points";
+    points.setData(QVariant::fromValue(QList<QPointF>{{1., 2.}, {3., 4.}}));
+
+    PD structProp;
+    structProp.name = "entry";
+    structProp.toStruct("MyStruct");
+    PD member;
+    member.name = "member";
+    member.setData(QString("value"));
+    structProp.childProperties.push_back(member);
+
+    PD container;
+    container.name = "container";
+    container.childProperties.push_back(structProp);
+
+    memento.properties << inactive << doubles << points;
+    memento.properties.push_back(PD().setData(42));
+    memento.properties.push_back(PD().setData(QStringList{"a", "", "b"}));
+    memento.properties.push_back(PD().setData(QVariant{}));
+    memento.propertyContainers.push_back(container);
+
+    GtObjectMemento child;
+    child.setClassName("GtObjectGroup").setUuid("{child-uuid}");
+    memento.childObjects.push_back(child);
+
+    GtObjectMemento copy(memento.toByteArray(GtObjectMemento::Format::Binary));
+
+    ASSERT_FALSE(copy.isNull());
+    EXPECT_EQ(copy.uuid(), memento.uuid());
+    EXPECT_EQ(copy.ident(), memento.ident());
+    EXPECT_TRUE(copy.isFlagEnabled(GtObjectMemento::SaveAsOwnFile));
+    EXPECT_FALSE(copy.isFlagEnabled(GtObjectMemento::IsUnresolved));
+    ASSERT_EQ(copy.childObjects.size(), 1);
+    EXPECT_EQ(copy.childObjects[0].uuid(), child.uuid());
+
+    auto const* pDoubles = GtObjectMemento::findPropertyByName(
+        copy.properties, "doubles");
+    ASSERT_NE(pDoubles, nullptr);
+    EXPECT_EQ(pDoubles->data().value<QVector<double>>(),
+              (QVector<double>{0.1, 1e-300, -2.5}));
+
+    auto const* pBool = GtObjectMemento::findPropertyByName(
+        copy.properties, "bool");
+    ASSERT_NE(pBool, nullptr);
+    EXPECT_FALSE(pBool->isActive);
+
+    ASSERT_EQ(copy.propertyContainers.size(), 1);
+    ASSERT_EQ(copy.propertyContainers[0].childProperties.size(), 1);
+    auto const& entry = copy.propertyContainers[0].childProperties[0];
+    EXPECT_EQ(entry.type(), PD::STRUCT_T);
+    EXPECT_EQ(entry.dataType(), "MyStruct");
+
+    // all property types and values are preserved
+    memento.calculateHashes();
+    copy.calculateHashes();
+    EXPECT_EQ(copy.fullHash(), memento.fullHash());
+
+    EXPECT_EQ(copy.toByteArray(), memento.toByteArray());
+}
+
+TEST(TestGtMementoBinaryFormat, objectRoundTrip)
+{
+    gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+    gtObjectFactory->registerClass(TestObject::staticMetaObject);
+
+    TestSpecialGtObject obj;
+    obj.setDouble(1.5);
+    obj.setString("str");
+    obj.setDoubleVec({1., 2., 3.});
+
+    auto* child = new TestObject;
+    child->addEnvironmentVar("PATH", "/usr/bin");
+    obj.appendChild(child);
+
+    GtObjectMemento memento = obj.toMemento();
+    QByteArray binary = memento.toByteArray(GtObjectMemento::Format::Binary);
+    QByteArray xml = memento.toByteArray();
+
+    EXPECT_LT(binary.size(), xml.size());
+
+    GtObjectMemento copy(binary);
+    EXPECT_EQ(copy.toByteArray(), xml);
+
+    std::unique_ptr<GtObject> restored(copy.restore(gtObjectFactory));
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->toMemento().toByteArray(), xml);
+}
+
+TEST(TestGtMementoBinaryFormat, invalidData)
+{
+    TestSpecialGtObject obj;
+
+    QByteArray data = obj.toMemento().toByteArray(
+        GtObjectMemento::Format::Binary);
+
+    data.chop(data.size() / 2);
+
+    EXPECT_TRUE(GtObjectMemento::isBinary(data));
+    EXPECT_TRUE(GtObjectMemento(data).isNull());
+}
@@ -18,6 +18,7 @@
 
 #include "slotadaptor.h"
 #include <QtConcurrent/QtConcurrent>
+#include <QElapsedTimer>
 
 /// This is a test fixture that does a init for each test
 class TestGtObject : public ::testing::Test
@@ -248,6 +249,69 @@ TEST_F(TestGtObject, insertChild)
     delete parentObject;
 }
 
+TEST_F(TestGtObject, cachedChildNumbers)
+{
+    GtObject parent;
+    EXPECT_EQ(parent.directChildCount(), 0);
+    EXPECT_EQ(parent.childAt(0), nullptr);
+
+    QList<GtObject*> children;
+    for (int i = 0; i < 5; ++i)
+    {
+        children.append(new GtObject);
+        ASSERT_TRUE(parent.appendChild(children.last()));
+    }
+
+    // non GtObject children are ignored
+    new QObject(&parent);
+
+    auto checkChildren = [&]() {
+        ASSERT_EQ(parent.directChildCount(), children.size());
+        EXPECT_EQ(parent.findDirectChildren(), children);
+        for (int i = 0; i < children.size(); ++i)
+        {
+            EXPECT_EQ(parent.childAt(i), children.at(i));
+            EXPECT_EQ(children.at(i)->childNumber(), i);
+        }
+    };
+
+    checkChildren();
+
+    // append to the cached list
+    children.append(new GtObject);
+    parent.appendChild(children.last());
+    checkChildren();
+
+    // insert in between
+    children.insert(1, new GtObject);
+    ASSERT_TRUE(parent.insertChild(1, children.at(1)));
+    checkChildren();
+
+    // remove in between
+    delete children.takeAt(2);
+    checkChildren();
+
+    // remove last
+    delete children.takeLast();
+    checkChildren();
+
+    // reparent
+    GtObject other;
+    GtObject* moved = children.takeAt(0);
+    other.appendChild(moved);
+    checkChildren();
+    EXPECT_EQ(moved->childNumber(), 0);
+    EXPECT_EQ(other.childAt(0), moved);
+
+    // children created with parent
+    children.append(new GtObject(&parent));
+    checkChildren();
+
+    EXPECT_EQ(parent.childAt(-1), nullptr);
+    EXPECT_EQ(parent.childAt(children.size()), nullptr);
+    EXPECT_EQ(parent.childNumber(), -1);
+}
+
 TEST_F(TestGtObject, isDerivedFromClass)
 {
     GtLabelData label;
@@ -308,6 +372,150 @@ TEST_F(TestGtObject, findRoot)
     EXPECT_EQ(childchild->findRoot<QObject*>(), &obj);
 }
 
+TEST_F(TestGtObject, getObjectByUuid)
+{
+    auto* child = new GtObject;
+    auto* childchild = new GtObject;
+    child->appendChild(childchild);
+
+    // build index
+    EXPECT_EQ(obj.getObjectByUuid(obj.uuid()), &obj);
+    EXPECT_EQ(obj.getObjectByUuid(child->uuid()), nullptr);
+
+    // append child
+    obj.appendChild(child);
+    EXPECT_EQ(obj.getObjectByUuid(child->uuid()), child);
+    EXPECT_EQ(obj.getObjectByUuid(childchild->uuid()), childchild);
+    EXPECT_EQ(child->getObjectByUuid(childchild->uuid()), childchild);
+
+    // only the subtree is searched
+    EXPECT_EQ(childchild->getObjectByUuid(child->uuid()), nullptr);
+    EXPECT_EQ(child->getObjectByUuid(obj.uuid()), nullptr);
+
+    // change uuids
+    QString const oldUuid = childchild->uuid();
+    childchild->newUuid();
+    EXPECT_EQ(obj.getObjectByUuid(oldUuid), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(childchild->uuid()), childchild);
+
+    child->setUuid(QStringLiteral("my_uuid"));
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), child);
+
+    // remove child
+    childchild->setParent(nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(childchild->uuid()), nullptr);
+
+    // object with identical uuid
+    auto* clone = new GtObject;
+    clone->setUuid(QStringLiteral("my_uuid"));
+    childchild->appendChild(clone);
+    obj.appendChild(childchild);
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), child);
+    EXPECT_EQ(childchild->getObjectByUuid(QStringLiteral("my_uuid")), clone);
+
+    // delete objects
+    QString const uuid = childchild->uuid();
+    delete childchild;
+    EXPECT_EQ(obj.getObjectByUuid(uuid), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), child);
+
+    delete child;
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), nullptr);
+}
+
+/// Benchmark of the uuid lookup on a tree with 10^5 objects
+TEST_F(TestGtObject, getObjectByUuidLargeTree)
+{
+    constexpr int nGroups = 100;
+    constexpr int nChildren = 999;
+
+    GtObjectGroup root;
+    QStringList uuids;
+
+    for (int i = 0; i < nGroups; ++i)
+    {
+        auto* group = new GtObjectGroup(&root);
+        uuids << group->uuid();
+
+        for (int j = 0; j < nChildren; ++j)
+        {
+            uuids << (new GtObjectGroup(group))->uuid();
+        }
+    }
+
+    ASSERT_EQ(uuids.size(), nGroups * (nChildren + 1));
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (QString const& uuid : qAsConst(uuids))
+    {
+        GtObject* found = root.getObjectByUuid(uuid);
+        ASSERT_NE(found, nullptr);
+        ASSERT_EQ(found->uuid(), uuid);
+    }
+
+    RecordProperty("lookups", uuids.size());
+    RecordProperty("lookup_time_ms", static_cast<int>(timer.elapsed()));
+}
+
+TEST_F(TestGtObject, hashEqualsMementoHash)
+{
+    gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+
+    TestSpecialGtObject parent;
+    parent.setInt(12);
+    new GtObjectGroup(&parent);
+    auto* child = new TestSpecialGtObject;
+    child->setString("child");
+    parent.appendChild(child);
+
+    auto memento = parent.toMemento();
+    memento.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+
+    EXPECT_EQ(parent.hash(), memento.fullHash());
+    EXPECT_EQ(parent.hash().size(), 16);
+
+    // the cryptographic hash is not affected
+    memento.calculateHashes(GtObjectMemento::HashAlgorithm::Sha256);
+    EXPECT_EQ(memento.fullHash().toHex(), parent.calcHash());
+}
+
+TEST_F(TestGtObject, hashIsInvalidatedByChanges)
+{
+    gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+
+    TestSpecialGtObject parent;
+    auto* group = new GtObjectGroup(&parent);
+    auto* child = new TestSpecialGtObject;
+    group->appendChild(child);
+
+    QByteArray const initial = parent.hash();
+    EXPECT_EQ(parent.hash(), initial);
+
+    // property change of a nested child
+    child->setInt(42);
+    QByteArray const changed = parent.hash();
+    EXPECT_NE(changed, initial);
+
+    // object name
+    group->setObjectName("Renamed");
+    QByteArray const renamed = parent.hash();
+    EXPECT_NE(renamed, changed);
+
+    // appending and removing children
+    auto* other = new GtObjectGroup;
+    group->appendChild(other);
+    EXPECT_NE(parent.hash(), renamed);
+
+    delete other;
+    EXPECT_EQ(parent.hash(), renamed);
+
+    auto memento = parent.toMemento();
+    memento.calculateHashes(GtObjectMemento::HashAlgorithm::Fast);
+    EXPECT_EQ(parent.hash(), memento.fullHash());
+}
+
 TEST_F(TestGtObject, constness)
 {
     GtObject* obj{};
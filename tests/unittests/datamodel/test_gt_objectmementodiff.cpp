@@ -1352,3 +1352,54 @@ TEST_F(TestGtObjectMementoDiff, childIndexChanges)
     ASSERT_STREQ(childs[2]->objectName().toStdString().c_str(), "O3");
 }
 
+
+TEST_F(TestGtObjectMementoDiff, snapshotSharesUnchangedSubtrees)
+{
+    auto* changed = new TestSpecialGtObject;
+    changed->setObjectName("Changed");
+    auto* unchanged = new TestSpecialGtObject;
+    unchanged->setObjectName("Unchanged");
+
+    obj1.appendChild(changed);
+    obj1.appendChild(unchanged);
+
+    GtObjectMemento before = obj1.snapshot();
+    EXPECT_EQ(before.toByteArray(), obj1.toMemento().toByteArray());
+    EXPECT_TRUE(before.isSharedWith(obj1.snapshot()));
+
+    changed->setDouble(42.0);
+
+    GtObjectMemento after = obj1.snapshot();
+    EXPECT_EQ(after.toByteArray(), obj1.toMemento().toByteArray());
+
+    ASSERT_EQ(before.childObjects.size(), 2);
+    ASSERT_EQ(after.childObjects.size(), 2);
+    EXPECT_FALSE(before.isSharedWith(after));
+    EXPECT_FALSE(before.childObjects[0].isSharedWith(after.childObjects[0]));
+    EXPECT_TRUE(before.childObjects[1].isSharedWith(after.childObjects[1]));
+}
+
+TEST_F(TestGtObjectMementoDiff, snapshotDiff)
+{
+    auto* child = new TestSpecialGtObject;
+    child->setObjectName("Child");
+    obj1.appendChild(child);
+    obj1.appendChild(new TestSpecialGtObject);
+
+    GtObjectMemento before = obj1.snapshot();
+    GtObjectMemento mementoBefore = obj1.toMemento();
+
+    EXPECT_TRUE(GtObjectMementoDiff(before, obj1.snapshot()).isNull());
+
+    child->setInt(7);
+    obj1.appendChild(new TestSpecialGtObject);
+
+    GtObjectMementoDiff snapshotDiff(before, obj1.snapshot());
+    GtObjectMementoDiff mementoDiff(mementoBefore, obj1.toMemento());
+
+    ASSERT_FALSE(snapshotDiff.isNull());
+    EXPECT_EQ(snapshotDiff.toByteArray(), mementoDiff.toByteArray());
+
+    ASSERT_TRUE(obj1.revertDiff(snapshotDiff));
+    EXPECT_EQ(obj1.snapshot().toByteArray(), mementoBefore.toByteArray());
+}
@@ -0,0 +1,523 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_abstractproperty.h"
+#include "gt_objectfactory.h"
+#include "gt_objectmemento.h"
+#include "gt_typedmementodiff.h"
+#include "gt_xmlutilities.h"
+#include "gt_xmlexpr.h"
+
+#include "test_gt_object.h"
+
+#include <QDir>
+#include <QDomDocument>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace
+{
+
+QDomDocument
+readDom(const QString& path)
+{
+    QFile file(path);
+    QDomDocument doc;
+    EXPECT_TRUE(gt::xml::readDomDocumentFromFile(file, doc, true));
+    return doc;
+}
+
+QByteArray
+readBytes(const QString& path)
+{
+    QFile file(path);
+    EXPECT_TRUE(file.open(QIODevice::ReadOnly));
+    return file.readAll();
+}
+
+bool
+save(const GtObjectMemento& memento, const QString& masterPath,
+     gt::xml::LinkFileSaveType saveType =
+         gt::xml::LinkFileSaveType::WithLinkedFiles)
+{
+    QDomDocument doc;
+    doc.setContent(memento.toByteArray());
+
+    QString error;
+    bool success = gt::xml::saveProjectXmlWithLinkedObjects(
+        QStringLiteral("Test"), doc, QFileInfo(masterPath).dir(), masterPath,
+        saveType, &error);
+
+    EXPECT_TRUE(error.isEmpty()) << error.toStdString();
+    return success;
+}
+
+std::unique_ptr<GtObject>
+load(const QString& masterPath,
+     gt::xml::LinkedObjectLoading loading =
+         gt::xml::LinkedObjectLoading::OnDemand,
+     QStringList* warnings = nullptr)
+{
+    QDomDocument doc = gt::xml::loadProjectXmlWithLinkedObjects(
+        masterPath, warnings, loading);
+
+    return GtObjectMemento(doc.documentElement()).toObject(*gtObjectFactory);
+}
+
+} // namespace
+
+class TestGtOnDemandLinkedObjects : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!gtObjectFactory->knownClass("TestSpecialGtObject"))
+        {
+            gtObjectFactory->registerClass(
+                TestSpecialGtObject::staticMetaObject);
+        }
+
+        ASSERT_TRUE(tempDir.isValid());
+        masterPath = QDir(tempDir.path()).filePath("master.xml");
+
+        TestSpecialGtObject root;
+        root.setObjectName("Root");
+
+        auto* linked = new TestSpecialGtObject;
+        linked->setObjectName("Linked");
+        linked->setDouble(2.5);
+        linked->setSaveAsOwnFile(true);
+        root.appendChild(linked);
+
+        auto* nested = new TestSpecialGtObject;
+        nested->setObjectName("Nested");
+        nested->setSaveAsOwnFile(true);
+        linked->appendChild(nested);
+
+        linkedUuid = linked->uuid();
+        nestedUuid = nested->uuid();
+        rootMemento = root.toMemento();
+
+        ASSERT_TRUE(save(rootMemento, masterPath));
+
+        QDomElement ref = readDom(masterPath).documentElement()
+                .firstChildElement(gt::xml::S_OBJECTLIST_TAG)
+                .firstChildElement(gt::xml::S_OBJECTREF_TAG);
+        ASSERT_FALSE(ref.isNull());
+        linkedPath = QDir(tempDir.path())
+                .filePath(ref.attribute(gt::xml::S_HREF_TAG));
+    }
+
+    QTemporaryDir tempDir;
+    QString masterPath, linkedPath;
+    QString linkedUuid, nestedUuid;
+    GtObjectMemento rootMemento;
+};
+
+TEST_F(TestGtOnDemandLinkedObjects, saveWritesOnDemandHint)
+{
+    QDomElement ref = readDom(masterPath).documentElement()
+            .firstChildElement(gt::xml::S_OBJECTLIST_TAG)
+            .firstChildElement(gt::xml::S_OBJECTREF_TAG);
+
+    EXPECT_EQ(ref.attribute(gt::xml::S_LOAD_TAG), gt::xml::S_LOAD_ONDEMAND);
+    EXPECT_FALSE(ref.hasAttribute(gt::xml::S_LINKBASE_TAG));
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, placeholderIsLoadedOnAccess)
+{
+    QStringList warnings;
+    auto root = load(masterPath, gt::xml::LinkedObjectLoading::OnDemand,
+                     &warnings);
+    ASSERT_NE(root, nullptr);
+    EXPECT_TRUE(warnings.isEmpty());
+
+    auto* linked = root->findDirectChild<TestSpecialGtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+    EXPECT_FALSE(linked->isMaterialized());
+    EXPECT_FALSE(linked->isDummy());
+    EXPECT_TRUE(linked->saveAsOwnFile());
+    EXPECT_EQ(linked->uuid(), linkedUuid);
+    EXPECT_TRUE(linked->findDirectChildren().isEmpty());
+
+    // property access loads the data
+    ASSERT_NE(linked->findProperty("doubleProp"), nullptr);
+    EXPECT_TRUE(linked->isMaterialized());
+    EXPECT_DOUBLE_EQ(linked->getDouble(), 2.5);
+    EXPECT_FALSE(linked->objectFlags() & GtObject::HasChildChanges);
+
+    // nested linked objects are loaded on demand as well
+    auto* nested = linked->findDirectChild<GtObject*>("Nested");
+    ASSERT_NE(nested, nullptr);
+    EXPECT_FALSE(nested->isMaterialized());
+    EXPECT_EQ(nested->uuid(), nestedUuid);
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, materializeAll)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    EXPECT_TRUE(root->materializeAll());
+
+    for (GtObject* obj : root->findChildren())
+    {
+        EXPECT_TRUE(obj->isMaterialized());
+    }
+
+    EXPECT_TRUE(GtTypedMementoDiff(rootMemento, root->toMemento()).isNull());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, diffIgnoresMaterialization)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    auto* linked = root->findDirectChild<TestSpecialGtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+
+    GtObjectMemento before = root->toMemento();
+    EXPECT_TRUE(before.childObjects.first().isFlagEnabled(
+                    GtObjectMemento::IsPlaceholder));
+
+    ASSERT_TRUE(linked->materialize());
+    EXPECT_TRUE(GtTypedMementoDiff(before, root->toMemento()).isNull());
+
+    linked->setDouble(3.0);
+
+    GtTypedMementoDiff diff(before, root->toMemento());
+    ASSERT_EQ(diff.objectChanges().size(), 1);
+
+    ASSERT_TRUE(root->revertDiff(diff));
+    EXPECT_DOUBLE_EQ(linked->getDouble(), 2.5);
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, savePlaceholderKeepsLinkedFile)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    QByteArray linkedContent = readBytes(linkedPath);
+
+    ASSERT_TRUE(save(root->toMemento(), masterPath));
+    EXPECT_EQ(readBytes(linkedPath), linkedContent);
+
+    QDomElement ref = readDom(masterPath).documentElement()
+            .firstChildElement(gt::xml::S_OBJECTLIST_TAG)
+            .firstChildElement(gt::xml::S_OBJECTREF_TAG);
+    EXPECT_EQ(QDir(tempDir.path()).filePath(ref.attribute(gt::xml::S_HREF_TAG)),
+              linkedPath);
+    EXPECT_FALSE(ref.hasAttribute(gt::xml::S_LINKBASE_TAG));
+
+    auto reloaded = load(masterPath, gt::xml::LinkedObjectLoading::Eager);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_TRUE(GtTypedMementoDiff(rootMemento, reloaded->toMemento()).isNull());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, savePlaceholderToOtherLocation)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    QTemporaryDir otherDir;
+    ASSERT_TRUE(otherDir.isValid());
+    const QString otherPath = QDir(otherDir.path()).filePath("master.xml");
+
+    ASSERT_TRUE(save(root->toMemento(), otherPath));
+
+    // the copy must not depend on the original files
+    ASSERT_TRUE(tempDir.remove());
+
+    auto reloaded = load(otherPath, gt::xml::LinkedObjectLoading::Eager);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_TRUE(GtTypedMementoDiff(rootMemento, reloaded->toMemento()).isNull());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, saveAsOneFile)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    QTemporaryDir otherDir;
+    ASSERT_TRUE(otherDir.isValid());
+    const QString otherPath = QDir(otherDir.path()).filePath("master.xml");
+
+    ASSERT_TRUE(save(root->toMemento(), otherPath,
+                     gt::xml::LinkFileSaveType::OneFile));
+
+    QDomDocument doc = readDom(otherPath);
+    EXPECT_EQ(doc.elementsByTagName(gt::xml::S_OBJECTREF_TAG).count(), 0);
+
+    auto reloaded = GtObjectMemento(doc.documentElement())
+            .toObject(*gtObjectFactory);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_TRUE(GtTypedMementoDiff(rootMemento, reloaded->toMemento()).isNull());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, saveModuleFromMementos)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    QTemporaryDir otherDir;
+    ASSERT_TRUE(otherDir.isValid());
+    const QString modulePath = QDir(otherDir.path()).filePath("module.xml");
+
+    QString error;
+    ASSERT_TRUE(gt::xml::saveModuleXmlFromMementos(
+        modulePath, QStringLiteral("package-uuid"), {root->toMemento()},
+        &error)) << error.toStdString();
+
+    QDomDocument doc = readDom(modulePath);
+    QDomElement moduleElement = doc.documentElement();
+    EXPECT_EQ(moduleElement.tagName(), QStringLiteral("GTLABMODULE"));
+    EXPECT_EQ(moduleElement.attribute(gt::xml::S_UUID_TAG),
+              QStringLiteral("package-uuid"));
+    EXPECT_EQ(doc.elementsByTagName(gt::xml::S_OBJECTREF_TAG).count(), 0);
+
+    auto reloaded = GtObjectMemento(moduleElement.firstChildElement())
+            .toObject(*gtObjectFactory);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_TRUE(GtTypedMementoDiff(rootMemento, reloaded->toMemento()).isNull());
+
+    // a missing linked file must not be replaced by an incomplete module file
+    auto unresolved = load(masterPath);
+    ASSERT_NE(unresolved, nullptr);
+    ASSERT_TRUE(QFile::remove(linkedPath));
+    const QByteArray content = readBytes(modulePath);
+
+    EXPECT_FALSE(gt::xml::saveModuleXmlFromMementos(
+        modulePath, QStringLiteral("package-uuid"),
+        {unresolved->toMemento()}, &error));
+    EXPECT_FALSE(error.isEmpty());
+    EXPECT_EQ(readBytes(modulePath), content);
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, copyOfPlaceholder)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    auto* linked = root->findDirectChild<GtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+
+    // copies are independent of the linked file
+    GtObjectMemento copy = linked->toMemento(false);
+    EXPECT_FALSE(copy.isFlagEnabled(GtObjectMemento::IsPlaceholder));
+    EXPECT_NE(copy.uuid(), linkedUuid);
+    ASSERT_EQ(copy.childObjects.size(), 1);
+    EXPECT_NE(copy.childObjects.first().uuid(), nestedUuid);
+    EXPECT_FALSE(copy.childObjects.first().isFlagEnabled(
+                     GtObjectMemento::IsPlaceholder));
+
+    EXPECT_FALSE(linked->isMaterialized());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, binaryFormat)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    GtObjectMemento memento = root->toMemento();
+    GtObjectMemento copy(memento.toByteArray(GtObjectMemento::Format::Binary));
+
+    ASSERT_EQ(copy.childObjects.size(), 1);
+    auto const& placeholder = copy.childObjects.first();
+    EXPECT_TRUE(placeholder.isFlagEnabled(GtObjectMemento::IsPlaceholder));
+    EXPECT_EQ(placeholder.linkedFilePath(),
+              memento.childObjects.first().linkedFilePath());
+    EXPECT_EQ(placeholder.linkedFileBaseDir(),
+              memento.childObjects.first().linkedFileBaseDir());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, missingLinkedFile)
+{
+    ASSERT_TRUE(QFile::remove(linkedPath));
+
+    QStringList warnings;
+    auto root = load(masterPath, gt::xml::LinkedObjectLoading::OnDemand,
+                     &warnings);
+    ASSERT_NE(root, nullptr);
+    EXPECT_FALSE(warnings.isEmpty());
+
+    auto* linked = root->findDirectChild<GtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+    EXPECT_TRUE(linked->isMaterialized());
+    EXPECT_TRUE(linked->isDummy());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, savedLinkedFiles)
+{
+    QDomDocument doc;
+    doc.setContent(rootMemento.toByteArray());
+
+    QHash<QString, QString> linkedFiles;
+    ASSERT_TRUE(gt::xml::saveProjectXmlWithLinkedObjects(
+        QStringLiteral("Test"), doc, QFileInfo(masterPath).dir(), masterPath,
+        gt::xml::LinkFileSaveType::WithLinkedFiles, nullptr, &linkedFiles));
+
+    ASSERT_EQ(linkedFiles.size(), 2);
+    EXPECT_EQ(linkedFiles.value(linkedUuid), QFileInfo(linkedPath).absoluteFilePath());
+    EXPECT_TRUE(QFileInfo::exists(linkedFiles.value(nestedUuid)));
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, materializedObjectInSync)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+    root->acceptChangesRecursively();
+
+    auto* linked = root->findDirectChild<TestSpecialGtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+    ASSERT_TRUE(linked->materialize());
+
+    // loading the data is no modification
+    EXPECT_FALSE(root->hasChildChanged());
+    EXPECT_TRUE(linked->isLinkedFileInSync());
+    EXPECT_EQ(linked->linkedFilePath(), QFileInfo(linkedPath).absoluteFilePath());
+
+    // unchanged objects keep their linked file when saving
+    QByteArray linkedContent = readBytes(linkedPath);
+
+    QDomDocument doc;
+    doc.setContent(root->toMemento().toByteArray());
+    QDomElement elem = doc.documentElement()
+            .firstChildElement(gt::xml::S_OBJECTLIST_TAG)
+            .firstChildElement(gt::xml::S_OBJECT_TAG);
+    ASSERT_FALSE(elem.isNull());
+
+    QDomElement ref = doc.createElement(gt::xml::S_OBJECTREF_TAG);
+    ref.setAttribute(gt::xml::S_CLASS_TAG, elem.attribute(gt::xml::S_CLASS_TAG));
+    ref.setAttribute(gt::xml::S_NAME_TAG, elem.attribute(gt::xml::S_NAME_TAG));
+    ref.setAttribute(gt::xml::S_UUID_TAG, linked->uuid());
+    ref.setAttribute(gt::xml::S_HREF_TAG, linked->linkedFilePath());
+    ref.setAttribute(gt::xml::S_LINKBASE_TAG, linked->linkedFileBaseDir());
+    elem.parentNode().replaceChild(ref, elem);
+
+    QHash<QString, QString> linkedFiles;
+    ASSERT_TRUE(gt::xml::saveProjectXmlWithLinkedObjects(
+        QStringLiteral("Test"), doc, QFileInfo(masterPath).dir(), masterPath,
+        gt::xml::LinkFileSaveType::WithLinkedFiles, nullptr, &linkedFiles));
+    EXPECT_EQ(readBytes(linkedPath), linkedContent);
+    EXPECT_EQ(linkedFiles.value(linked->uuid()), linked->linkedFilePath());
+
+    // the file was not replaced, thus no backup was created
+    EXPECT_TRUE(QFile::exists(masterPath + "_backup"));
+    EXPECT_FALSE(QFile::exists(linkedPath + "_backup"));
+
+    // changes of the object or its children invalidate the file
+    auto* nested = linked->findDirectChild<GtObject*>("Nested");
+    ASSERT_NE(nested, nullptr);
+    nested->setObjectName("Renamed");
+    EXPECT_FALSE(linked->isLinkedFileInSync());
+
+    root->acceptChangesRecursively();
+    EXPECT_TRUE(linked->isLinkedFileInSync());
+
+    linked->setDouble(1.0);
+    EXPECT_FALSE(linked->isLinkedFileInSync());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, setLinkedFileLocation)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    auto* linked = root->findDirectChild<GtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+
+    // the file of a placeholder cannot be reset
+    linked->setLinkedFileLocation({}, {});
+    EXPECT_FALSE(linked->isMaterialized());
+    EXPECT_EQ(linked->linkedFilePath(), QFileInfo(linkedPath).absoluteFilePath());
+
+    ASSERT_TRUE(linked->materialize());
+    linked->setLinkedFileLocation({}, {});
+    EXPECT_TRUE(linked->isMaterialized());
+    EXPECT_TRUE(linked->linkedFilePath().isEmpty());
+    EXPECT_FALSE(linked->isLinkedFileInSync());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, lookupByUuid)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    auto* linked = root->findDirectChild<GtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+
+    // lookups do not load placeholders
+    EXPECT_EQ(root->getObjectByUuid(nestedUuid), nullptr);
+    EXPECT_FALSE(linked->isMaterialized());
+
+    // only the placeholders on the way are loaded
+    GtObject* nested = root->materializeObjectByUuid(nestedUuid);
+    ASSERT_NE(nested, nullptr);
+    EXPECT_EQ(nested->objectName(), "Nested");
+    EXPECT_FALSE(nested->isMaterialized());
+    EXPECT_TRUE(linked->isMaterialized());
+
+    EXPECT_EQ(root->getObjectByUuid(nestedUuid), nested);
+
+    // unknown objects are searched in all placeholders
+    EXPECT_EQ(root->getObjectByUuid(QStringLiteral("{unknown}")), nullptr);
+    EXPECT_FALSE(nested->isMaterialized());
+    EXPECT_EQ(root->materializeObjectByUuid(QStringLiteral("{unknown}")),
+              nullptr);
+    EXPECT_TRUE(nested->isMaterialized());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, lookupByPath)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    auto* linked = root->findDirectChild<GtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+
+    GtObject const* croot = root.get();
+    EXPECT_EQ(croot->getObjectByPath("Root;Linked;Nested"), nullptr);
+    EXPECT_FALSE(linked->isMaterialized());
+
+    GtObject* nested = root->materializeObjectByPath("Root;Linked;Nested");
+    ASSERT_NE(nested, nullptr);
+    EXPECT_EQ(nested->uuid(), nestedUuid);
+    EXPECT_TRUE(linked->isMaterialized());
+    EXPECT_FALSE(nested->isMaterialized());
+
+    EXPECT_EQ(croot->getObjectByPath("Root;Linked;Nested"), nested);
+
+    EXPECT_EQ(root->materializeObjectByPath("Root;Linked;Unknown"), nullptr);
+    EXPECT_EQ(root->materializeObjectByPath("Other;Linked"), nullptr);
+    EXPECT_FALSE(nested->isMaterialized());
+}
+
+TEST_F(TestGtOnDemandLinkedObjects, constPropertyAccess)
+{
+    auto root = load(masterPath);
+    ASSERT_NE(root, nullptr);
+
+    GtObject* linked = root->findDirectChild<GtObject*>("Linked");
+    ASSERT_NE(linked, nullptr);
+    ASSERT_FALSE(linked->isMaterialized());
+
+    // const access does not load the placeholder
+    GtObject const* clinked = linked;
+    clinked->findProperty("doubleProp");
+    clinked->fullPropertyList();
+    EXPECT_FALSE(linked->isMaterialized());
+
+    // moving objects to another thread does not load them
+    gt::moveToThread(*root, root->thread());
+    EXPECT_FALSE(linked->isMaterialized());
+
+    auto* prop = linked->findProperty("doubleProp");
+    ASSERT_NE(prop, nullptr);
+    EXPECT_TRUE(linked->isMaterialized());
+    EXPECT_DOUBLE_EQ(prop->valueToVariant().toDouble(), 2.5);
+}
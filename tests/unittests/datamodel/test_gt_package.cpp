@@ -157,6 +157,38 @@ TEST_F(TestGtPackage, saveDataSerializesDirectChildren)
     EXPECT_TRUE(objectElement.nextSiblingElement("object").isNull());
 }
 
+TEST_F(TestGtPackage, saveMementoDataEqualsSaveData)
+{
+    TestPackage package;
+
+    auto* child1 = new TestSpecialGtObject;
+    child1->setObjectName("child1");
+    child1->setDouble(12.);
+    ASSERT_TRUE(package.appendChild(child1));
+
+    auto* child2 = new TestSpecialGtObject;
+    child2->setObjectName("child2");
+    child2->setSaveAsOwnFile(true);
+    ASSERT_TRUE(package.appendChild(child2));
+
+    QVector<GtObjectMemento> objects;
+    EXPECT_TRUE(package.saveMementoData(objects));
+    ASSERT_EQ(objects.size(), 2);
+
+    QDomDocument doc;
+    auto root = rootElement(doc);
+    EXPECT_TRUE(package.saveData(root, doc));
+
+    auto objectElement = root.firstChildElement("object");
+    for (const GtObjectMemento& memento : qAsConst(objects))
+    {
+        ASSERT_FALSE(objectElement.isNull());
+        EXPECT_EQ(memento.toByteArray(),
+                  GtObjectMemento(objectElement).toByteArray());
+        objectElement = objectElement.nextSiblingElement("object");
+    }
+}
+
 TEST_F(TestGtPackage, miscDataOperationsReturnTrue)
 {
     TestPackage package;
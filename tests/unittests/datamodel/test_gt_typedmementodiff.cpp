@@ -0,0 +1,203 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2026 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_typedmementodiff.h"
+#include "gt_objectmementodiff.h"
+#include "gt_objectmemento.h"
+#include "gt_objectfactory.h"
+#include "test_gt_object.h"
+
+#include <algorithm>
+
+namespace
+{
+
+QStringList
+childNames(const GtObject& obj)
+{
+    QStringList names;
+    for (GtObject const* child : obj.findDirectChildren())
+    {
+        names << child->objectName();
+    }
+    return names;
+}
+
+TestSpecialGtObject*
+newChild(const QString& name)
+{
+    auto* child = new TestSpecialGtObject;
+    child->setObjectName(name);
+    return child;
+}
+
+} // namespace
+
+class TestGtTypedMementoDiff : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        obj.setObjectName("Object");
+        obj.setFactory(gtObjectFactory);
+
+        if (!gtObjectFactory->knownClass("TestSpecialGtObject"))
+        {
+            gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+        }
+    }
+
+    TestSpecialGtObject obj;
+};
+
+TEST_F(TestGtTypedMementoDiff, identicalMementos)
+{
+    GtTypedMementoDiff diff(obj.toMemento(), obj.toMemento());
+
+    EXPECT_TRUE(diff.isNull());
+    EXPECT_TRUE(diff.isValid());
+    EXPECT_TRUE(GtObjectMementoDiff(diff).isNull());
+}
+
+TEST_F(TestGtTypedMementoDiff, differentRoots)
+{
+    TestSpecialGtObject other;
+
+    GtTypedMementoDiff diff(obj.toMemento(), other.toMemento());
+
+    EXPECT_TRUE(diff.isNull());
+    EXPECT_FALSE(diff.isValid());
+    EXPECT_TRUE(diff.hasRootMismatch());
+    EXPECT_EQ(GtObjectMementoDiff(diff).documentElement().tagName(),
+              "ROOT_ERROR");
+}
+
+TEST_F(TestGtTypedMementoDiff, typedPropertyValues)
+{
+    GtObjectMemento mem1 = obj.toMemento();
+
+    QVector<double> values{0.1, 1e-300, -2.5};
+    obj.setDoubleVec(values);
+    obj.setDouble(123.4);
+
+    GtObjectMemento mem2 = obj.toMemento();
+
+    GtTypedMementoDiff diff(mem1, mem2);
+    ASSERT_EQ(diff.objectChanges().size(), 1);
+
+    auto const& change = diff.objectChanges().first();
+    EXPECT_EQ(change.uuid, obj.uuid());
+
+    using Op = GtTypedMementoDiff::Operation;
+    auto const& ops = change.operations;
+
+    auto vecOp = std::find_if(ops.begin(), ops.end(), [](const Op& op) {
+        return op.id == "dVec";
+    });
+    ASSERT_NE(vecOp, ops.end());
+    EXPECT_EQ(vecOp->type, GtTypedMementoDiff::OperationType::PropertyChange);
+    EXPECT_EQ(vecOp->newValue.value<QVector<double>>(), values);
+
+    auto doubleOp = std::find_if(ops.begin(), ops.end(), [](const Op& op) {
+        return op.id == "doubleProp";
+    });
+    ASSERT_NE(doubleOp, ops.end());
+    EXPECT_DOUBLE_EQ(doubleOp->oldValue.toDouble(), 0.0);
+    EXPECT_DOUBLE_EQ(doubleOp->newValue.toDouble(), 123.4);
+
+    ASSERT_TRUE(obj.revertDiff(diff));
+    EXPECT_TRUE(obj.getDoubleVec().isEmpty());
+    EXPECT_DOUBLE_EQ(obj.getDouble(), 0.0);
+
+    ASSERT_TRUE(obj.applyDiff(diff));
+    EXPECT_EQ(obj.getDoubleVec(), values);
+    EXPECT_DOUBLE_EQ(obj.getDouble(), 123.4);
+}
+
+TEST_F(TestGtTypedMementoDiff, childOrder)
+{
+    obj.appendChild(newChild("K3"));
+    obj.appendChild(newChild("K1"));
+    obj.appendChild(newChild("K2"));
+
+    GtObjectMemento mem1 = obj.toMemento();
+
+    // move children and add a new one in between
+    auto* k3 = obj.findDirectChild<GtObject*>("K3");
+    k3->setParent(nullptr);
+    obj.appendChild(k3);
+    obj.insertChild(1, newChild("Y"));
+
+    GtObjectMemento mem2 = obj.toMemento();
+    ASSERT_EQ(childNames(obj), (QStringList{"K1", "Y", "K2", "K3"}));
+
+    GtTypedMementoDiff diff(mem1, mem2);
+    ASSERT_FALSE(diff.isNull());
+    EXPECT_TRUE(diff.hasObjectTreeChanges());
+
+    ASSERT_TRUE(obj.revertDiff(diff));
+    EXPECT_EQ(childNames(obj), (QStringList{"K3", "K1", "K2"}));
+
+    ASSERT_TRUE(obj.applyDiff(diff));
+    EXPECT_EQ(childNames(obj), (QStringList{"K1", "Y", "K2", "K3"}));
+    EXPECT_TRUE(GtTypedMementoDiff(mem2, obj.toMemento()).isNull());
+}
+
+TEST_F(TestGtTypedMementoDiff, xmlConversion)
+{
+    obj.appendChild(newChild("A"));
+    obj.appendChild(newChild("B"));
+
+    GtObjectMemento mem1 = obj.toMemento();
+
+    obj.setObjectName("Renamed");
+    obj.setDoubleVec({1., 2.});
+    delete obj.findDirectChild<GtObject*>("A");
+    obj.appendChild(newChild("C"));
+
+    GtObjectMemento mem2 = obj.toMemento();
+
+    GtTypedMementoDiff typed(mem1, mem2);
+    GtObjectMementoDiff xml(typed);
+
+    EXPECT_EQ(xml.numberOfDiffSteps(), typed.objectChanges().size());
+    EXPECT_EQ(xml.hasObjectTreeChanges(), typed.hasObjectTreeChanges());
+
+    // both representations yield the same result
+    std::unique_ptr<GtObject> copy1(mem1.restore(gtObjectFactory));
+    std::unique_ptr<GtObject> copy2(mem1.restore(gtObjectFactory));
+    ASSERT_NE(copy1, nullptr);
+    ASSERT_NE(copy2, nullptr);
+
+    ASSERT_TRUE(copy1->applyDiff(typed));
+    ASSERT_TRUE(copy2->applyDiff(xml));
+
+    EXPECT_EQ(copy1->toMemento().toByteArray(), mem2.toByteArray());
+    EXPECT_EQ(copy2->toMemento().toByteArray(), mem2.toByteArray());
+}
+
+TEST_F(TestGtTypedMementoDiff, appendDiff)
+{
+    GtObjectMemento mem1 = obj.toMemento();
+    obj.setDouble(1.0);
+    GtObjectMemento mem2 = obj.toMemento();
+    obj.appendChild(newChild("A"));
+    GtObjectMemento mem3 = obj.toMemento();
+
+    GtTypedMementoDiff sum;
+    EXPECT_FALSE(sum.appendDiff(GtTypedMementoDiff{}));
+
+    sum << GtTypedMementoDiff(mem1, mem2) << GtTypedMementoDiff(mem2, mem3);
+    EXPECT_EQ(sum.objectChanges().size(), 2);
+
+    ASSERT_TRUE(obj.revertDiff(GtTypedMementoDiff(mem1, mem3)));
+    EXPECT_TRUE(childNames(obj).isEmpty());
+
+    ASSERT_TRUE(obj.applyDiff(sum));
+    EXPECT_TRUE(GtTypedMementoDiff(mem3, obj.toMemento()).isNull());
+}
@@ -12,6 +12,12 @@
 
 #include "gt_objectio.h"
 #include "gt_objectmemento.h"
+#include "gt_xmlutilities.h"
+#include "test_gt_object.h"
+#include "test_propertycontainerobject.h"
+
+#include <QBuffer>
+#include <QDomDocument>
 
 #include <iostream>
 
@@ -94,3 +100,89 @@ TEST_F(TestGtObjectIO_Read, invalidQVariant)
     EXPECT_FALSE(variant.isValid());
 }
 
+
+namespace
+{
+
+QByteArray
+writeViaDom(const GtObjectMemento& memento)
+{
+    QDomDocument doc;
+    doc.appendChild(GtObjectIO().toDomElement(memento, doc));
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    EXPECT_TRUE(gt::xml::writeDomDocumentToDevice(buffer, doc, true));
+
+    return buffer.data();
+}
+
+QByteArray
+writeViaStream(const GtObjectMemento& memento)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    EXPECT_TRUE(gt::xml::writeMementoToDevice(buffer, memento));
+
+    return buffer.data();
+}
+
+} // namespace
+
+TEST(TestGtObjectIO_Write, streamingEqualsDomOutput)
+{
+    TestObject obj;
+    obj.addEnvironmentVar("PATH", "/usr/bin");
+    obj.addEnvironmentVar("MULTILINE", "first\r\nsecond");
+
+    auto* child = new TestSpecialGtObject;
+    child->setObjectName("Child");
+    child->setDoubleVec({0.5, 1.5});
+    child->setString("line1\r\nline2 <&>");
+    child->setInt(12);
+    obj.appendChild(child);
+
+    auto* linked = new TestSpecialGtObject;
+    linked->setObjectName("Linked");
+    obj.appendChild(linked);
+
+    GtObjectMemento memento = obj.toMemento();
+    ASSERT_EQ(memento.childObjects.size(), 2);
+    memento.childObjects[1].setFlagEnabled(GtObjectMemento::SaveAsOwnFile,
+                                           true);
+
+    // an object, which was not loaded from its linked file yet
+    GtObjectMemento placeholder;
+    placeholder.setClassName("TestSpecialGtObject");
+    placeholder.setIdent("Placeholder");
+    placeholder.setUuid("{placeholder-uuid}");
+    placeholder.setLinkedFile("/tmp/base/objects/placeholder.gtobj.xml",
+                              "/tmp/base");
+    placeholder.setFlagEnabled(GtObjectMemento::SaveAsOwnFile, true);
+    memento.childObjects.push_back(placeholder);
+
+    QByteArray const expected = writeViaDom(memento);
+    ASSERT_FALSE(expected.isEmpty());
+    EXPECT_EQ(writeViaStream(memento), expected);
+
+    // the written data can be read again
+    GtObjectMemento restored(writeViaStream(memento));
+    EXPECT_EQ(restored.uuid(), memento.uuid());
+    EXPECT_EQ(restored.childObjects.size(), 3);
+}
+
+TEST(TestGtObjectIO_Write, streamingEqualsDomOutputInactiveProperty)
+{
+    TestSpecialGtObject obj;
+    obj.setObjectName("Inactive");
+
+    GtObjectMemento memento = obj.toMemento();
+
+    // inactive properties are written with an active attribute
+    for (auto& property : memento.properties)
+    {
+        property.isActive = false;
+    }
+
+    EXPECT_EQ(writeViaStream(memento), writeViaDom(memento));
+}